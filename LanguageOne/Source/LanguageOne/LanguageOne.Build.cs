@@ -71,10 +71,12 @@ public class LanguageOne : ModuleRules
 				"Kismet",
 				"GraphEditor",
 				"HTTP",
+				"HTTPServer",
 				"Json",
 				"JsonUtilities",
 				"AssetRegistry",
 				"ContentBrowser",
+				"ContentBrowserData",
 				"UMG",
 				"UMGEditor",
 				"StringTableEditor"
@@ -0,0 +1,314 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "AssetStreamLoader.h"
+#include "LanguageOneSettings.h"
+#include "Engine/StreamableManager.h"
+#include "Containers/Ticker.h"
+#include "HAL/PlatformMemory.h"
+#include "Subsystems/AssetEditorSubsystem.h"
+#include "Editor.h"
+#include "FileHelpers.h"
+#include "PackageTools.h"
+
+FAssetStreamWindow FAssetStreamWindow::FromSettings(TFunction<void(FAssetStreamLoader& Loader)> InOnWindowDelivered)
+{
+	FAssetStreamWindow Result;
+	const ULanguageOneSettings* Settings = GetDefault<ULanguageOneSettings>();
+	if (Settings->bBoundedMemoryBatch)
+	{
+		Result.WindowSize = FMath::Max(1, Settings->BatchWindowSize);
+		Result.MemoryCeilingBytes = (uint64)FMath::Max(0, Settings->BatchMemoryCeilingMB) * 1024 * 1024;
+		Result.OnWindowDelivered = MoveTemp(InOnWindowDelivered);
+	}
+	return Result;
+}
+
+FStreamableManager& FAssetStreamLoader::GetStreamableManager()
+{
+	static FStreamableManager StreamableManager;
+	return StreamableManager;
+}
+
+FAssetStreamLoader::FAssetStreamLoader(const TArray<FAssetData>& InAssets, FOnAssetLoaded InOnAssetLoaded, TFunction<void()> InOnFinished, FAssetStreamWindow InWindow, int32 InLookAhead)
+	: Assets(InAssets)
+	, OnAssetLoaded(MoveTemp(InOnAssetLoaded))
+	, OnFinished(MoveTemp(InOnFinished))
+	, Window(MoveTemp(InWindow))
+{
+	LookAhead = FMath::Max(1, InLookAhead > 0 ? InLookAhead : GetDefault<ULanguageOneSettings>()->AssetLoadLookAhead);
+}
+
+TSharedRef<FAssetStreamLoader> FAssetStreamLoader::Start(const TArray<FAssetData>& InAssets, FOnAssetLoaded InOnAssetLoaded, TFunction<void()> InOnFinished, FAssetStreamWindow InWindow, int32 InLookAhead)
+{
+	TSharedRef<FAssetStreamLoader> Loader = MakeShareable(new FAssetStreamLoader(InAssets, MoveTemp(InOnAssetLoaded), MoveTemp(InOnFinished), MoveTemp(InWindow), InLookAhead));
+
+	UE_LOG(LogTemp, Log, TEXT("Streaming %d assets (look-ahead %d, window %d, memory ceiling %llu MB)"),
+		Loader->Assets.Num(), Loader->LookAhead, Loader->Window.WindowSize, Loader->Window.MemoryCeilingBytes / (1024 * 1024));
+	Loader->IssueLoads();
+	return Loader;
+}
+
+void FAssetStreamLoader::Cancel()
+{
+	if (bFinished)
+	{
+		return;
+	}
+
+	bCancelled = true;
+	bFinished = true;
+
+	for (TPair<int32, TSharedPtr<FStreamableHandle>>& Pair : LoadingHandles)
+	{
+		if (Pair.Value.IsValid())
+		{
+			Pair.Value->CancelHandle();
+		}
+	}
+	LoadingHandles.Empty();
+	CompletedIndices.Empty();
+	WindowAssets.Empty();
+
+	UE_LOG(LogTemp, Log, TEXT("Asset streaming cancelled: %d/%d assets processed"), ProcessedCount, Assets.Num());
+}
+
+void FAssetStreamLoader::IssueLoads()
+{
+	// 加载可能在 RequestAsyncLoad 内同步完成，重入时交给外层循环处理
+	if (bIsIssuing || bFinished || bWindowPaused)
+	{
+		return;
+	}
+	TGuardValue<bool> IssueGuard(bIsIssuing, true);
+
+	// 回调中调用方可能释放加载器
+	TSharedRef<FAssetStreamLoader> KeepAlive = AsShared();
+
+	bool bMadeProgress = true;
+	while (bMadeProgress && !bCancelled)
+	{
+		bMadeProgress = false;
+
+		// 先处理已加载完成的资产，释放预加载名额
+		while (CompletedIndices.Num() > 0 && !bCancelled)
+		{
+			const int32 AssetIndex = CompletedIndices[0];
+			CompletedIndices.RemoveAt(0);
+
+			TSharedPtr<FStreamableHandle> Handle;
+			LoadingHandles.RemoveAndCopyValue(AssetIndex, Handle);
+
+			UObject* Asset = Handle.IsValid() ? Handle->GetLoadedAsset() : nullptr;
+			ProcessAsset(AssetIndex, Asset, Handle);
+			bMadeProgress = true;
+		}
+
+		// 发起新的加载
+		while (!bCancelled && NextToIssue < Assets.Num() && LoadingHandles.Num() < LookAhead && !IsWindowFull())
+		{
+			const int32 AssetIndex = NextToIssue++;
+			const FAssetData& AssetData = Assets[AssetIndex];
+			WindowIssued++;
+			bMadeProgress = true;
+
+			// 已在内存中的资产直接处理
+			if (AssetData.IsAssetLoaded())
+			{
+				ProcessAsset(AssetIndex, AssetData.GetAsset(), nullptr);
+				continue;
+			}
+
+			// 先占位，同步完成时 OnLoaded 能找到这个资产
+			LoadingHandles.Add(AssetIndex, nullptr);
+			TSharedPtr<FStreamableHandle> Handle = GetStreamableManager().RequestAsyncLoad(
+				AssetData.ToSoftObjectPath(),
+				FStreamableDelegate::CreateLambda([WeakLoader = TWeakPtr<FAssetStreamLoader>(KeepAlive), AssetIndex]()
+				{
+					if (TSharedPtr<FAssetStreamLoader> Loader = WeakLoader.Pin())
+					{
+						Loader->OnLoaded(AssetIndex);
+					}
+				}));
+
+			if (Handle.IsValid())
+			{
+				if (TSharedPtr<FStreamableHandle>* Loading = LoadingHandles.Find(AssetIndex))
+				{
+					*Loading = Handle;
+				}
+			}
+			else
+			{
+				// 无效路径：按加载失败处理
+				UE_LOG(LogTemp, Warning, TEXT("Failed to request async load for %s"), *AssetData.AssetName.ToString());
+				CompletedIndices.AddUnique(AssetIndex);
+			}
+		}
+	}
+
+	// 窗口内的资产全部回调后暂停，等待调用方写回并释放窗口
+	if (Window.IsEnabled() && !bCancelled && WindowIssued > 0 && LoadingHandles.Num() == 0 && CompletedIndices.Num() == 0
+		&& (NextToIssue >= Assets.Num() || IsWindowFull()))
+	{
+		bWindowPaused = true;
+		WindowCount++;
+		UE_LOG(LogTemp, Log, TEXT("Asset window %d delivered: %d assets (%d/%d processed)"), WindowCount, WindowIssued, ProcessedCount, Assets.Num());
+
+		if (Window.OnWindowDelivered)
+		{
+			Window.OnWindowDelivered(*this);
+		}
+		else
+		{
+			ReleaseWindowAndContinue();
+		}
+		return;
+	}
+
+	TryFinish();
+}
+
+void FAssetStreamLoader::OnLoaded(int32 AssetIndex)
+{
+	if (bFinished || !LoadingHandles.Contains(AssetIndex))
+	{
+		return;
+	}
+
+	CompletedIndices.AddUnique(AssetIndex);
+	IssueLoads();
+}
+
+void FAssetStreamLoader::ProcessAsset(int32 AssetIndex, UObject* Asset, TSharedPtr<FStreamableHandle> Handle)
+{
+	ProcessedCount++;
+
+	if (Window.IsEnabled() && Asset)
+	{
+		WindowAssets.Add({ Asset, Handle.IsValid(), Asset->GetOutermost()->IsDirty() });
+	}
+
+	OnAssetLoaded(Assets[AssetIndex], Asset, Handle);
+}
+
+bool FAssetStreamLoader::IsWindowFull() const
+{
+	if (!Window.IsEnabled())
+	{
+		return false;
+	}
+
+	if (WindowIssued >= Window.WindowSize)
+	{
+		return true;
+	}
+
+	// 至少处理一个资产，避免内存已经超过上限时停滞
+	return Window.MemoryCeilingBytes > 0 && WindowIssued > 0 && FPlatformMemory::GetStats().UsedPhysical >= Window.MemoryCeilingBytes;
+}
+
+void FAssetStreamLoader::ReleaseWindowAndContinue()
+{
+	// 推迟到下一帧：调用方通常在 HTTP 或加载回调中，不适合保存包和垃圾回收
+	TSharedRef<FAssetStreamLoader> KeepAlive = AsShared();
+	FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateLambda([KeepAlive](float DeltaTime)
+	{
+		KeepAlive->ReleaseWindow();
+		return false;
+	}));
+}
+
+void FAssetStreamLoader::ReleaseWindow()
+{
+	if (bCancelled || !bWindowPaused)
+	{
+		return;
+	}
+
+	const uint64 UsedBefore = FPlatformMemory::GetStats().UsedPhysical;
+
+	// 保存本次处理中修改过的包；回调前已有未保存修改的包是用户自己的修改，不替用户保存
+	TSet<UPackage*> PreDirtyPackages;
+	for (const FWindowAsset& WindowAsset : WindowAssets)
+	{
+		UObject* Asset = WindowAsset.Asset.Get();
+		if (Asset && WindowAsset.bWasDirty)
+		{
+			PreDirtyPackages.Add(Asset->GetOutermost());
+		}
+	}
+
+	TArray<UPackage*> DirtyPackages;
+	for (const FWindowAsset& WindowAsset : WindowAssets)
+	{
+		UObject* Asset = WindowAsset.Asset.Get();
+		UPackage* Package = Asset ? Asset->GetOutermost() : nullptr;
+		if (Package && Package->IsDirty() && !PreDirtyPackages.Contains(Package))
+		{
+			DirtyPackages.AddUnique(Package);
+		}
+	}
+	if (PreDirtyPackages.Num() > 0)
+	{
+		UE_LOG(LogTemp, Log, TEXT("Asset window %d: %d packages had unsaved changes before the job, leaving them loaded and unsaved"), WindowCount, PreDirtyPackages.Num());
+	}
+	if (DirtyPackages.Num() > 0 && !UEditorLoadingAndSavingUtils::SavePackages(DirtyPackages, true))
+	{
+		UE_LOG(LogTemp, Warning, TEXT("Failed to save some of the %d packages in asset window %d"), DirtyPackages.Num(), WindowCount);
+	}
+
+	// 卸载本次加载的包；开始前已加载、仍未保存或已打开编辑器的包保留
+	UAssetEditorSubsystem* AssetEditorSubsystem = GEditor ? GEditor->GetEditorSubsystem<UAssetEditorSubsystem>() : nullptr;
+	TArray<UPackage*> PackagesToUnload;
+	for (const FWindowAsset& WindowAsset : WindowAssets)
+	{
+		UObject* Asset = WindowAsset.Asset.Get();
+		UPackage* Package = Asset ? Asset->GetOutermost() : nullptr;
+		if (!Package || !WindowAsset.bLoadedByLoader || Package->IsDirty())
+		{
+			continue;
+		}
+		if (AssetEditorSubsystem && AssetEditorSubsystem->FindEditorForAsset(Asset, false))
+		{
+			continue;
+		}
+		PackagesToUnload.AddUnique(Package);
+	}
+	WindowAssets.Reset();
+
+	if (PackagesToUnload.Num() > 0)
+	{
+		UPackageTools::UnloadPackages(PackagesToUnload);
+	}
+	CollectGarbage(GARBAGE_COLLECTION_KEEPFLAGS);
+
+	const uint64 UsedAfter = FPlatformMemory::GetStats().UsedPhysical;
+	UE_LOG(LogTemp, Log, TEXT("Asset window %d released: %d packages saved, %d unloaded, memory %llu MB -> %llu MB"),
+		WindowCount, DirtyPackages.Num(), PackagesToUnload.Num(), UsedBefore / (1024 * 1024), UsedAfter / (1024 * 1024));
+
+	WindowIssued = 0;
+	bWindowPaused = false;
+	IssueLoads();
+}
+
+void FAssetStreamLoader::TryFinish()
+{
+	if (bFinished || bCancelled || bWindowPaused || NextToIssue < Assets.Num() || LoadingHandles.Num() > 0 || CompletedIndices.Num() > 0)
+	{
+		return;
+	}
+
+	// 分窗口时最后一个窗口释放后才结束
+	if (Window.IsEnabled() && WindowIssued > 0)
+	{
+		return;
+	}
+
+	bFinished = true;
+	UE_LOG(LogTemp, Log, TEXT("Asset streaming finished: %d assets processed"), ProcessedCount);
+
+	if (OnFinished)
+	{
+		OnFinished();
+	}
+}
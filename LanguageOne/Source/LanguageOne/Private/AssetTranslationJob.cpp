@@ -0,0 +1,443 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "AssetTranslationJob.h"
+#include "AssetTranslatorUI.h"
+#include "AssetStreamLoader.h"
+#include "TranslationRequestScheduler.h"
+#include "LanguageOneSettings.h"
+#include "HAL/PlatformMemory.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Dom/JsonObject.h"
+#include "Serialization/JsonSerializer.h"
+#include "Editor.h"
+#include "Editor/Transactor.h"
+#include "ScopedTransaction.h"
+
+namespace LanguageOneAssetJob
+{
+	/** 当前撤销缓冲大小 */
+	static uint64 GetUndoBufferSize()
+	{
+		return (GEditor && GEditor->Trans) ? (uint64)GEditor->Trans->GetUndoSize() : 0;
+	}
+
+	/** 报告格式版本 */
+	static const int32 ReportVersion = 1;
+
+	/** 已排序数组的百分位（最近秩） */
+	static double GetPercentile(const TArray<double>& SortedValues, double Percentile)
+	{
+		if (SortedValues.Num() == 0)
+		{
+			return 0.0;
+		}
+		const int32 Rank = FMath::CeilToInt(Percentile / 100.0 * SortedValues.Num());
+		return SortedValues[FMath::Clamp(Rank - 1, 0, SortedValues.Num() - 1)];
+	}
+
+	/** 一个翻译服务的报告 */
+	static TSharedRef<FJsonObject> MakeProviderReport(const FTranslationProviderRunStats& Stats)
+	{
+		TArray<double> Latencies = Stats.LatencySeconds;
+		Latencies.Sort();
+
+		TSharedRef<FJsonObject> Latency = MakeShared<FJsonObject>();
+		Latency->SetNumberField(TEXT("p50"), GetPercentile(Latencies, 50.0) * 1000.0);
+		Latency->SetNumberField(TEXT("p95"), GetPercentile(Latencies, 95.0) * 1000.0);
+		Latency->SetNumberField(TEXT("p99"), GetPercentile(Latencies, 99.0) * 1000.0);
+		Latency->SetNumberField(TEXT("max"), Latencies.Num() > 0 ? Latencies.Last() * 1000.0 : 0.0);
+
+		TSharedRef<FJsonObject> Failures = MakeShared<FJsonObject>();
+		for (const TPair<FString, int32>& Pair : Stats.FailuresByReason)
+		{
+			Failures->SetNumberField(Pair.Key, Pair.Value);
+		}
+
+		TSharedRef<FJsonObject> Report = MakeShared<FJsonObject>();
+		Report->SetNumberField(TEXT("requests"), Stats.Requests);
+		Report->SetNumberField(TEXT("characters_sent"), (double)Stats.CharactersSent);
+		Report->SetNumberField(TEXT("retries"), Stats.Retries);
+		Report->SetNumberField(TEXT("failures"), Stats.Failures);
+		Report->SetObjectField(TEXT("failures_by_reason"), Failures);
+		Report->SetObjectField(TEXT("latency_ms"), Latency);
+		return Report;
+	}
+}
+
+TSharedPtr<FAssetTranslationJob> FAssetTranslationJob::ActiveJob = nullptr;
+
+FAssetTranslationJob::FAssetTranslationJob(const FString& InOperationName, const FString& InOperationId, int32 InTotalAssets, TSharedPtr<STranslationProgressWindow> InProgressWidget)
+	: OperationName(InOperationName)
+	, OperationId(InOperationId)
+	, ProgressWidget(InProgressWidget)
+{
+	Result.TotalAssets = InTotalAssets;
+	Result.Stats.AssetCount = InTotalAssets;
+	Future = Promise.GetFuture().Share();
+	RequestGroup = FTranslationRequestScheduler::Get().AllocateRequestGroup();
+	FTranslationRequestScheduler::Get().TrackRequestGroup(RequestGroup);
+	StartTime = FPlatformTime::Seconds();
+	StartTimeUtc = FDateTime::UtcNow();
+
+	// 低内存批处理会保存并卸载资产，撤销快照无法使用；命令行运行没有撤销
+	const ULanguageOneSettings* Settings = GetDefault<ULanguageOneSettings>();
+	bRecordUndo = Settings->bRecordUndoTransactions && !Settings->bBoundedMemoryBatch && !IsRunningCommandlet() && GEditor && GEditor->Trans;
+	UndoSizeAtStart = LanguageOneAssetJob::GetUndoBufferSize();
+	Result.StartMemoryBytes = FPlatformMemory::GetStats().UsedPhysical;
+	Result.PeakMemoryBytes = Result.StartMemoryBytes;
+}
+
+TSharedRef<FAssetTranslationJob> FAssetTranslationJob::Start(const FString& InOperationName, const FString& InOperationId, int32 InTotalAssets, TSharedPtr<STranslationProgressWindow> InProgressWidget)
+{
+	// 同一时间只运行一个任务，新任务开始前取消旧任务
+	if (ActiveJob.IsValid() && !ActiveJob->IsFinished())
+	{
+		UE_LOG(LogTemp, Warning, TEXT("Starting asset job '%s' while '%s' is still running, cancelling the previous job"), *InOperationName, *ActiveJob->OperationName);
+		ActiveJob->Cancel();
+	}
+
+	TSharedRef<FAssetTranslationJob> Job = MakeShareable(new FAssetTranslationJob(InOperationName, InOperationId, InTotalAssets, InProgressWidget));
+	ActiveJob = Job;
+
+	// PeakUsedPhysical 是进程启动以来的峰值，任务期间的峰值需要自己每帧采样
+	Job->MemorySampleHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateSP(Job, &FAssetTranslationJob::TickMemorySample));
+
+	if (Job->ProgressWidget.IsValid())
+	{
+		Job->ProgressWidget->SetOperationName(InOperationName);
+	}
+	FAssetTranslatorUI::SetProcessing(true);
+
+	UE_LOG(LogTemp, Log, TEXT("Asset job '%s' started: %d assets (request group %u)"), *InOperationName, InTotalAssets, Job->RequestGroup);
+	return Job;
+}
+
+TSharedPtr<FAssetTranslationJob> FAssetTranslationJob::GetActive()
+{
+	return ActiveJob;
+}
+
+bool FAssetTranslationJob::CancelActive()
+{
+	if (!ActiveJob.IsValid() || ActiveJob->IsFinished())
+	{
+		return false;
+	}
+
+	// Cancel 会清空 ActiveJob，先持有引用
+	TSharedPtr<FAssetTranslationJob> Job = ActiveJob;
+	Job->Cancel();
+	return true;
+}
+
+void FAssetTranslationJob::AddPendingUnits(const TWeakObjectPtr<UObject>& Asset, int32 Count)
+{
+	if (Count > 0)
+	{
+		PendingAssets.FindOrAdd(Asset).PendingUnits += Count;
+	}
+}
+
+bool FAssetTranslationJob::HasPendingUnits(const TWeakObjectPtr<UObject>& Asset) const
+{
+	const FPendingAsset* Pending = PendingAssets.Find(Asset);
+	return Pending && Pending->PendingUnits > 0;
+}
+
+bool FAssetTranslationJob::CompleteUnit(const TWeakObjectPtr<UObject>& Asset, bool bSucceeded, TFunctionRef<void(UObject*)> FinalizeAsset)
+{
+	if (bFinished)
+	{
+		return false;
+	}
+
+	FPendingAsset* Pending = PendingAssets.Find(Asset);
+	if (!Pending || Pending->PendingUnits <= 0)
+	{
+		return false;
+	}
+
+	Pending->bAnyFailed |= !bSucceeded;
+	if (--Pending->PendingUnits > 0)
+	{
+		return false;
+	}
+
+	const bool bAssetSucceeded = !Pending->bAnyFailed;
+	PendingAssets.Remove(Asset);
+
+	UObject* AssetObject = Asset.Get();
+	if (AssetObject)
+	{
+		FinalizeAsset(AssetObject);
+	}
+	OnAssetFinished(AssetObject ? AssetObject->GetName() : FString(), bAssetSucceeded);
+	TryFinish();
+	return true;
+}
+
+void FAssetTranslationJob::CompleteAsset(const FString& AssetName, bool bSucceeded)
+{
+	if (bFinished)
+	{
+		return;
+	}
+
+	OnAssetFinished(AssetName, bSucceeded);
+	TryFinish();
+}
+
+void FAssetTranslationJob::RecordUndo(UObject* Asset, const TArray<UObject*>& Objects)
+{
+	if (!bRecordUndo || bFinished || !Asset || UndoRecordedAssets.Contains(Asset))
+	{
+		return;
+	}
+	UndoRecordedAssets.Add(Asset);
+
+	// 事务中每个对象只保存一次快照，之后的写回不再记录；撤销时整个资产一起还原
+	FScopedTransaction Transaction(FText::Format(
+		NSLOCTEXT("LanguageOne", "AssetJobTransaction", "LanguageOne: {0} {1}"),
+		FText::FromString(OperationName), FText::FromString(Asset->GetName())));
+
+	if (Asset->Modify())
+	{
+		Result.UndoSnapshots++;
+	}
+	for (UObject* Object : Objects)
+	{
+		if (Object && Object != Asset && Object->Modify())
+		{
+			Result.UndoSnapshots++;
+		}
+	}
+}
+
+void FAssetTranslationJob::SetAssetLoader(TSharedPtr<FAssetStreamLoader> InAssetLoader)
+{
+	// 资产全部在内存中时加载器会同步完成，任务可能已经结束
+	if (!bFinished)
+	{
+		AssetLoader = InAssetLoader;
+	}
+}
+
+void FAssetTranslationJob::Seal()
+{
+	bSealed = true;
+	TryFinish();
+}
+
+void FAssetTranslationJob::Cancel()
+{
+	if (bFinished)
+	{
+		return;
+	}
+
+	bCancelled = true;
+	if (AssetLoader.IsValid())
+	{
+		AssetLoader->Cancel();
+	}
+	const int32 DroppedRequests = FTranslationRequestScheduler::Get().CancelRequestGroup(RequestGroup);
+
+	Result.bCancelled = true;
+	Result.CancelledAssets = FMath::Max(0, Result.TotalAssets - CompletedAssets);
+	UE_LOG(LogTemp, Log, TEXT("Asset job '%s' cancelled: %d assets unfinished, %d requests dropped"), *OperationName, Result.CancelledAssets, DroppedRequests);
+
+	Finish();
+}
+
+void FAssetTranslationJob::OnAssetFinished(const FString& AssetName, bool bSucceeded)
+{
+	SampleMemory();
+
+	CompletedAssets++;
+	if (bSucceeded)
+	{
+		Result.SucceededAssets++;
+	}
+	else
+	{
+		Result.FailedAssets++;
+	}
+
+	if (ProgressWidget.IsValid())
+	{
+		ProgressWidget->UpdateProgress(CompletedAssets, AssetName);
+		if (bSucceeded)
+		{
+			ProgressWidget->IncrementSuccess();
+		}
+		else
+		{
+			ProgressWidget->IncrementFailed();
+		}
+	}
+}
+
+void FAssetTranslationJob::TryFinish()
+{
+	if (bSealed && !bFinished && PendingAssets.Num() == 0)
+	{
+		Finish();
+	}
+}
+
+void FAssetTranslationJob::SampleMemory()
+{
+	Result.PeakMemoryBytes = FMath::Max(Result.PeakMemoryBytes, FPlatformMemory::GetStats().UsedPhysical);
+}
+
+bool FAssetTranslationJob::TickMemorySample(float DeltaTime)
+{
+	SampleMemory();
+	return true;
+}
+
+void FAssetTranslationJob::Finish()
+{
+	bFinished = true;
+	if (MemorySampleHandle.IsValid())
+	{
+		FTSTicker::GetCoreTicker().RemoveTicker(MemorySampleHandle);
+		MemorySampleHandle.Reset();
+	}
+	PendingAssets.Empty();
+	UndoRecordedAssets.Empty();
+	AssetLoader.Reset();
+
+	if (ProgressWidget.IsValid())
+	{
+		if (bCancelled)
+		{
+			ProgressWidget->MarkFailed(FString::Printf(
+				TEXT("已取消，%d 个资产未完成 | Cancelled, %d assets unfinished"),
+				Result.CancelledAssets, Result.CancelledAssets));
+		}
+		else
+		{
+			ProgressWidget->MarkComplete(Result.SucceededAssets, Result.FailedAssets);
+		}
+	}
+
+	UE_LOG(LogTemp, Log, TEXT("Asset job '%s' finished: %d/%d succeeded, %d failed, %d cancelled"),
+		*OperationName, Result.SucceededAssets, Result.TotalAssets, Result.FailedAssets, Result.CancelledAssets);
+
+	// 内存和撤销缓冲占用
+	const FPlatformMemoryStats MemoryStats = FPlatformMemory::GetStats();
+	const uint64 UndoSize = LanguageOneAssetJob::GetUndoBufferSize();
+	Result.EndMemoryBytes = MemoryStats.UsedPhysical;
+	Result.PeakMemoryBytes = FMath::Max(Result.PeakMemoryBytes, MemoryStats.UsedPhysical);
+	Result.UndoBufferBytes = UndoSize > UndoSizeAtStart ? UndoSize - UndoSizeAtStart : 0;
+	UE_LOG(LogTemp, Log, TEXT("Asset job '%s' memory: %llu MB -> %llu MB (peak %llu MB), undo buffer +%llu KB in %d snapshots%s"),
+		*OperationName, Result.StartMemoryBytes / (1024 * 1024), Result.EndMemoryBytes / (1024 * 1024), Result.PeakMemoryBytes / (1024 * 1024),
+		Result.UndoBufferBytes / 1024, Result.UndoSnapshots, bRecordUndo ? TEXT("") : TEXT(" (undo recording off)"));
+
+	// 请求统计和任务报告
+	Result.ElapsedSeconds = FPlatformTime::Seconds() - StartTime;
+	Result.RequestStats = FTranslationRequestScheduler::Get().TakeRequestGroupStats(RequestGroup);
+	if (GetDefault<ULanguageOneSettings>()->bWriteRunReports)
+	{
+		Result.ReportPath = WriteReport();
+	}
+
+	// 先清空当前任务再通知，回调中可以立即开始新任务
+	TSharedRef<FAssetTranslationJob> KeepAlive = AsShared();
+	if (ActiveJob == KeepAlive)
+	{
+		ActiveJob.Reset();
+	}
+	FAssetTranslatorUI::SetProcessing(false);
+
+	if (OnFinished)
+	{
+		OnFinished(Result);
+	}
+	Promise.SetValue(Result);
+}
+
+FString FAssetTranslationJob::WriteReport() const
+{
+	const ULanguageOneSettings* Settings = GetDefault<ULanguageOneSettings>();
+	const FTranslationBatchStats& Stats = Result.Stats;
+
+	TSharedRef<FJsonObject> Assets = MakeShared<FJsonObject>();
+	Assets->SetNumberField(TEXT("total"), Result.TotalAssets);
+	Assets->SetNumberField(TEXT("succeeded"), Result.SucceededAssets);
+	Assets->SetNumberField(TEXT("failed"), Result.FailedAssets);
+	Assets->SetNumberField(TEXT("cancelled"), Result.CancelledAssets);
+
+	TSharedRef<FJsonObject> Units = MakeShared<FJsonObject>();
+	Units->SetNumberField(TEXT("translatable"), Stats.TranslatableUnits);
+	Units->SetNumberField(TEXT("unique"), Stats.UniqueUnits);
+	Units->SetNumberField(TEXT("cache_hits"), Result.RequestStats.CacheHits);
+	Units->SetNumberField(TEXT("restored"), Stats.RestoredUnits);
+	Units->SetNumberField(TEXT("applied"), Stats.AppliedUnits);
+	Units->SetNumberField(TEXT("failed"), Stats.FailedUnits);
+	Units->SetNumberField(TEXT("dedupe_ratio"), Stats.GetDedupeRatio());
+
+	// 每个服务的请求统计，以及所有服务的合计
+	TSharedRef<FJsonObject> Providers = MakeShared<FJsonObject>();
+	FTranslationProviderRunStats Total;
+	for (const TPair<ETranslateProvider, FTranslationProviderRunStats>& Pair : Result.RequestStats.Providers)
+	{
+		const FTranslationProviderRunStats& ProviderStats = Pair.Value;
+		Providers->SetObjectField(StaticEnum<ETranslateProvider>()->GetNameStringByValue((int64)Pair.Key), LanguageOneAssetJob::MakeProviderReport(ProviderStats));
+
+		Total.Requests += ProviderStats.Requests;
+		Total.Retries += ProviderStats.Retries;
+		Total.Failures += ProviderStats.Failures;
+		Total.CharactersSent += ProviderStats.CharactersSent;
+		Total.LatencySeconds.Append(ProviderStats.LatencySeconds);
+		for (const TPair<FString, int32>& Failure : ProviderStats.FailuresByReason)
+		{
+			Total.FailuresByReason.FindOrAdd(Failure.Key) += Failure.Value;
+		}
+	}
+
+	TSharedRef<FJsonObject> Memory = MakeShared<FJsonObject>();
+	Memory->SetNumberField(TEXT("start_mb"), (double)(Result.StartMemoryBytes / (1024 * 1024)));
+	Memory->SetNumberField(TEXT("end_mb"), (double)(Result.EndMemoryBytes / (1024 * 1024)));
+	Memory->SetNumberField(TEXT("peak_mb"), (double)(Result.PeakMemoryBytes / (1024 * 1024)));
+	Memory->SetNumberField(TEXT("undo_buffer_kb"), (double)(Result.UndoBufferBytes / 1024));
+	Memory->SetNumberField(TEXT("undo_snapshots"), Result.UndoSnapshots);
+
+	TSharedRef<FJsonObject> Report = MakeShared<FJsonObject>();
+	Report->SetNumberField(TEXT("version"), LanguageOneAssetJob::ReportVersion);
+	Report->SetStringField(TEXT("operation"), OperationId);
+	Report->SetStringField(TEXT("started_utc"), StartTimeUtc.ToIso8601());
+	Report->SetNumberField(TEXT("duration_seconds"), Result.ElapsedSeconds);
+	Report->SetBoolField(TEXT("cancelled"), Result.bCancelled);
+	Report->SetStringField(TEXT("provider"), StaticEnum<ETranslateProvider>()->GetNameStringByValue((int64)Settings->TranslateProvider));
+	Report->SetStringField(TEXT("target_language"), StaticEnum<ETranslateTargetLanguage>()->GetNameStringByValue((int64)Settings->TargetLanguage));
+	Report->SetObjectField(TEXT("assets"), Assets);
+	Report->SetObjectField(TEXT("units"), Units);
+	Report->SetObjectField(TEXT("requests"), LanguageOneAssetJob::MakeProviderReport(Total));
+	Report->SetObjectField(TEXT("providers"), Providers);
+	Report->SetNumberField(TEXT("apply_game_thread_seconds"), Stats.ApplySeconds);
+	Report->SetObjectField(TEXT("memory"), Memory);
+
+	FString Content;
+	TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&Content);
+	if (!FJsonSerializer::Serialize(Report, Writer))
+	{
+		return FString();
+	}
+
+	// 文件名：开始时间_操作_请求组，按名称排序即按时间排序
+	const FString Path = FPaths::ProjectSavedDir() / TEXT("LanguageOne") / TEXT("Reports")
+		/ FString::Printf(TEXT("%s_%s_%u.json"), *StartTimeUtc.ToString(TEXT("%Y%m%d-%H%M%S")), *OperationId, RequestGroup);
+	if (!FFileHelper::SaveStringToFile(Content, *Path, FFileHelper::EEncodingOptions::ForceUTF8WithoutBOM))
+	{
+		UE_LOG(LogTemp, Warning, TEXT("Failed to write asset job report %s"), *Path);
+		return FString();
+	}
+
+	UE_LOG(LogTemp, Log, TEXT("Asset job '%s' report: %s (%d requests, %lld characters, %.2fs applying results)"),
+		*OperationName, *Path, Total.Requests, Total.CharactersSent, Stats.ApplySeconds);
+	return Path;
+}
@@ -0,0 +1,278 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "AssetTranslationJournal.h"
+#include "TranslationMemory.h"
+#include "LanguageOneSettings.h"
+#include "Hash/CityHash.h"
+#include "HAL/FileManager.h"
+#include "Misc/FileHelper.h"
+#include "Misc/PackageName.h"
+#include "Misc/Paths.h"
+#include "UObject/Package.h"
+
+namespace LanguageOneJournal
+{
+	/** 文件头：魔数\t版本\t翻译服务\t目标语言\t资产数量 */
+	static const TCHAR* HeaderMagic = TEXT("#LanguageOneJob");
+	static const int32 FormatVersion = 1;
+
+	/** 缓冲的记录达到该数量时立即写入 */
+	static const int32 FlushThreshold = 32;
+
+	/** 有缓冲记录时最多等待多久写入（秒） */
+	static const float FlushDelaySeconds = 2.0f;
+
+	/** 日志保留天数，超过后启动时删除 */
+	static const int32 RetentionDays = 14;
+
+	/** 记录类型 */
+	static const TCHAR* TranslationRecord = TEXT("S");
+	static const TCHAR* AppliedAssetRecord = TEXT("A");
+}
+
+FString FAssetTranslationJournal::GetJournalDirectory()
+{
+	return FPaths::ProjectSavedDir() / TEXT("LanguageOne") / TEXT("Jobs");
+}
+
+TSharedPtr<FAssetTranslationJournal> FAssetTranslationJournal::Open(const TArray<FAssetData>& Assets)
+{
+	const ULanguageOneSettings* Settings = GetDefault<ULanguageOneSettings>();
+	if (!Settings->bResumeInterruptedJobs || Assets.Num() == 0)
+	{
+		return nullptr;
+	}
+
+	// 任务内容决定日志文件：资产集合（排序后与选择顺序无关）、翻译服务、目标语言
+	TArray<FString> AssetPaths;
+	AssetPaths.Reserve(Assets.Num());
+	for (const FAssetData& AssetData : Assets)
+	{
+		AssetPaths.Add(AssetData.GetObjectPathString());
+	}
+	AssetPaths.Sort();
+
+	const FString ProviderName = StaticEnum<ETranslateProvider>()->GetNameStringByValue((int64)Settings->TranslateProvider);
+	const FString TargetName = StaticEnum<ETranslateTargetLanguage>()->GetNameStringByValue((int64)Settings->TargetLanguage);
+	const FString KeySource = FString::Join(AssetPaths, TEXT("\n")) + TEXT("\n") + ProviderName + TEXT("\n") + TargetName;
+	const uint64 Key = CityHash64(reinterpret_cast<const char*>(*KeySource), KeySource.Len() * sizeof(TCHAR));
+
+	const FString Path = GetJournalDirectory() / FString::Printf(TEXT("%016llx.tsv"), Key);
+	const FString Header = FString::Printf(TEXT("%s\t%d\t%s\t%s\t%d\n"), LanguageOneJournal::HeaderMagic, LanguageOneJournal::FormatVersion, *ProviderName, *TargetName, Assets.Num());
+
+	TSharedRef<FAssetTranslationJournal> Journal = MakeShareable(new FAssetTranslationJournal(Path, Header));
+	Journal->Load();
+
+	if (Journal->IsResumed())
+	{
+		UE_LOG(LogTemp, Log, TEXT("Resuming interrupted job from %s: %d translations, %d applied assets"),
+			*Path, Journal->Translations.Num(), Journal->AppliedAssets.Num());
+	}
+	return Journal;
+}
+
+void FAssetTranslationJournal::CleanupStaleJournals()
+{
+	const FString Directory = GetJournalDirectory();
+
+	TArray<FString> Files;
+	IFileManager::Get().FindFiles(Files, *(Directory / TEXT("*.tsv")), true, false);
+
+	const FDateTime Cutoff = FDateTime::UtcNow() - FTimespan::FromDays(LanguageOneJournal::RetentionDays);
+	for (const FString& File : Files)
+	{
+		const FString Path = Directory / File;
+		if (IFileManager::Get().GetTimeStamp(*Path) < Cutoff)
+		{
+			IFileManager::Get().Delete(*Path, false, false, true);
+			UE_LOG(LogTemp, Log, TEXT("Deleted stale job journal %s"), *Path);
+		}
+	}
+}
+
+FAssetTranslationJournal::FAssetTranslationJournal(const FString& InFilePath, const FString& InHeaderLine)
+	: FilePath(InFilePath)
+	, HeaderLine(InHeaderLine)
+{
+}
+
+FAssetTranslationJournal::~FAssetTranslationJournal()
+{
+	if (FlushTickerHandle.IsValid())
+	{
+		FTSTicker::GetCoreTicker().RemoveTicker(FlushTickerHandle);
+	}
+
+	if (!bClosed)
+	{
+		Flush();
+	}
+}
+
+void FAssetTranslationJournal::Load()
+{
+	FString Content;
+	if (!FFileHelper::LoadFileToString(Content, *FilePath))
+	{
+		return;
+	}
+
+	TArray<FString> Lines;
+	Content.ParseIntoArrayLines(Lines, true);
+
+	for (const FString& Line : Lines)
+	{
+		if (Line.StartsWith(TEXT("#")))
+		{
+			continue;
+		}
+
+		// 崩溃时最后一行可能不完整，字段数量不对的行直接忽略
+		TArray<FString> Fields;
+		Line.ParseIntoArray(Fields, TEXT("\t"), false);
+		if (Fields.Num() != 3)
+		{
+			continue;
+		}
+
+		if (Fields[0] == LanguageOneJournal::TranslationRecord)
+		{
+			Translations.Add(FTranslationMemory::UnescapeField(Fields[1]), FTranslationMemory::UnescapeField(Fields[2]));
+		}
+		else if (Fields[0] == LanguageOneJournal::AppliedAssetRecord)
+		{
+			int64 Ticks = 0;
+			LexFromString(Ticks, *Fields[2]);
+			AppliedAssets.Add(Fields[1], FDateTime(Ticks));
+		}
+	}
+}
+
+bool FAssetTranslationJournal::IsAssetCompleted(const FAssetData& AssetData) const
+{
+	const FDateTime* AppliedTime = AppliedAssets.Find(AssetData.GetObjectPathString());
+	if (!AppliedTime)
+	{
+		return false;
+	}
+
+	// 内存中有未保存修改的包不算完成
+	if (const UPackage* Package = FindPackage(nullptr, *AssetData.PackageName.ToString()))
+	{
+		if (Package->IsDirty())
+		{
+			return false;
+		}
+	}
+
+	// 写回后包文件保存过，磁盘上已经是翻译后的内容
+	FString PackageFilename;
+	if (!FPackageName::TryConvertLongPackageNameToFilename(AssetData.PackageName.ToString(), PackageFilename, FPackageName::GetAssetPackageExtension()))
+	{
+		return false;
+	}
+	return IFileManager::Get().GetTimeStamp(*PackageFilename) >= *AppliedTime;
+}
+
+void FAssetTranslationJournal::RecordTranslation(const FString& SourceText, const FString& Translation)
+{
+	if (bClosed)
+	{
+		return;
+	}
+
+	const FString* Existing = Translations.Find(SourceText);
+	if (Existing && *Existing == Translation)
+	{
+		return;
+	}
+
+	Translations.Add(SourceText, Translation);
+	AppendLine(FString::Printf(TEXT("%s\t%s\t%s\n"), LanguageOneJournal::TranslationRecord,
+		*FTranslationMemory::EscapeField(SourceText), *FTranslationMemory::EscapeField(Translation)));
+}
+
+void FAssetTranslationJournal::RecordAppliedAsset(const UObject* Asset)
+{
+	if (bClosed || !Asset)
+	{
+		return;
+	}
+
+	const FString AssetPath = Asset->GetPathName();
+	const FDateTime Now = FDateTime::UtcNow();
+	AppliedAssets.Add(AssetPath, Now);
+	AppendLine(FString::Printf(TEXT("%s\t%s\t%lld\n"), LanguageOneJournal::AppliedAssetRecord, *AssetPath, Now.GetTicks()));
+}
+
+void FAssetTranslationJournal::AppendLine(const FString& Line)
+{
+	PendingLines += Line;
+	PendingCount++;
+
+	if (PendingCount >= LanguageOneJournal::FlushThreshold)
+	{
+		Flush();
+	}
+	else if (!FlushTickerHandle.IsValid())
+	{
+		FlushTickerHandle = FTSTicker::GetCoreTicker().AddTicker(
+			FTickerDelegate::CreateSP(this, &FAssetTranslationJournal::OnFlushTimer), LanguageOneJournal::FlushDelaySeconds);
+	}
+}
+
+bool FAssetTranslationJournal::OnFlushTimer(float DeltaTime)
+{
+	// 单次定时器：写入后移除，下次有新记录时重新注册
+	FlushTickerHandle.Reset();
+	Flush();
+	return false;
+}
+
+void FAssetTranslationJournal::Flush()
+{
+	if (PendingCount == 0)
+	{
+		return;
+	}
+
+	IFileManager& FileManager = IFileManager::Get();
+	const bool bNewFile = !FileManager.FileExists(*FilePath);
+	const FString Content = bNewFile ? HeaderLine + PendingLines : PendingLines;
+
+	if (!FFileHelper::SaveStringToFile(Content, *FilePath, FFileHelper::EEncodingOptions::ForceUTF8WithoutBOM, &FileManager, bNewFile ? 0 : FILEWRITE_Append))
+	{
+		UE_LOG(LogTemp, Warning, TEXT("Failed to write job journal %s"), *FilePath);
+		return;
+	}
+
+	PendingLines.Empty();
+	PendingCount = 0;
+}
+
+void FAssetTranslationJournal::Close(bool bSucceeded)
+{
+	if (bClosed)
+	{
+		return;
+	}
+
+	if (FlushTickerHandle.IsValid())
+	{
+		FTSTicker::GetCoreTicker().RemoveTicker(FlushTickerHandle);
+		FlushTickerHandle.Reset();
+	}
+
+	if (bSucceeded)
+	{
+		PendingLines.Empty();
+		PendingCount = 0;
+		IFileManager::Get().Delete(*FilePath, false, false, true);
+	}
+	else
+	{
+		Flush();
+		UE_LOG(LogTemp, Log, TEXT("Job journal kept for resuming: %s"), *FilePath);
+	}
+	bClosed = true;
+}
@@ -0,0 +1,388 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "AssetTranslationTags.h"
+#include "AssetTranslator.h"
+#include "BilingualText.h"
+#include "LanguageOneSettings.h"
+#include "LanguageOneCompatibility.h"
+#include "FrontendFilterBase.h"
+#include "ContentBrowserItem.h"
+#include "StructTextPlan.h"
+#include "Engine/DataTable.h"
+#include "Engine/Blueprint.h"
+#include "Blueprint/UserWidget.h"
+#include "Blueprint/WidgetTree.h"
+#include "Components/TextBlock.h"
+#include "Components/EditableText.h"
+#include "Components/EditableTextBox.h"
+#include "Components/RichTextBlock.h"
+#include "EdGraph/EdGraph.h"
+#include "K2Node_FunctionEntry.h"
+#include "Internationalization/StringTable.h"
+#include "Misc/Crc.h"
+#include "Containers/Ticker.h"
+#include "UObject/Package.h"
+#include "UObject/ObjectSaveContext.h"
+
+#define LOCTEXT_NAMESPACE "LanguageOneAssetTranslationTags"
+
+const FName FAssetTranslationTags::StatusTag(TEXT("LanguageOneStatus"));
+const FName FAssetTranslationTags::TranslatedUnitsTag(TEXT("LanguageOneTranslatedUnits"));
+const FName FAssetTranslationTags::TotalUnitsTag(TEXT("LanguageOneTextUnits"));
+const FName FAssetTranslationTags::TargetLanguageTag(TEXT("LanguageOneTargetLanguage"));
+const FName FAssetTranslationTags::SourceHashTag(TEXT("LanguageOneSourceHash"));
+
+FDelegateHandle FAssetTranslationTags::TagsDelegateHandle;
+FDelegateHandle FAssetTranslationTags::PreSaveDelegateHandle;
+FDelegateHandle FAssetTranslationTags::PackageSavedDelegateHandle;
+
+namespace LanguageOneAssetTags
+{
+	/** 保存前统计的状态，写入标签时读取（标签回调在很多地方被调用，不能每次都遍历文本）；包保存完成后移除 */
+	static TMap<TWeakObjectPtr<const UObject>, FAssetTranslationState> SavedStates;
+
+	/** 支持写入标签的资产类型 */
+	static bool IsTaggedClass(const UClass* Class)
+	{
+		return Class && (Class->IsChildOf<UStringTable>() || Class->IsChildOf<UDataTable>() || Class->IsChildOf<UBlueprint>());
+	}
+
+	static FString GetStatusString(const FAssetTranslationState& State)
+	{
+		if (State.TotalUnits == 0)
+		{
+			return TEXT("NoText");
+		}
+		if (State.IsFullyTranslated())
+		{
+			return TEXT("Translated");
+		}
+		return State.HasTranslation() ? TEXT("Partial") : TEXT("Untranslated");
+	}
+
+	/**
+	 * 按 FAssetTranslator::ExtractTextUnits 的收集范围和顺序遍历资产中的文本（只读取，不创建写回函数，不输出日志）
+	 * 保存任何资产时都会调用，必须足够轻量
+	 */
+	static void ForEachText(UObject* Asset, TFunctionRef<void(const FString& Text)> Visitor)
+	{
+		const FString ClassName = Asset->GetClass()->GetName();
+
+		if (UStringTable* StringTable = Cast<UStringTable>(Asset))
+		{
+			FStringTableConstRef StringTableData = StringTable->GetStringTable();
+			TArray<FString> Keys;
+			LanguageOneStringTableHelper::EnumerateStringTableKeys(StringTableData, Keys);
+			for (const FString& Key : Keys)
+			{
+				Visitor(LanguageOneStringTableHelper::FindStringTableEntry(StringTableData, Key));
+			}
+		}
+		else if (UDataTable* DataTable = Cast<UDataTable>(Asset))
+		{
+			const UScriptStruct* RowStruct = DataTable->GetRowStruct();
+			if (!RowStruct)
+			{
+				return;
+			}
+
+			TSharedRef<const FStructTextPlan> Plan = FStructTextPlan::Get(RowStruct);
+			for (const TPair<FName, uint8*>& RowPair : DataTable->GetRowMap())
+			{
+				Plan->ForEachField(RowPair.Value, true, [&Visitor](const FStructTextField& Field)
+				{
+					Visitor(Field.GetString());
+				});
+			}
+		}
+		else if (UBlueprint* Blueprint = Cast<UBlueprint>(Asset))
+		{
+			if (ClassName.Contains(TEXT("WidgetBlueprint")) || ClassName.Contains(TEXT("UserWidget")))
+			{
+				UUserWidget* DefaultWidget = Blueprint->GeneratedClass ? Cast<UUserWidget>(Blueprint->GeneratedClass->GetDefaultObject()) : nullptr;
+				if (!DefaultWidget || !DefaultWidget->WidgetTree)
+				{
+					return;
+				}
+
+				TArray<UWidget*> AllWidgets;
+				DefaultWidget->WidgetTree->GetAllWidgets(AllWidgets);
+				for (UWidget* Widget : AllWidgets)
+				{
+					if (UTextBlock* TextBlock = Cast<UTextBlock>(Widget))
+					{
+						Visitor(TextBlock->GetText().ToString());
+					}
+					else if (UEditableText* EditableText = Cast<UEditableText>(Widget))
+					{
+						Visitor(LanguageOneUMGHelper::GetEditableTextHintText(EditableText).ToString());
+					}
+					else if (UEditableTextBox* EditableTextBox = Cast<UEditableTextBox>(Widget))
+					{
+						Visitor(LanguageOneUMGHelper::GetEditableTextBoxHintText(EditableTextBox).ToString());
+					}
+					else if (URichTextBlock* RichTextBlock = Cast<URichTextBlock>(Widget))
+					{
+						Visitor(RichTextBlock->GetText().ToString());
+					}
+				}
+				return;
+			}
+
+			for (const FBPVariableDescription& Variable : Blueprint->NewVariables)
+			{
+				if (!Variable.VarName.IsNone())
+				{
+					Visitor(LanguageOneBlueprintHelper::GetVariableTooltip(Variable));
+					Visitor(Variable.Category.ToString());
+				}
+			}
+
+			TArray<UEdGraph*> AllGraphs;
+			Blueprint->GetAllGraphs(AllGraphs);
+			for (UEdGraph* Graph : AllGraphs)
+			{
+				if (!Graph)
+				{
+					continue;
+				}
+
+				for (UEdGraphNode* Node : Graph->Nodes)
+				{
+					if (!Node)
+					{
+						continue;
+					}
+
+					Visitor(Node->NodeComment);
+					if (UK2Node_FunctionEntry* FunctionEntry = Cast<UK2Node_FunctionEntry>(Node))
+					{
+						Visitor(FunctionEntry->GetTooltipText().ToString());
+					}
+				}
+			}
+		}
+	}
+
+	/** 保存前统计资产的翻译状态（烘焙和程序化保存不统计） */
+	static void OnObjectPreSave(UObject* Object, FObjectPreSaveContext SaveContext)
+	{
+		if (SaveContext.IsCooking() || SaveContext.IsProceduralSave())
+		{
+			return;
+		}
+
+		if (Object && Object->IsAsset() && IsTaggedClass(Object->GetClass()))
+		{
+			SavedStates.Add(Object, FAssetTranslationTags::ComputeState(Object));
+		}
+	}
+
+	/** 包保存完成：下一帧移除包内资产的状态（同一帧内保存后刷新注册表时仍会读取标签），同时清理已销毁的对象 */
+	static void OnPackageSaved(const FString& PackageFileName, UPackage* Package, FObjectPostSaveContext SaveContext)
+	{
+		if (SavedStates.Num() == 0)
+		{
+			return;
+		}
+
+		TWeakObjectPtr<UPackage> WeakPackage(Package);
+		FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateLambda([WeakPackage](float DeltaTime)
+		{
+			const UPackage* SavedPackage = WeakPackage.Get();
+			for (auto It = SavedStates.CreateIterator(); It; ++It)
+			{
+				const UObject* Object = It.Key().Get();
+				if (!Object || Object->GetPackage() == SavedPackage)
+				{
+					It.RemoveCurrent();
+				}
+			}
+			return false;
+		}));
+	}
+
+#if (ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION >= 4)
+	static void OnGetExtraObjectTags(FAssetRegistryTagsContext Context);
+#else
+	static void OnGetExtraObjectTags(const UObject* Object, TArray<UObject::FAssetRegistryTag>& OutTags);
+#endif
+
+	/** 按标签过滤资产的过滤器 */
+	class FTranslationStateFilter : public FFrontendFilter
+	{
+	public:
+		FTranslationStateFilter(TSharedPtr<FFrontendFilterCategory> InCategory, bool bInTranslated)
+			: FFrontendFilter(InCategory)
+			, bTranslated(bInTranslated)
+		{}
+
+		virtual FString GetName() const override
+		{
+			return bTranslated ? TEXT("LanguageOneTranslated") : TEXT("LanguageOneNeedsTranslation");
+		}
+
+		virtual FText GetDisplayText() const override
+		{
+			return bTranslated
+				? LOCTEXT("TranslatedFilter", "已翻译 | Translated")
+				: LOCTEXT("NeedsTranslationFilter", "未完成翻译 | Needs Translation");
+		}
+
+		virtual FText GetToolTipText() const override
+		{
+			return bTranslated
+				? LOCTEXT("TranslatedFilterTooltip", "所有文本都已翻译的资产（按上次保存时的状态，不加载资产） | Assets whose text is fully translated (as of their last save, without loading)")
+				: LOCTEXT("NeedsTranslationFilterTooltip", "还有未翻译文本的资产（按上次保存时的状态，不加载资产） | Assets with untranslated text (as of their last save, without loading)");
+		}
+
+		virtual bool PassesFilter(FAssetFilterType InItem) const override
+		{
+			FAssetData AssetData;
+			FAssetTranslationState State;
+			if (!InItem.Legacy_TryGetAssetData(AssetData) || !FAssetTranslationTags::TryGetState(AssetData, State))
+			{
+				return false;
+			}
+			return bTranslated ? State.IsFullyTranslated() : State.NeedsTranslation();
+		}
+
+	private:
+		bool bTranslated;
+	};
+}
+
+#if (ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION >= 4)
+void LanguageOneAssetTags::OnGetExtraObjectTags(FAssetRegistryTagsContext Context)
+{
+	TArray<UObject::FAssetRegistryTag> Tags;
+	FAssetTranslationTags::AppendTags(Context.GetObject(), Tags);
+	for (const UObject::FAssetRegistryTag& Tag : Tags)
+	{
+		Context.AddTag(Tag);
+	}
+}
+#else
+void LanguageOneAssetTags::OnGetExtraObjectTags(const UObject* Object, TArray<UObject::FAssetRegistryTag>& OutTags)
+{
+	FAssetTranslationTags::AppendTags(Object, OutTags);
+}
+#endif
+
+void FAssetTranslationTags::Initialize()
+{
+	PreSaveDelegateHandle = FCoreUObjectDelegates::OnObjectPreSave.AddStatic(&LanguageOneAssetTags::OnObjectPreSave);
+	PackageSavedDelegateHandle = UPackage::PackageSavedWithContextEvent.AddStatic(&LanguageOneAssetTags::OnPackageSaved);
+
+#if (ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION >= 4)
+	TagsDelegateHandle = UObject::FAssetRegistryTag::OnGetExtraObjectTagsWithContext.AddStatic(&LanguageOneAssetTags::OnGetExtraObjectTags);
+#else
+	TagsDelegateHandle = UObject::FAssetRegistryTag::OnGetExtraObjectTags.AddStatic(&LanguageOneAssetTags::OnGetExtraObjectTags);
+#endif
+}
+
+void FAssetTranslationTags::Shutdown()
+{
+	FCoreUObjectDelegates::OnObjectPreSave.Remove(PreSaveDelegateHandle);
+	UPackage::PackageSavedWithContextEvent.Remove(PackageSavedDelegateHandle);
+
+#if (ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION >= 4)
+	UObject::FAssetRegistryTag::OnGetExtraObjectTagsWithContext.Remove(TagsDelegateHandle);
+#else
+	UObject::FAssetRegistryTag::OnGetExtraObjectTags.Remove(TagsDelegateHandle);
+#endif
+
+	LanguageOneAssetTags::SavedStates.Empty();
+}
+
+void FAssetTranslationTags::AppendTags(const UObject* Object, TArray<UObject::FAssetRegistryTag>& OutTags)
+{
+	if (!Object || !LanguageOneAssetTags::IsTaggedClass(Object->GetClass()))
+	{
+		return;
+	}
+
+	// 类默认对象只声明标签，内容浏览器据此创建列
+	if (Object->HasAnyFlags(RF_ClassDefaultObject))
+	{
+		OutTags.Add(UObject::FAssetRegistryTag(StatusTag, FString(), UObject::FAssetRegistryTag::TT_Alphabetical));
+		OutTags.Add(UObject::FAssetRegistryTag(TranslatedUnitsTag, FString(), UObject::FAssetRegistryTag::TT_Numerical));
+		OutTags.Add(UObject::FAssetRegistryTag(TotalUnitsTag, FString(), UObject::FAssetRegistryTag::TT_Numerical));
+		OutTags.Add(UObject::FAssetRegistryTag(TargetLanguageTag, FString(), UObject::FAssetRegistryTag::TT_Alphabetical));
+		OutTags.Add(UObject::FAssetRegistryTag(SourceHashTag, FString(), UObject::FAssetRegistryTag::TT_Hidden));
+		return;
+	}
+
+	// 只写入保存前统计过的状态
+	const FAssetTranslationState* State = LanguageOneAssetTags::SavedStates.Find(Object);
+	if (!State)
+	{
+		return;
+	}
+
+	OutTags.Add(UObject::FAssetRegistryTag(StatusTag, LanguageOneAssetTags::GetStatusString(*State), UObject::FAssetRegistryTag::TT_Alphabetical));
+	OutTags.Add(UObject::FAssetRegistryTag(TranslatedUnitsTag, LexToString(State->TranslatedUnits), UObject::FAssetRegistryTag::TT_Numerical));
+	OutTags.Add(UObject::FAssetRegistryTag(TotalUnitsTag, LexToString(State->TotalUnits), UObject::FAssetRegistryTag::TT_Numerical));
+	OutTags.Add(UObject::FAssetRegistryTag(TargetLanguageTag, State->TargetLanguage, UObject::FAssetRegistryTag::TT_Alphabetical));
+	OutTags.Add(UObject::FAssetRegistryTag(SourceHashTag, State->SourceHash, UObject::FAssetRegistryTag::TT_Hidden));
+}
+
+bool FAssetTranslationTags::TryGetState(const FAssetData& AssetData, FAssetTranslationState& OutState)
+{
+	FString TranslatedUnits;
+	FString TotalUnits;
+	if (!AssetData.GetTagValue(TranslatedUnitsTag, TranslatedUnits) || !AssetData.GetTagValue(TotalUnitsTag, TotalUnits))
+	{
+		return false;
+	}
+
+	LexFromString(OutState.TranslatedUnits, *TranslatedUnits);
+	LexFromString(OutState.TotalUnits, *TotalUnits);
+	AssetData.GetTagValue(TargetLanguageTag, OutState.TargetLanguage);
+	AssetData.GetTagValue(SourceHashTag, OutState.SourceHash);
+	return true;
+}
+
+FAssetTranslationState FAssetTranslationTags::ComputeState(UObject* Asset)
+{
+	FAssetTranslationState State;
+	if (!Asset)
+	{
+		return State;
+	}
+
+	// 原文按收集顺序计算 CRC，原文增删改都会改变哈希
+	uint32 SourceCrc = 0;
+	LanguageOneAssetTags::ForEachText(Asset, [&State, &SourceCrc](const FString& Text)
+	{
+		const FBilingualTextView Bilingual = FBilingualText::Parse(Text);
+		if (Bilingual.Original.IsEmpty())
+		{
+			return;
+		}
+
+		State.TotalUnits++;
+		if (Bilingual.bHasTranslation)
+		{
+			State.TranslatedUnits++;
+		}
+		SourceCrc = FCrc::MemCrc32(Bilingual.Original.GetData(), Bilingual.Original.Len() * sizeof(TCHAR), SourceCrc);
+	});
+
+	const ULanguageOneSettings* Settings = GetDefault<ULanguageOneSettings>();
+	State.TargetLanguage = StaticEnum<ETranslateTargetLanguage>()->GetNameStringByValue((int64)Settings->TargetLanguage);
+	State.SourceHash = FString::Printf(TEXT("%08x"), SourceCrc);
+	return State;
+}
+
+void ULanguageOneFrontEndFilterExtension::AddFrontEndFilterExtensions(TSharedPtr<FFrontendFilterCategory> DefaultCategory, TArray<TSharedRef<FFrontendFilter>>& InOutFilterList) const
+{
+	TSharedPtr<FFrontendFilterCategory> Category = MakeShareable(new FFrontendFilterCategory(
+		LOCTEXT("FilterCategory", "LanguageOne"),
+		LOCTEXT("FilterCategoryTooltip", "按翻译状态过滤资产 | Filter assets by translation state")));
+
+	InOutFilterList.Add(MakeShareable(new LanguageOneAssetTags::FTranslationStateFilter(Category, true)));
+	InOutFilterList.Add(MakeShareable(new LanguageOneAssetTags::FTranslationStateFilter(Category, false)));
+}
+
+#undef LOCTEXT_NAMESPACE
@@ -2,6 +2,15 @@
 
 #include "AssetTranslator.h"
 #include "AssetTranslatorUI.h"
+#include "AssetTranslationJob.h"
+#include "AssetTranslationJournal.h"
+#include "AssetStreamLoader.h"
+#include "BilingualText.h"
+#include "StringTableWriteQueue.h"
+#include "StructTextPlan.h"
+#include "AssetTranslationTags.h"
+#include "TranslationRequestScheduler.h"
+#include "LanguageOneTrace.h"
 #include "LanguageOneSettings.h"
 #include "LanguageOneCompatibility.h"
 #include "CommentTranslator.h"
@@ -30,195 +39,24 @@
 #include "Kismet2/BlueprintEditorUtils.h"
 #include "Kismet2/KismetEditorUtilities.h"
 #include "FileHelpers.h" // 包含 UEditorLoadingAndSavingUtils
+#include "Engine/StreamableManager.h"
+#include "ProfilingDebugging/ScopedTimers.h"
 
-// 辅助函数：从已翻译文本中提取原文
-// 支持多种格式：
-// 1. 新格式（译文在下，默认）: "标记开始原文标记结束\n---\n译文"
-// 2. 新格式（译文在上）: "译文\n---\n标记开始原文标记结束"
-// 3. 旧格式: "Translated\n---\nOriginal"（兼容）
-static FString StripExistingTranslation(const FString& Text)
-{
-	if (Text.IsEmpty())
-	{
-		return Text;
-	}
-	
-	// 检查是否有零宽字符隐藏标记（新格式）
-	// U+200B = Zero Width Space (ZWSP)
-	// U+200C = Zero Width Non-Joiner (ZWNJ) - 标记原文开始
-	// U+200D = Zero Width Joiner (ZWJ) - 标记原文结束
-	const TCHAR HiddenStartMarker[] = { 0x200B, 0x200C, 0 }; // ZWSP + ZWNJ
-	const TCHAR HiddenEndMarker[] = { 0x200B, 0x200D, 0 };   // ZWSP + ZWJ
-	const FString HiddenStart(HiddenStartMarker);
-	const FString HiddenEnd(HiddenEndMarker);
-	
-	// 优先从隐藏标记中提取原文（隐藏标记中总是原文）
-	int32 StartPos = Text.Find(HiddenStart, ESearchCase::CaseSensitive);
-	
-	if (StartPos != INDEX_NONE && StartPos >= 0)
-	{
-		// 从开始标记之后查找结束标记
-		int32 SearchStartPos = StartPos + HiddenStart.Len();
-		int32 EndPos = Text.Find(HiddenEnd, ESearchCase::CaseSensitive, ESearchDir::FromStart, SearchStartPos);
-		
-		if (EndPos != INDEX_NONE && EndPos > StartPos)
-		{
-			// 提取隐藏的原文（在标记之间的内容）
-			// 重要：只提取标记之间的内容，不做额外清理
-			// 因为标记之间的内容就是用户的原文，可能本身就包含零宽字符
-			int32 OriginalStart = StartPos + HiddenStart.Len();
-			int32 OriginalLen = EndPos - OriginalStart;
-			
-			if (OriginalLen >= 0) // 允许空字符串
-			{
-				FString OriginalText = Text.Mid(OriginalStart, OriginalLen);
-				
-				UE_LOG(LogTemp, VeryVerbose, TEXT("StripExistingTranslation: Extracted from hidden markers: '%s'"), *OriginalText);
-				return OriginalText;
-			}
-		}
-	}
-	
-	// 检查是否有 --- 分隔符
-	const FString Separator = TEXT("\n---\n");
-	if (Text.Contains(Separator))
-	{
-		FString Left, Right;
-		if (Text.Split(Separator, &Left, &Right))
-		{
-			// 从左边或右边提取原文
-			// 需要判断哪边包含隐藏标记
-			bool bLeftHasMarker = Left.Contains(HiddenStart) && Left.Contains(HiddenEnd);
-			bool bRightHasMarker = Right.Contains(HiddenStart) && Right.Contains(HiddenEnd);
-			
-			FString OriginalText;
-			if (bLeftHasMarker)
-			{
-				// 左边有标记，说明原文在左边（格式：​‌原文​‍\n---\n译文）
-				int32 LeftStartPos = Left.Find(HiddenStart, ESearchCase::CaseSensitive);
-				int32 LeftEndPos = Left.Find(HiddenEnd, ESearchCase::CaseSensitive, ESearchDir::FromStart, LeftStartPos + HiddenStart.Len());
-				if (LeftStartPos != INDEX_NONE && LeftEndPos != INDEX_NONE)
-				{
-					int32 OrigStart = LeftStartPos + HiddenStart.Len();
-					OriginalText = Left.Mid(OrigStart, LeftEndPos - OrigStart);
-				}
-			}
-			else if (bRightHasMarker)
-			{
-				// 右边有标记，说明原文在右边（格式：译文\n---\n​‌原文​‍）
-				int32 RightStartPos = Right.Find(HiddenStart, ESearchCase::CaseSensitive);
-				int32 RightEndPos = Right.Find(HiddenEnd, ESearchCase::CaseSensitive, ESearchDir::FromStart, RightStartPos + HiddenStart.Len());
-				if (RightStartPos != INDEX_NONE && RightEndPos != INDEX_NONE)
-				{
-					int32 OrigStart = RightStartPos + HiddenStart.Len();
-					OriginalText = Right.Mid(OrigStart, RightEndPos - OrigStart);
-				}
-			}
-			else
-			{
-				// 没有标记，根据设置判断
-				const ULanguageOneSettings* Settings = GetDefault<ULanguageOneSettings>();
-				if (Settings->bTranslationAboveOriginal)
-				{
-					// 译文在上方：译文\n---\n原文
-					// 原文在右边
-					OriginalText = Right.TrimStartAndEnd();
-				}
-				else
-				{
-					// 译文在下方（默认）：原文\n---\n译文
-					// 原文在左边
-					OriginalText = Left.TrimStartAndEnd();
-				}
-			}
-			
-			if (!OriginalText.IsEmpty())
-			{
-				UE_LOG(LogTemp, VeryVerbose, TEXT("StripExistingTranslation: Extracted from separator: '%s'"), *OriginalText);
-				return OriginalText;
-			}
-		}
-	}
-	
-	// 如果没有找到任何翻译标记，返回原文本（不做任何修改）
-	// 重要：不清理零宽字符，因为用户原文可能本身就包含这些字符
-	UE_LOG(LogTemp, VeryVerbose, TEXT("StripExistingTranslation: No translation markers, returning original: '%s'"), *Text);
-	return Text;
-}
+// StringTable 条目元数据：保存原文（用于还原和清除操作）
+static const FName OriginalTextMetaDataId(TEXT("LanguageOne_OriginalText"));
 
-// 辅助函数：检查文本是否已经包含翻译
-// 注意：对于 StringTable，还需要检查元数据中是否有原文
-static bool HasTranslation(const FString& Text)
+// 辅助函数：资产第一次写回前为文本单元涉及的所有对象记录撤销快照
+static void RecordUnitsUndo(FAssetTranslationJob& Job, UObject* Asset, const TArray<FTranslationTextUnit>& Units, int32 FirstUnit = 0)
 {
-	if (Text.IsEmpty())
-	{
-		return false;
-	}
-	
-	// 检查是否有可见的分隔符
-	if (Text.Contains(TEXT("\n---\n")))
+	TArray<UObject*> Targets;
+	for (int32 UnitIndex = FirstUnit; UnitIndex < Units.Num(); UnitIndex++)
 	{
-		return true;
-	}
-	
-	// 检查是否有隐藏标记（使用零宽字符，用于非 StringTable 资产）
-	// U+200B = Zero Width Space (ZWSP)
-	// U+200C = Zero Width Non-Joiner (ZWNJ)
-	// U+200D = Zero Width Joiner (ZWJ)
-	const TCHAR HiddenStartMarker[] = { 0x200B, 0x200C, 0 }; // ZWSP + ZWNJ
-	const TCHAR HiddenEndMarker[] = { 0x200B, 0x200D, 0 };   // ZWSP + ZWJ
-	const FString HiddenStart(HiddenStartMarker);
-	const FString HiddenEnd(HiddenEndMarker);
-	
-	if (Text.Contains(HiddenStart) && Text.Contains(HiddenEnd))
-	{
-		// 验证标记的顺序是否正确
-		int32 StartPos = Text.Find(HiddenStart, ESearchCase::CaseSensitive);
-		if (StartPos != INDEX_NONE)
+		if (UObject* Target = Units[UnitIndex].Target.Get())
 		{
-			int32 EndPos = Text.Find(HiddenEnd, ESearchCase::CaseSensitive, ESearchDir::FromStart, StartPos);
-			if (EndPos != INDEX_NONE && EndPos > StartPos)
-			{
-				return true;
-			}
-		}
-	}
-	
-	return false;
-}
-
-// 辅助函数：安全地刷新 StringTable 编辑器
-// 注意：不传入 Key 参数，避免改变编辑器的选中项
-static void RefreshStringTableEditor(UStringTable* StringTable, const FString& Key = FString())
-{
-	if (!StringTable)
-	{
-		return;
-	}
-
-	// 触发 PostEditChange 通知
-	StringTable->PostEditChange();
-	
-	// 尝试使用 IStringTableEditor 接口刷新编辑器
-	if (FModuleManager::Get().IsModuleLoaded("StringTableEditor") && GEditor)
-	{
-		UAssetEditorSubsystem* AssetEditorSubsystem = GEditor->GetEditorSubsystem<UAssetEditorSubsystem>();
-		if (AssetEditorSubsystem)
-		{
-			IAssetEditorInstance* EditorInstance = AssetEditorSubsystem->FindEditorForAsset(StringTable, false);
-			if (EditorInstance)
-			{
-				// 尝试转换为 IStringTableEditor 接口
-				IStringTableEditor* StringTableEditor = static_cast<IStringTableEditor*>(EditorInstance);
-				if (StringTableEditor)
-				{
-					// 使用官方 API 刷新编辑器
-					// 传入空字符串可以刷新整个表格而不改变选中项
-					StringTableEditor->RefreshStringTableEditor(FString());
-				}
-			}
+			Targets.AddUnique(Target);
 		}
 	}
+	Job.RecordUndo(Asset, Targets);
 }
 
 void FAssetTranslator::TranslateSelectedAssets(const TArray<FAssetData>& SelectedAssets, bool bIsFromEditor)
@@ -278,155 +116,397 @@ void FAssetTranslator::TranslateSelectedAssets(const TArray<FAssetData>& Selecte
 	}
 }
 
-void FAssetTranslator::PerformTranslation(const TArray<FAssetData>& TranslatableAssets, bool bSilent)
+TSharedRef<FAssetTranslationJob> FAssetTranslator::PerformTranslation(const TArray<FAssetData>& TranslatableAssets, bool bSilent)
 {
-	// 设置处理状态
-	FAssetTranslatorUI::SetProcessing(true);
-	
-	const ULanguageOneSettings* Settings = GetDefault<ULanguageOneSettings>();
-
 	// 显示进度窗口 (如果不是静默模式或批量翻译)
 	TSharedPtr<STranslationProgressWindow> ProgressWidget;
 	if (!bSilent || TranslatableAssets.Num() > 1)
 	{
 		ProgressWidget = FAssetTranslatorUI::GetToolWindowProgress();
-		if (ProgressWidget.IsValid())
-		{
-			ProgressWidget->SetOperationName(TEXT("翻译"));
-		}
 	}
 	
+	// 创建任务：跟踪所有未完成的文本单元，全部完成（或取消）后才结束并恢复处理状态
+	TSharedRef<FAssetTranslationJob> Job = FAssetTranslationJob::Start(TEXT("翻译"), TEXT("translate"), TranslatableAssets.Num(), ProgressWidget);
+	
 	// 创建翻译状态追踪
+	// 流水线：资产加载完成后立即收集文本单元并去重 -> 攒满一批原文就发送 -> 结果写回每一处
+	// 加载、收集与网络请求并行进行
 	struct FTranslationState
 	{
-		int32 TotalAssets;
-		int32 CompletedAssets;
-		int32 SuccessAssets;
-		int32 FailedAssets;
-		TSharedPtr<STranslationProgressWindow> ProgressWidget;
-		bool bSilent;
+		/** 所有资产的文本单元 */
+		TArray<FTranslationTextUnit> Units;
+		
+		/** 去重后的原文，以及等待该原文结果的文本单元 */
+		TArray<FString> UniqueSources;
+		TArray<TArray<int32>> UnitsBySource;
+		TMap<FString, int32> SourceIndexMap;
+		
+		/** 原文的翻译结果：已完成的原文，之后收集到的相同文本直接写回 */
+		TArray<bool> SourceFinished;
+		TArray<TOptional<FString>> SourceTranslations;
+		
+		/** 尚未发送的原文 */
+		TArray<int32> PendingSources;
 		
-		FTranslationState(int32 Total, TSharedPtr<STranslationProgressWindow> Widget, bool InSilent)
-			: TotalAssets(Total), CompletedAssets(0), SuccessAssets(0), FailedAssets(0), ProgressWidget(Widget), bSilent(InSilent)
-		{}
+		/** 等待写回的资产的加载句柄，资产收尾后释放 */
+		TMap<TWeakObjectPtr<UObject>, TSharedPtr<FStreamableHandle>> ResidentHandles;
+		
+		/** 低内存批处理：已全部回调、等待写回完成的窗口 */
+		TWeakPtr<FAssetStreamLoader> DeliveredWindowLoader;
+		
+		/** 断点续传日志（编辑器内切换不记录） */
+		TSharedPtr<FAssetTranslationJournal> Journal;
+		
+		int32 ExtractedAssets = 0;
+		int32 ResumedSources = 0;
+		int32 BatchSize = 1;
+		
+		/** 窗口内的资产都已收尾时释放窗口（保存、卸载、垃圾回收后加载下一个窗口） */
+		void TryReleaseWindow()
+		{
+			if (ResidentHandles.Num() > 0)
+			{
+				return;
+			}
+			
+			if (TSharedPtr<FAssetStreamLoader> Loader = DeliveredWindowLoader.Pin())
+			{
+				DeliveredWindowLoader.Reset();
+				Loader->ReleaseWindowAndContinue();
+			}
+		}
 	};
 	
-	TSharedPtr<FTranslationState> State = MakeShared<FTranslationState>(TranslatableAssets.Num(), ProgressWidget, bSilent);
+	TSharedPtr<FTranslationState> State = MakeShared<FTranslationState>();
+	State->BatchSize = FMath::Max(1, FCommentTranslator::GetMaxBatchSize(GetDefault<ULanguageOneSettings>()->TranslateProvider));
+	State->Journal = bSilent ? nullptr : FAssetTranslationJournal::Open(TranslatableAssets);
 	
-	// 翻译每个资产
-	for (int32 i = 0; i < TranslatableAssets.Num(); i++)
+	// 任务结束时（全部完成或取消）汇报结果
+	Job->SetOnFinished([bSilent, Journal = State->Journal](const FAssetTranslationJobResult& Result)
 	{
-		const FAssetData& AssetData = TranslatableAssets[i];
+		// 全部成功时删除日志；取消或有失败时保留，下次翻译同一批资产时继续
+		if (Journal.IsValid())
+		{
+			Journal->Close(!Result.bCancelled && Result.FailedAssets == 0);
+		}
+		
+		const FTranslationBatchStats& FinalStats = Result.Stats;
+		UE_LOG(LogTemp, Log, TEXT("Batch translation finished: %d/%d text units applied, %d failed, %d requests for %d units (dedupe ratio %.1f%%)"),
+			FinalStats.AppliedUnits, FinalStats.TranslatableUnits, FinalStats.FailedUnits,
+			FinalStats.UniqueUnits, FinalStats.TranslatableUnits, FinalStats.GetDedupeRatio() * 100.0f);
 		
-		// 更新进度（先更新进度，确保即使失败也能看到进度变化）
-		if (State->ProgressWidget.IsValid())
+		// 静默模式下只在日志输出，不显示弹窗
+		if (bSilent)
+		{
+			UE_LOG(LogTemp, Log, TEXT("Asset translation completed silently: %d/%d success"), Result.SucceededAssets, Result.TotalAssets);
+		}
+		else if (Result.bCancelled)
+		{
+			FAssetTranslatorUI::ShowWarningNotification(FString::Printf(
+				TEXT("翻译已取消：完成 %d 个资产，%d 个未完成 | Translation cancelled: %d assets done, %d unfinished"),
+				Result.SucceededAssets + Result.FailedAssets, Result.CancelledAssets,
+				Result.SucceededAssets + Result.FailedAssets, Result.CancelledAssets));
+		}
+		else if (FinalStats.TranslatableUnits > 0)
+		{
+			FAssetTranslatorUI::ShowInfoNotification(FString::Printf(
+				TEXT("共 %d 处文本，去重后需翻译 %d 条（节省 %.0f%%），失败 %d 处 | %d text units, %d unique to translate (%.0f%% saved), %d failed"),
+				FinalStats.TranslatableUnits, FinalStats.UniqueUnits, FinalStats.GetDedupeRatio() * 100.0f, FinalStats.FailedUnits,
+				FinalStats.TranslatableUnits, FinalStats.UniqueUnits, FinalStats.GetDedupeRatio() * 100.0f, FinalStats.FailedUnits));
+		}
+	});
+	
+	// 写回一个文本单元；资产的所有单元完成后收尾并释放加载句柄
+	auto ApplyUnit = [State, Job](int32 UnitIndex, int32 SourceIndex)
+	{
+		FTranslationBatchStats& JobStats = Job->GetStats();
+		FScopedDurationTimer ApplyTimer(JobStats.ApplySeconds);
+		FTranslationTextUnit& Unit = State->Units[UnitIndex];
+		const TOptional<FString>& TranslatedText = State->SourceTranslations[SourceIndex];
+		if (TranslatedText.IsSet())
 		{
-			State->ProgressWidget->UpdateProgress(i + 1, AssetData.AssetName.ToString());
+			const FString& CleanSourceText = State->UniqueSources[SourceIndex];
+			Unit.Apply(FBilingualText::Format(TranslatedText.GetValue(), CleanSourceText), CleanSourceText);
+			JobStats.AppliedUnits++;
+			UE_LOG(LogTemp, VeryVerbose, TEXT("Translated text unit: %s"), *Unit.Location);
+		}
+		else
+		{
+			JobStats.FailedUnits++;
 		}
 		
-		// 检查资产是否可以被加载
-		UObject* Asset = AssetData.GetAsset();
-		if (!Asset)
+		Job->CompleteUnit(Unit.Asset, TranslatedText.IsSet(), [State](UObject* Asset)
 		{
-			UE_LOG(LogTemp, Warning, TEXT("Failed to load asset %d/%d: %s"), 
-				i + 1, TranslatableAssets.Num(), *AssetData.AssetName.ToString());
-			State->CompletedAssets++;
-			State->FailedAssets++;
-			if (State->ProgressWidget.IsValid())
+			FinalizeAsset(Asset);
+			if (State->Journal.IsValid())
 			{
-				State->ProgressWidget->IncrementFailed();
+				State->Journal->RecordAppliedAsset(Asset);
 			}
-			continue;
+			State->ResidentHandles.Remove(Asset);
+			State->TryReleaseWindow();
+		});
+		
+		// 写回后不再需要，释放闭包和文本（大批量时单元数量很多）
+		Unit.Apply = nullptr;
+		Unit.CurrentText.Empty();
+	};
+	
+	// 某个原文翻译完成后写回所有等待的引用处；任务被取消后到达的结果直接丢弃
+	auto OnSourceFinished = [State, Job, ApplyUnit](int32 SourceIndex, const FString* TranslatedText)
+	{
+		if (Job->IsFinished())
+		{
+			return;
 		}
 		
-		// 检查资产类型是否支持翻译
-		if (!CanTranslateAsset(AssetData))
+		LANGUAGEONE_TRACE_SCOPE("LanguageOne::ApplyResults");
+		
+		State->SourceFinished[SourceIndex] = true;
+		if (TranslatedText)
 		{
-			UE_LOG(LogTemp, Warning, TEXT("Unsupported asset type %d/%d: %s (Type: %s)"), 
-				i + 1, TranslatableAssets.Num(), *AssetData.AssetName.ToString(), 
-				*LanguageOneAssetDataHelper::GetAssetClassName(AssetData));
-			State->CompletedAssets++;
-			State->FailedAssets++;
-			if (State->ProgressWidget.IsValid())
+			State->SourceTranslations[SourceIndex] = *TranslatedText;
+			if (State->Journal.IsValid())
 			{
-				State->ProgressWidget->IncrementFailed();
+				State->Journal->RecordTranslation(State->UniqueSources[SourceIndex], *TranslatedText);
 			}
-			continue;
 		}
-
-		UE_LOG(LogTemp, Log, TEXT("Translating asset %d/%d: %s (Type: %s)"), 
-			i + 1, TranslatableAssets.Num(), *AssetData.AssetName.ToString(), 
-			*LanguageOneAssetDataHelper::GetAssetClassName(AssetData));
-
-		// 根据资产类型调用相应的翻译函数
-		FString ClassName = LanguageOneAssetDataHelper::GetAssetClassName(AssetData);
 		
-		if (ClassName.Contains(TEXT("StringTable")))
+		TArray<int32> WaitingUnits = MoveTemp(State->UnitsBySource[SourceIndex]);
+		for (int32 UnitIndex : WaitingUnits)
 		{
-			TranslateStringTable(Asset, State->bSilent);
+			ApplyUnit(UnitIndex, SourceIndex);
 		}
-		else if (ClassName.Contains(TEXT("DataTable")))
+	};
+	
+	// 发送尚未发送的原文（bOnlyFullBatches 为 true 时只发送攒满的批次）
+	// 按服务的批量上限分组，一个请求翻译多条原文；请求归入任务的请求组，取消任务时调度器会丢弃这些请求
+	auto SendPendingSources = [State, Job, OnSourceFinished](bool bOnlyFullBatches)
+	{
+		FTranslationRequestScheduler::FScopedRequestGroup RequestGroupScope(Job->GetRequestGroup());
+		
+		while (!Job->IsFinished() && State->PendingSources.Num() > 0 && (!bOnlyFullBatches || State->PendingSources.Num() >= State->BatchSize))
+		{
+			const int32 Count = FMath::Min(State->BatchSize, State->PendingSources.Num());
+			TArray<int32> BatchIndices(State->PendingSources.GetData(), Count);
+			State->PendingSources.RemoveAt(0, Count);
+			
+			TArray<FString> BatchSources;
+			BatchSources.Reserve(Count);
+			for (int32 SourceIndex : BatchIndices)
+			{
+				BatchSources.Add(State->UniqueSources[SourceIndex]);
+			}
+			
+			// Insights：记录这一批的文本单元，批次编号随请求一起记录
+			FLanguageOneTrace::FScopedBatch TraceBatchScope(FLanguageOneTrace::TraceUnitBatch(Job->GetRequestGroup(), BatchIndices));
+			
+			FCommentTranslator::TranslateTexts(
+				BatchSources,
+				FOnBatchTranslationComplete::CreateLambda([OnSourceFinished, BatchIndices](const TArray<FString>& Translations)
+				{
+					for (int32 i = 0; i < BatchIndices.Num(); i++)
+					{
+						const bool bTranslated = Translations.IsValidIndex(i) && !Translations[i].IsEmpty();
+						OnSourceFinished(BatchIndices[i], bTranslated ? &Translations[i] : nullptr);
+					}
+				}),
+				FOnTranslationError::CreateLambda([OnSourceFinished, BatchIndices](const FString& ErrorMessage)
+				{
+					// 任务取消后被丢弃的请求也以失败回调，不输出错误
+					FTranslationRequestScheduler& Scheduler = FTranslationRequestScheduler::Get();
+					if (!Scheduler.IsGroupCancelled(Scheduler.GetCurrentRequestGroup()))
+					{
+						UE_LOG(LogTemp, Error, TEXT("Failed to translate %d texts: %s"), BatchIndices.Num(), *ErrorMessage);
+					}
+					for (int32 SourceIndex : BatchIndices)
+					{
+						OnSourceFinished(SourceIndex, nullptr);
+					}
+				})
+			);
+		}
+	};
+	
+	// 资产加载完成：收集文本单元并去重，攒满一批就发送
+	auto OnAssetLoaded = [State, Job, bSilent, ApplyUnit, SendPendingSources](const FAssetData& AssetData, UObject* Asset, TSharedPtr<FStreamableHandle> Handle)
+	{
+		if (Job->IsFinished())
 		{
-			TranslateDataTable(Asset, State->bSilent);
+			return;
 		}
-		else if (ClassName.Contains(TEXT("WidgetBlueprint")) || ClassName.Contains(TEXT("UserWidget")))
+		
+		const FString AssetName = AssetData.AssetName.ToString();
+		
+		// 检查资产是否加载成功
+		if (!Asset)
 		{
-			TranslateWidgetBlueprint(Asset, State->bSilent);
+			UE_LOG(LogTemp, Warning, TEXT("Failed to load asset: %s"), *AssetName);
+			Job->CompleteAsset(AssetName, false);
+			return;
 		}
-		else if (ClassName.Contains(TEXT("Blueprint")))
+		
+		// 检查资产类型是否支持翻译
+		if (!CanTranslateAsset(AssetData))
 		{
-			TranslateBlueprint(Asset, State->bSilent);
+			UE_LOG(LogTemp, Warning, TEXT("Unsupported asset type: %s (Type: %s)"), 
+				*AssetName, *LanguageOneAssetDataHelper::GetAssetClassName(AssetData));
+			Job->CompleteAsset(AssetName, false);
+			return;
 		}
-		else
+		
+		const int32 FirstUnit = State->Units.Num();
+		ExtractTextUnits(Asset, AssetData, State->Units);
+		State->ExtractedAssets++;
+		
+		UE_LOG(LogTemp, Log, TEXT("Extracted %d text units from %s (Type: %s)"), 
+			State->Units.Num() - FirstUnit, *AssetName, *LanguageOneAssetDataHelper::GetAssetClassName(AssetData));
+		
+		// 写回之前记录撤销快照：每个资产一个事务，每个对象一次快照
+		if (State->Units.Num() > FirstUnit)
 		{
-			TranslateAssetMetadata(Asset, State->bSilent);
+			RecordUnitsUndo(*Job, Asset, State->Units, FirstUnit);
 		}
 		
-		// 标记为成功
-		State->SuccessAssets++;
-		State->CompletedAssets++;
-		if (State->ProgressWidget.IsValid())
+		// 去重：相同原文只翻译一次
+		LANGUAGEONE_TRACE_SCOPE("LanguageOne::ParseUnits");
+		FTranslationBatchStats& JobStats = Job->GetStats();
+		TArray<TPair<int32, int32>> AssetUnits;
+		for (int32 UnitIndex = FirstUnit; UnitIndex < State->Units.Num(); UnitIndex++)
 		{
-			State->ProgressWidget->IncrementSuccess();
+			FTranslationTextUnit& Unit = State->Units[UnitIndex];
+			
+			const FBilingualTextView Bilingual = FBilingualText::Parse(Unit.CurrentText);
+			
+			// 如果是在编辑器中触发（静默模式），且已经有翻译内容，则认为是执行“还原”操作
+			if (bSilent && Bilingual.bHasTranslation)
+			{
+				Unit.Apply(FString(Bilingual.Original), FString());
+				JobStats.RestoredUnits++;
+				continue;
+			}
+			
+			// 关键：提取纯原文（避免重复翻译造成内容叠加）
+			FString CleanSourceText(Bilingual.Original);
+			if (CleanSourceText.IsEmpty())
+			{
+				continue;
+			}
+			
+			int32* ExistingIndex = State->SourceIndexMap.Find(CleanSourceText);
+			int32 SourceIndex = ExistingIndex ? *ExistingIndex : INDEX_NONE;
+			if (SourceIndex == INDEX_NONE)
+			{
+				SourceIndex = State->UniqueSources.Add(CleanSourceText);
+				State->UnitsBySource.AddDefaulted();
+				
+				// 上次中断前已完成的译文直接使用，不再发送请求
+				const FString* ResumedTranslation = State->Journal.IsValid() ? State->Journal->FindTranslation(CleanSourceText) : nullptr;
+				if (ResumedTranslation)
+				{
+					State->SourceFinished.Add(true);
+					State->SourceTranslations.Add(*ResumedTranslation);
+					State->ResumedSources++;
+				}
+				else
+				{
+					State->SourceFinished.Add(false);
+					State->SourceTranslations.AddDefaulted();
+					State->PendingSources.Add(SourceIndex);
+					JobStats.UniqueUnits++;
+				}
+				State->SourceIndexMap.Add(MoveTemp(CleanSourceText), SourceIndex);
+			}
+			
+			AssetUnits.Emplace(UnitIndex, SourceIndex);
+			JobStats.TranslatableUnits++;
 		}
-	}
+		
+		// 没有需要翻译的单元（只有还原操作或没有文本）的资产直接收尾
+		if (AssetUnits.Num() == 0)
+		{
+			FinalizeAsset(Asset);
+			if (State->Journal.IsValid())
+			{
+				State->Journal->RecordAppliedAsset(Asset);
+			}
+			Job->CompleteAsset(AssetName, true);
+			return;
+		}
+		
+		// 先登记所有单元，再写回已有结果的单元，保证资产在所有单元完成后才收尾
+		// 资产等待写回期间持有加载句柄，避免被 GC 回收
+		State->ResidentHandles.Add(Asset, Handle);
+		Job->AddPendingUnits(Asset, AssetUnits.Num());
+		for (const TPair<int32, int32>& AssetUnit : AssetUnits)
+		{
+			if (State->SourceFinished[AssetUnit.Value])
+			{
+				ApplyUnit(AssetUnit.Key, AssetUnit.Value);
+			}
+			else
+			{
+				State->UnitsBySource[AssetUnit.Value].Add(AssetUnit.Key);
+			}
+		}
+		
+		SendPendingSources(true);
+	};
 	
-	// 标记完成
-	if (State->ProgressWidget.IsValid())
+	// 所有资产加载完成：发送剩余原文；之后所有单元完成时任务结束
+	auto OnAllLoaded = [State, Job, SendPendingSources]()
 	{
-		State->ProgressWidget->MarkComplete(State->SuccessAssets, State->FailedAssets);
-	}
+		if (Job->IsFinished())
+		{
+			return;
+		}
+		
+		SendPendingSources(false);
+		
+		const FTranslationBatchStats& JobStats = Job->GetStats();
+		UE_LOG(LogTemp, Log, TEXT("Gathered %d text units from %d assets: %d unique sources to translate, %d resumed from journal, %d restored (dedupe ratio %.1f%%)"),
+			JobStats.TranslatableUnits, State->ExtractedAssets, JobStats.UniqueUnits, State->ResumedSources, JobStats.RestoredUnits, JobStats.GetDedupeRatio() * 100.0f);
+		
+		Job->Seal();
+	};
 	
-	// 延迟关闭进度窗口
-	if (State->ProgressWidget.IsValid())
+	// 低内存批处理：窗口内的资产全部收集后发送剩余原文，写回完成后释放窗口
+	auto OnWindowDelivered = [State, Job, SendPendingSources](FAssetStreamLoader& Loader)
 	{
-		FTimerHandle TimerHandle;
-		GEditor->GetTimerManager()->SetTimer(TimerHandle, []()
+		if (Job->IsFinished())
 		{
-			FAssetTranslatorUI::CloseTranslationProgress();
-		}, 3.0f, false);
-	}
-
-	// 恢复处理状态 (修复：之前版本漏掉了这一行，导致翻译后状态卡死)
-	FAssetTranslatorUI::SetProcessing(false);
+			return;
+		}
+		
+		SendPendingSources(false);
+		State->DeliveredWindowLoader = Loader.AsShared();
+		State->TryReleaseWindow();
+	};
 	
-	// 静默模式下只在日志输出，不显示弹窗
-	if (bSilent)
+	// 上次中断前已写回并保存的资产直接计入成功，不再加载
+	TArray<FAssetData> AssetsToLoad;
+	TArray<FString> CompletedAssetNames;
+	for (const FAssetData& AssetData : TranslatableAssets)
 	{
-		UE_LOG(LogTemp, Log, TEXT("Asset translation completed silently: %d/%d success"), State->SuccessAssets, State->TotalAssets);
-		
-		// 特殊处理：对于无法实时刷新的资产（如 StringTable），给一个温和的提示
-		// 检查是否有 StringTable 被翻译成功
-		if (State->SuccessAssets > 0)
+		if (State->Journal.IsValid() && State->Journal->IsAssetCompleted(AssetData))
 		{
-			// 这里我们不能直接访问 TranslatableAssets，因为它是按值捕获的还是参数传递的需要确认上下文
-			// 简单起见，我们只能在日志里提示，或者使用一个很短的通知
-			// 但用户明确要求“蓝图是不会有的”，所以我们必须非常小心
-			// 只有 StringTable 才提示
-			// 由于这里无法轻易判断具体翻译了什么类型（State 里没存），我们只能尽量保持静默
-			// 如果必须提示，可以在上面的 TranslateStringTable 里加标记
+			CompletedAssetNames.Add(AssetData.AssetName.ToString());
+		}
+		else
+		{
+			AssetsToLoad.Add(AssetData);
 		}
 	}
+	if (CompletedAssetNames.Num() > 0)
+	{
+		UE_LOG(LogTemp, Log, TEXT("Skipping %d assets already applied and saved before the job was interrupted"), CompletedAssetNames.Num());
+		for (const FString& AssetName : CompletedAssetNames)
+		{
+			Job->CompleteAsset(AssetName, true);
+		}
+	}
+	
+	Job->SetAssetLoader(FAssetStreamLoader::Start(AssetsToLoad, OnAssetLoaded, OnAllLoaded, FAssetStreamWindow::FromSettings(OnWindowDelivered)));
+	return Job;
 }
 
 bool FAssetTranslator::CanTranslateAsset(const FAssetData& AssetData)
@@ -452,6 +532,13 @@ int32 FAssetTranslator::GetTranslatableTextCount(const FAssetData& AssetData)
 
 bool FAssetTranslator::HasAssetTranslation(const FAssetData& AssetData)
 {
+	// 未加载的资产优先读取保存时写入的标签，避免为了查询状态加载资产
+	FAssetTranslationState SavedState;
+	if (!AssetData.IsAssetLoaded() && FAssetTranslationTags::TryGetState(AssetData, SavedState))
+	{
+		return SavedState.HasTranslation();
+	}
+
 	// 重要：每次调用都重新获取资产，不使用缓存
 	UObject* Asset = AssetData.GetAsset();
 	if (!Asset)
@@ -478,7 +565,7 @@ bool FAssetTranslator::HasAssetTranslation(const FAssetData& AssetData)
 				
 				// 关键：只检查文本内容，不检查元数据
 				// 这样还原后（文本中没有翻译标记），就会被识别为未翻译
-				if (HasTranslation(Text))
+				if (FBilingualText::HasTranslation(Text))
 				{
 					UE_LOG(LogTemp, VeryVerbose, TEXT("HasAssetTranslation: %s key '%s' HAS translation (text contains markers)"), 
 						*AssetData.AssetName.ToString(), *Key);
@@ -501,35 +588,20 @@ bool FAssetTranslator::HasAssetTranslation(const FAssetData& AssetData)
 		UDataTable* DataTable = Cast<UDataTable>(Asset);
 		if (DataTable)
 		{
-			TArray<FName> RowNames = DataTable->GetRowNames();
-			const UScriptStruct* RowStruct = DataTable->GetRowStruct();
-			if (RowStruct)
+			// 按行结构体的提取计划检查所有文本字段（包括嵌套结构体和容器）
+			TSharedRef<const FStructTextPlan> Plan = FStructTextPlan::Get(DataTable->GetRowStruct());
+			if (!Plan->IsEmpty())
 			{
-				for (const FName& RowName : RowNames)
+				for (const TPair<FName, uint8*>& RowPair : DataTable->GetRowMap())
 				{
-					uint8* RowData = DataTable->FindRowUnchecked(RowName);
-					if (RowData)
+					bool bFound = false;
+					Plan->ForEachField(RowPair.Value, false, [&bFound](const FStructTextField& Field)
 					{
-						for (TFieldIterator<FProperty> It(const_cast<UScriptStruct*>(RowStruct)); It; ++It)
-						{
-							FProperty* Property = *It;
-							if (FTextProperty* TextProperty = CastField<FTextProperty>(Property))
-							{
-								FText* TextValue = TextProperty->ContainerPtrToValuePtr<FText>(RowData);
-								if (TextValue && HasTranslation(TextValue->ToString()))
-								{
-									return true;
-								}
-							}
-							else if (FStrProperty* StrProperty = CastField<FStrProperty>(Property))
-							{
-								FString* StrValue = StrProperty->ContainerPtrToValuePtr<FString>(RowData);
-								if (StrValue && HasTranslation(*StrValue))
-								{
-									return true;
-								}
-							}
-						}
+						bFound = bFound || FBilingualText::HasTranslation(Field.GetString());
+					});
+					if (bFound)
+					{
+						return true;
 					}
 				}
 			}
@@ -540,393 +612,143 @@ bool FAssetTranslator::HasAssetTranslation(const FAssetData& AssetData)
 	return false;
 }
 
-void FAssetTranslator::TranslateStringTable(UObject* Asset, bool bSilent)
+void FAssetTranslator::ExtractTextUnits(UObject* Asset, const FAssetData& AssetData, TArray<FTranslationTextUnit>& OutUnits)
 {
-	UStringTable* StringTable = Cast<UStringTable>(Asset);
-	if (!StringTable)
+	if (!Asset)
 	{
 		return;
 	}
 
-	UE_LOG(LogTemp, Log, TEXT("Translating StringTable: %s"), *StringTable->GetName());
+	LANGUAGEONE_TRACE_SCOPE("LanguageOne::ExtractTextUnits");
 
-	// 获取 String Table 的所有条目
-	FStringTableConstRef StringTableData = StringTable->GetStringTable();
+	// 根据资产类型调用相应的收集函数（收集范围变化时同步修改 AssetTranslationTags.cpp 中保存时的统计）
+	FString ClassName = LanguageOneAssetDataHelper::GetAssetClassName(AssetData);
 	
-	TArray<FString> Keys;
-	LanguageOneStringTableHelper::EnumerateStringTableKeys(StringTableData, Keys);
-
-	if (Keys.Num() == 0)
+	if (ClassName.Contains(TEXT("StringTable")))
 	{
-		UE_LOG(LogTemp, Warning, TEXT("StringTable is empty: %s"), *StringTable->GetName());
-		return;
+		ExtractStringTableUnits(Cast<UStringTable>(Asset), OutUnits);
 	}
-
-	// 如果是在编辑器中触发（静默模式），尝试获取选中的条目
-	TArray<FString> SelectedKeys = Keys; // 默认翻译全部
-	if (bSilent && GEditor)
+	else if (ClassName.Contains(TEXT("DataTable")))
 	{
-		// 尝试从 StringTable 编辑器获取选中的条目
-		// 注意：IStringTableEditor 接口可能不存在于所有版本，这里只做基本检查
-		UAssetEditorSubsystem* AssetEditorSubsystem = GEditor->GetEditorSubsystem<UAssetEditorSubsystem>();
-		if (AssetEditorSubsystem)
-		{
-			IAssetEditorInstance* EditorInstance = AssetEditorSubsystem->FindEditorForAsset(StringTable, false);
-			if (EditorInstance)
-			{
-				// 注意：IStringTableEditor 可能没有直接获取选中项的方法
-				// 目前先翻译全部，后续可以根据需要扩展
-				// 如果用户选中了特定条目，可以通过其他方式获取
-				UE_LOG(LogTemp, Log, TEXT("StringTable editor found, translating all entries"));
-			}
-		}
+		ExtractDataTableUnits(Cast<UDataTable>(Asset), OutUnits);
 	}
-
-	// 调用翻译条目的函数
-	TranslateStringTableEntries(Asset, SelectedKeys, bSilent);
+	else if (ClassName.Contains(TEXT("WidgetBlueprint")) || ClassName.Contains(TEXT("UserWidget")))
+	{
+		ExtractWidgetBlueprintUnits(Cast<UBlueprint>(Asset), OutUnits);
+	}
+	else if (ClassName.Contains(TEXT("Blueprint")))
+	{
+		ExtractBlueprintUnits(Cast<UBlueprint>(Asset), OutUnits);
+	}
+	// 其他资产（材质、贴图等）的描述信息目前无法写回，不发送翻译请求
 }
 
-void FAssetTranslator::TranslateStringTableEntries(UObject* Asset, const TArray<FString>& SelectedKeys, bool bSilent)
+void FAssetTranslator::ExtractStringTableUnits(UStringTable* StringTable, TArray<FTranslationTextUnit>& OutUnits)
 {
-	UStringTable* StringTable = Cast<UStringTable>(Asset);
-	if (!StringTable || SelectedKeys.Num() == 0)
+	if (!StringTable)
 	{
 		return;
 	}
 
-	UE_LOG(LogTemp, Log, TEXT("Translating %d entries in StringTable: %s"), SelectedKeys.Num(), *StringTable->GetName());
-
-	// 获取 StringTable 数据
+	// 获取 String Table 的所有条目
 	FStringTableConstRef StringTableData = StringTable->GetStringTable();
+	
+	TArray<FString> Keys;
+	LanguageOneStringTableHelper::EnumerateStringTableKeys(StringTableData, Keys);
 
-	// 创建翻译状态追踪
-	struct FStringTableTranslationState
+	if (Keys.Num() == 0)
 	{
-		UStringTable* StringTable;
-		int32 TotalCount;
-		int32 CompletedCount;
-		int32 SuccessCount;
-		TMap<FString, FString> OriginalTexts;
-		bool bSilent;
-		
-		FStringTableTranslationState(UStringTable* InTable, int32 Total, bool InSilent)
-			: StringTable(InTable), TotalCount(Total), CompletedCount(0), SuccessCount(0), bSilent(InSilent)
-		{}
-	};
-	
-	TSharedPtr<FStringTableTranslationState> State = MakeShared<FStringTableTranslationState>(StringTable, SelectedKeys.Num(), bSilent);
+		UE_LOG(LogTemp, Warning, TEXT("StringTable is empty: %s"), *StringTable->GetName());
+		return;
+	}
 
-	for (const FString& Key : SelectedKeys)
+	TWeakObjectPtr<UStringTable> WeakStringTable(StringTable);
+	for (const FString& Key : Keys)
 	{
 		// 查找源文本（使用兼容性辅助函数）
 		FString SourceText = LanguageOneStringTableHelper::FindStringTableEntry(StringTableData, Key);
 		if (SourceText.IsEmpty())
 		{
-			State->CompletedCount++;
 			continue;
 		}
 
-		// 关键：提取纯原文（避免重复翻译造成内容叠加）
-		// 无论当前文本是否已包含译文，都提取纯原文
-		FString CleanSourceText = StripExistingTranslation(SourceText);
-		
-		// 保存纯原文，用于后续的元数据存储
-		State->OriginalTexts.Add(Key, CleanSourceText);
-
-		// 如果是在编辑器中触发（静默模式），且已经有翻译内容，则认为是执行“还原”操作
-		// 还原逻辑：直接将提取出的原文设置回去
-		if (State->bSilent && HasTranslation(SourceText))
+		FTranslationTextUnit& Unit = OutUnits.AddDefaulted_GetRef();
+		Unit.Asset = StringTable;
+		Unit.CurrentText = MoveTemp(SourceText);
+		Unit.Location = Key;
+		Unit.Apply = [WeakStringTable, Key](const FString& NewText, const FString& OriginalText)
 		{
-			// 重新提取原文（确保正确处理隐藏标记）
-			FString RestoredText = StripExistingTranslation(SourceText);
-			
-			// 修改 String Table（使用兼容性辅助函数）
-			State->StringTable->Modify();
-			LanguageOneStringTableHelper::SetStringTableEntry(State->StringTable, Key, RestoredText);
-			
-			// 清除元数据中的原文（重要！确保还原后 HasAssetTranslation 返回 false）
-			static const FName OriginalTextMetaDataId = TEXT("LanguageOne_OriginalText");
-			LanguageOneStringTableHelper::SetStringTableEntryMetaData(State->StringTable, Key, OriginalTextMetaDataId, FString());
-			
-			// 刷新 StringTable - 保持实时刷新功能不变！
-			RefreshStringTableEditor(State->StringTable);
-			
-			State->CompletedCount++;
-			State->SuccessCount++;
-			
-			UE_LOG(LogTemp, VeryVerbose, TEXT("Restored StringTable entry %d/%d: %s"), 
-				State->CompletedCount, State->TotalCount, *Key);
-			continue;
-		}
-
-		// 翻译文本
-		FCommentTranslator::TranslateText(
-			CleanSourceText,
-			FOnTranslationComplete::CreateLambda([State, Key](const FString& TranslatedText)
-			{
-				if (!State->StringTable)
-				{
-					return;
-				}
-				
-				FString OriginalText = State->OriginalTexts.FindRef(Key);
-				FString NewText;
-				static const FName OriginalTextMetaDataId = TEXT("LanguageOne_OriginalText");
-				
-				const ULanguageOneSettings* Settings = GetDefault<ULanguageOneSettings>();
-				
-				// 使用双语格式：根据设置决定译文和原文的位置
-				// 格式：译文\n[原文]隐藏标记原文隐藏标记 或 原文\n[译文]隐藏标记原文隐藏标记
-				// U+200B = Zero Width Space (ZWSP)
-				// U+200C = Zero Width Non-Joiner (ZWNJ) - 开始标记
-				// U+200D = Zero Width Joiner (ZWJ) - 结束标记
-				const TCHAR HiddenStartMarker[] = { 0x200B, 0x200C, 0 }; // ZWSP + ZWNJ
-				const TCHAR HiddenEndMarker[] = { 0x200B, 0x200D, 0 };   // ZWSP + ZWJ
-				const FString HiddenStart(HiddenStartMarker);
-				const FString HiddenEnd(HiddenEndMarker);
-				
-				if (Settings->bTranslationAboveOriginal)
-				{
-					// 译文在上方：译文\n---\n标记开始原文标记结束
-					// 显示为：译文\n---\n原文（标记不可见，---作为明显分隔）
-					NewText = FString::Printf(TEXT("%s\n---\n%s%s%s"), *TranslatedText, *HiddenStart, *OriginalText, *HiddenEnd);
-				}
-				else
-				{
-					// 译文在下方（默认）：标记开始原文标记结束\n---\n译文
-					// 显示为：原文\n---\n译文（标记不可见，---作为明显分隔）
-					NewText = FString::Printf(TEXT("%s%s%s\n---\n%s"), *HiddenStart, *OriginalText, *HiddenEnd, *TranslatedText);
-				}
-				
-				// 同时将原文保存到元数据中（用于还原和清除操作）
-				LanguageOneStringTableHelper::SetStringTableEntryMetaData(State->StringTable, Key, OriginalTextMetaDataId, OriginalText);
-
-			// 修改 String Table（使用兼容性辅助函数）
-			State->StringTable->Modify();
-			LanguageOneStringTableHelper::SetStringTableEntry(State->StringTable, Key, NewText);
-			
-			// 刷新 StringTable - 使用安全的刷新方法（不传 Key，避免改变选中项）
-			RefreshStringTableEditor(State->StringTable);
-				
-				State->CompletedCount++;
-				State->SuccessCount++;
-				
-				UE_LOG(LogTemp, Log, TEXT("Translated StringTable entry %d/%d: %s"), 
-					State->CompletedCount, State->TotalCount, *Key);
-				
-				// 如果是最后一个条目，只在日志输出，不显示弹窗
-				if (State->CompletedCount >= State->TotalCount)
-				{
-					UE_LOG(LogTemp, Log, TEXT("StringTable translation completed: %d/%d success"), State->SuccessCount, State->TotalCount);
-				}
-			}),
-			FOnTranslationError::CreateLambda([State, Key](const FString& ErrorMessage)
-			{
-				State->CompletedCount++;
-				UE_LOG(LogTemp, Error, TEXT("Failed to translate StringTable entry '%s': %s"), *Key, *ErrorMessage);
-				
-				// 如果是最后一个条目，只在日志输出，不显示弹窗
-				if (State->CompletedCount >= State->TotalCount)
-				{
-					UE_LOG(LogTemp, Log, TEXT("StringTable translation completed with errors: %d/%d success"), State->SuccessCount, State->TotalCount);
-				}
-			})
-		);
+			// 写入缓冲，每帧合并写入一次（大表逐条写入会反复 PostEditChange 和刷新编辑器）
+			// 原文同时保存到元数据中（用于还原和清除操作）；还原时清空，确保 HasAssetTranslation 返回 false
+			FStringTableWriteQueue::Get().Enqueue(WeakStringTable.Get(), Key, NewText, OriginalTextMetaDataId, OriginalText);
+		};
 	}
 }
 
-void FAssetTranslator::TranslateDataTable(UObject* Asset, bool bSilent)
+void FAssetTranslator::ExtractDataTableUnits(UDataTable* DataTable, TArray<FTranslationTextUnit>& OutUnits)
 {
-	UDataTable* DataTable = Cast<UDataTable>(Asset);
 	if (!DataTable)
 	{
 		return;
 	}
 
-	UE_LOG(LogTemp, Log, TEXT("Translating DataTable: %s"), *DataTable->GetName());
-
-	// 获取所有行
-	TArray<FName> RowNames = DataTable->GetRowNames();
-	
-	if (RowNames.Num() == 0)
+	const UScriptStruct* RowStruct = DataTable->GetRowStruct();
+	if (!RowStruct || DataTable->GetRowMap().Num() == 0)
 	{
 		UE_LOG(LogTemp, Warning, TEXT("DataTable is empty: %s"), *DataTable->GetName());
 		return;
 	}
 
-	int32 TranslatedFieldCount = 0;
-
-	// 遍历每一行
-	for (const FName& RowName : RowNames)
+	// 行结构体的提取计划只构建一次（包含嵌套结构体、TArray、TMap 中的文本字段），之后每行按偏移直接读取
+	TSharedRef<const FStructTextPlan> Plan = FStructTextPlan::Get(RowStruct);
+	if (Plan->IsEmpty())
 	{
-		uint8* RowData = DataTable->FindRowUnchecked(RowName);
-		if (!RowData)
-		{
-			continue;
-		}
+		return;
+	}
 
-		// 遍历结构体的所有属性
-		const UScriptStruct* RowStruct = DataTable->GetRowStruct();
-		if (!RowStruct)
-		{
-			continue;
-		}
+	TWeakObjectPtr<UDataTable> WeakDataTable(DataTable);
 
-		for (TFieldIterator<FProperty> It(const_cast<UScriptStruct*>(RowStruct)); It; ++It)
+	// 遍历每一行
+	for (const TPair<FName, uint8*>& RowPair : DataTable->GetRowMap())
+	{
+		const FName RowName = RowPair.Key;
+		Plan->ForEachField(RowPair.Value, true, [&](const FStructTextField& Field)
 		{
-			FProperty* Property = *It;
-			
-			// 检查是否是文本属性
-			if (FTextProperty* TextProperty = CastField<FTextProperty>(Property))
+			const FString& CurrentText = Field.GetString();
+			if (CurrentText.IsEmpty())
 			{
-				FText* TextValue = TextProperty->ContainerPtrToValuePtr<FText>(RowData);
-				if (TextValue && !TextValue->IsEmpty())
-				{
-					FString SourceText = TextValue->ToString();
-
-					// 提取原文（避免重复翻译）
-					FString CleanSourceText = StripExistingTranslation(SourceText);
-					
-					// 如果是在编辑器中触发（静默模式），且已经有翻译内容，则认为是执行“还原”操作
-					if (bSilent && HasTranslation(SourceText))
-					{
-						// 还原
-						DataTable->Modify();
-						*TextValue = FText::FromString(CleanSourceText);
-						TranslatedFieldCount++;
-						UE_LOG(LogTemp, Log, TEXT("Restored DataTable field: %s.%s"), *RowName.ToString(), *TextProperty->GetName());
-						continue;
-					}
-
-					// 翻译文本
-					FCommentTranslator::TranslateText(
-						CleanSourceText,
-						FOnTranslationComplete::CreateLambda([DataTable, RowName, TextProperty, RowData, CleanSourceText, &TranslatedFieldCount](const FString& TranslatedText)
-						{
-							const ULanguageOneSettings* Settings = GetDefault<ULanguageOneSettings>();
-							const TCHAR HiddenStartMarker[] = { 0x200B, 0x200C, 0 }; // ZWSP + ZWNJ
-							const TCHAR HiddenEndMarker[] = { 0x200B, 0x200D, 0 };   // ZWSP + ZWJ
-							const FString HiddenStart(HiddenStartMarker);
-							const FString HiddenEnd(HiddenEndMarker);
-							
-							FString NewText;
-							if (Settings->bTranslationAboveOriginal)
-							{
-								// 译文在上方：译文\n---\n标记开始原文标记结束
-								NewText = FString::Printf(TEXT("%s\n---\n%s%s%s"), *TranslatedText, *HiddenStart, *CleanSourceText, *HiddenEnd);
-							}
-							else
-							{
-								// 译文在下方（默认）：标记开始原文标记结束\n---\n译文
-								NewText = FString::Printf(TEXT("%s%s%s\n---\n%s"), *HiddenStart, *CleanSourceText, *HiddenEnd, *TranslatedText);
-							}
-
-							// 修改 DataTable
-							DataTable->Modify();
-							FText* TextValue = TextProperty->ContainerPtrToValuePtr<FText>(RowData);
-							*TextValue = FText::FromString(NewText);
-							
-							TranslatedFieldCount++;
-							UE_LOG(LogTemp, Log, TEXT("Translated DataTable field: %s.%s"), *RowName.ToString(), *TextProperty->GetName());
-						}),
-						FOnTranslationError::CreateLambda([RowName](const FString& ErrorMessage)
-						{
-							UE_LOG(LogTemp, Error, TEXT("Failed to translate DataTable row %s: %s"), *RowName.ToString(), *ErrorMessage);
-						})
-					);
-				}
+				return;
 			}
-			else if (FStrProperty* StrProperty = CastField<FStrProperty>(Property))
+
+			FTranslationTextUnit& Unit = OutUnits.AddDefaulted_GetRef();
+			Unit.Asset = DataTable;
+			Unit.CurrentText = CurrentText;
+			Unit.Location = FString::Printf(TEXT("%s.%s"), *RowName.ToString(), *Plan->DescribePath(Field.Steps));
+			Unit.Apply = [WeakDataTable, RowName, Plan, Steps = TArray<int32>(Field.Steps)](const FString& NewText, const FString& OriginalText)
 			{
-				// 如果属性名包含 "text", "desc", "content" 等关键字，也尝试翻译
-				FString PropertyName = Property->GetName().ToLower();
-				if (PropertyName.Contains(TEXT("text")) || 
-					PropertyName.Contains(TEXT("desc")) || 
-					PropertyName.Contains(TEXT("content")) ||
-					PropertyName.Contains(TEXT("comment")) ||
-					PropertyName.Contains(TEXT("tooltip")))
+				// 写回时重新查找行并重新定位字段，避免行数据或容器在翻译期间被重新分配
+				UDataTable* Table = WeakDataTable.Get();
+				uint8* Row = Table ? Table->FindRowUnchecked(RowName) : nullptr;
+				FStructTextField Target;
+				if (!Row || !Plan->Resolve(Row, Steps, Target))
 				{
-					FString* StrValue = StrProperty->ContainerPtrToValuePtr<FString>(RowData);
-					if (StrValue && !StrValue->IsEmpty())
-					{
-						FString SourceText = *StrValue;
-
-						// 提取原文（避免重复翻译）
-						FString CleanSourceText = StripExistingTranslation(SourceText);
-						
-						// 如果是在编辑器中触发（静默模式），且已经有翻译内容，则认为是执行“还原”操作
-						if (bSilent && HasTranslation(SourceText))
-						{
-							// 还原
-							DataTable->Modify();
-							*StrValue = CleanSourceText;
-							TranslatedFieldCount++;
-							UE_LOG(LogTemp, Log, TEXT("Restored DataTable string field: %s.%s"), *RowName.ToString(), *StrProperty->GetName());
-							continue;
-						}
-
-						// 翻译文本
-							FCommentTranslator::TranslateText(
-								CleanSourceText,
-								FOnTranslationComplete::CreateLambda([DataTable, RowName, StrProperty, RowData, CleanSourceText, &TranslatedFieldCount](const FString& TranslatedText)
-								{
-									const ULanguageOneSettings* Settings = GetDefault<ULanguageOneSettings>();
-									const TCHAR HiddenStartMarker[] = { 0x200B, 0x200C, 0 }; // ZWSP + ZWNJ
-									const TCHAR HiddenEndMarker[] = { 0x200B, 0x200D, 0 };   // ZWSP + ZWJ
-									const FString HiddenStart(HiddenStartMarker);
-									const FString HiddenEnd(HiddenEndMarker);
-									
-									FString NewText;
-									if (Settings->bTranslationAboveOriginal)
-									{
-										// 译文在上方：译文\n---\n标记开始原文标记结束
-										NewText = FString::Printf(TEXT("%s\n---\n%s%s%s"), *TranslatedText, *HiddenStart, *CleanSourceText, *HiddenEnd);
-									}
-									else
-									{
-										// 译文在下方（默认）：标记开始原文标记结束\n---\n译文
-										NewText = FString::Printf(TEXT("%s%s%s\n---\n%s"), *HiddenStart, *CleanSourceText, *HiddenEnd, *TranslatedText);
-									}
-
-								// 修改 DataTable
-								DataTable->Modify();
-								FString* StrValue = StrProperty->ContainerPtrToValuePtr<FString>(RowData);
-								*StrValue = NewText;
-								
-								TranslatedFieldCount++;
-								UE_LOG(LogTemp, Log, TEXT("Translated DataTable string field: %s.%s"), *RowName.ToString(), *StrProperty->GetName());
-							}),
-							FOnTranslationError::CreateLambda([RowName](const FString& ErrorMessage)
-							{
-								UE_LOG(LogTemp, Error, TEXT("Failed to translate DataTable row %s: %s"), *RowName.ToString(), *ErrorMessage);
-							})
-						);
-					}
+					return;
 				}
-			}
-		}
-	}
 
-	if (TranslatedFieldCount > 0)
-	{
-		UE_LOG(LogTemp, Log, TEXT("DataTable translation complete: %s (%d fields translated)"), *DataTable->GetName(), TranslatedFieldCount);
-	}
-	else
-	{
-		UE_LOG(LogTemp, Warning, TEXT("No translatable text fields found in DataTable: %s"), *DataTable->GetName());
+				// 修改 DataTable（撤销快照由任务在写回前记录）
+				Target.SetString(NewText);
+			};
+		});
 	}
 }
 
-void FAssetTranslator::TranslateWidgetBlueprint(UObject* Asset, bool bSilent)
+void FAssetTranslator::ExtractWidgetBlueprintUnits(UBlueprint* Blueprint, TArray<FTranslationTextUnit>& OutUnits)
 {
-	UBlueprint* Blueprint = Cast<UBlueprint>(Asset);
-	if (!Blueprint)
+	if (!Blueprint || !Blueprint->GeneratedClass)
 	{
 		return;
 	}
 
-	UE_LOG(LogTemp, Log, TEXT("Translating Widget Blueprint: %s"), *Blueprint->GetName());
-
 	// 获取 Widget Tree
 	UUserWidget* DefaultWidget = Cast<UUserWidget>(Blueprint->GeneratedClass->GetDefaultObject());
 	if (!DefaultWidget || !DefaultWidget->WidgetTree)
@@ -935,11 +757,27 @@ void FAssetTranslator::TranslateWidgetBlueprint(UObject* Asset, bool bSilent)
 		return;
 	}
 
-	UWidgetTree* WidgetTree = DefaultWidget->WidgetTree;
 	TArray<UWidget*> AllWidgets;
-	WidgetTree->GetAllWidgets(AllWidgets);
+	DefaultWidget->WidgetTree->GetAllWidgets(AllWidgets);
+
+	// 添加一个控件文本单元
+	auto AddWidgetUnit = [Blueprint, &OutUnits](UWidget* Widget, const FText& Text, TFunction<void(const FString&)> Setter)
+	{
+		if (Text.IsEmpty())
+		{
+			return;
+		}
 
-	int32 TranslatedWidgetCount = 0;
+		FTranslationTextUnit& Unit = OutUnits.AddDefaulted_GetRef();
+		Unit.Asset = Blueprint;
+		Unit.CurrentText = Text.ToString();
+		Unit.Location = Widget->GetName();
+		Unit.Target = Widget;
+		Unit.Apply = [Setter](const FString& NewText, const FString& OriginalText)
+		{
+			Setter(NewText);
+		};
+	};
 
 	for (UWidget* Widget : AllWidgets)
 	{
@@ -948,187 +786,112 @@ void FAssetTranslator::TranslateWidgetBlueprint(UObject* Asset, bool bSilent)
 			continue;
 		}
 
+		TWeakObjectPtr<UWidget> WeakWidget(Widget);
+
 		// Text Block
 		if (UTextBlock* TextBlock = Cast<UTextBlock>(Widget))
 		{
-			FText SourceText = TextBlock->GetText();
-			if (!SourceText.IsEmpty())
+			AddWidgetUnit(Widget, TextBlock->GetText(), [WeakWidget](const FString& NewText)
 			{
-				// 如果是在编辑器中触发（静默模式），且已经有翻译内容，则认为是执行“还原”操作
-				if (bSilent && HasTranslation(SourceText.ToString()))
+				if (UTextBlock* Target = Cast<UTextBlock>(WeakWidget.Get()))
 				{
-					FString CleanText = StripExistingTranslation(SourceText.ToString());
-					TextBlock->SetText(FText::FromString(CleanText));
-					TranslatedWidgetCount++;
-					continue;
+					Target->SetText(FText::FromString(NewText));
 				}
-
-				TranslateSingleText(
-					SourceText.ToString(),
-					[TextBlock, &TranslatedWidgetCount](const FString& TranslatedText)
-					{
-						TextBlock->SetText(FText::FromString(TranslatedText));
-						TranslatedWidgetCount++;
-						UE_LOG(LogTemp, Log, TEXT("Translated TextBlock: %s"), *TextBlock->GetName());
-					},
-					[]()
-					{
-						UE_LOG(LogTemp, Warning, TEXT("Failed to translate TextBlock"));
-					}
-				);
-			}
+			});
 		}
 		// Editable Text
 		else if (UEditableText* EditableText = Cast<UEditableText>(Widget))
 		{
-			FText HintText = LanguageOneUMGHelper::GetEditableTextHintText(EditableText);
-			if (!HintText.IsEmpty())
+			AddWidgetUnit(Widget, LanguageOneUMGHelper::GetEditableTextHintText(EditableText), [WeakWidget](const FString& NewText)
 			{
-				if (bSilent && HasTranslation(HintText.ToString()))
+				if (UEditableText* Target = Cast<UEditableText>(WeakWidget.Get()))
 				{
-					FString CleanText = StripExistingTranslation(HintText.ToString());
-					EditableText->SetHintText(FText::FromString(CleanText));
-					TranslatedWidgetCount++;
-					continue;
+					Target->SetHintText(FText::FromString(NewText));
 				}
-
-				TranslateSingleText(
-					HintText.ToString(),
-					[EditableText, &TranslatedWidgetCount](const FString& TranslatedText)
-					{
-						EditableText->SetHintText(FText::FromString(TranslatedText));
-						TranslatedWidgetCount++;
-					},
-					[]() {}
-				);
-			}
+			});
 		}
 		// Editable Text Box
 		else if (UEditableTextBox* EditableTextBox = Cast<UEditableTextBox>(Widget))
 		{
-			FText HintText = LanguageOneUMGHelper::GetEditableTextBoxHintText(EditableTextBox);
-			if (!HintText.IsEmpty())
+			AddWidgetUnit(Widget, LanguageOneUMGHelper::GetEditableTextBoxHintText(EditableTextBox), [WeakWidget](const FString& NewText)
 			{
-				if (bSilent && HasTranslation(HintText.ToString()))
+				if (UEditableTextBox* Target = Cast<UEditableTextBox>(WeakWidget.Get()))
 				{
-					FString CleanText = StripExistingTranslation(HintText.ToString());
-					EditableTextBox->SetHintText(FText::FromString(CleanText));
-					TranslatedWidgetCount++;
-					continue;
+					Target->SetHintText(FText::FromString(NewText));
 				}
-
-				TranslateSingleText(
-					HintText.ToString(),
-					[EditableTextBox, &TranslatedWidgetCount](const FString& TranslatedText)
-					{
-						EditableTextBox->SetHintText(FText::FromString(TranslatedText));
-						TranslatedWidgetCount++;
-					},
-					[]() {}
-				);
-			}
+			});
 		}
 		// Rich Text Block
 		else if (URichTextBlock* RichTextBlock = Cast<URichTextBlock>(Widget))
 		{
-			FText SourceText = RichTextBlock->GetText();
-			if (!SourceText.IsEmpty())
+			AddWidgetUnit(Widget, RichTextBlock->GetText(), [WeakWidget](const FString& NewText)
 			{
-				if (bSilent && HasTranslation(SourceText.ToString()))
+				if (URichTextBlock* Target = Cast<URichTextBlock>(WeakWidget.Get()))
 				{
-					FString CleanText = StripExistingTranslation(SourceText.ToString());
-					RichTextBlock->SetText(FText::FromString(CleanText));
-					TranslatedWidgetCount++;
-					continue;
+					Target->SetText(FText::FromString(NewText));
 				}
-
-				TranslateSingleText(
-					SourceText.ToString(),
-					[RichTextBlock, &TranslatedWidgetCount](const FString& TranslatedText)
-					{
-						RichTextBlock->SetText(FText::FromString(TranslatedText));
-						TranslatedWidgetCount++;
-					},
-					[]() {}
-				);
-			}
+			});
 		}
 	}
-
-	if (TranslatedWidgetCount > 0)
-	{
-		Blueprint->Modify();
-		FBlueprintEditorUtils::MarkBlueprintAsModified(Blueprint);
-		UE_LOG(LogTemp, Log, TEXT("Translated %d widgets in Widget Blueprint: %s"), TranslatedWidgetCount, *Blueprint->GetName());
-	}
 }
 
-void FAssetTranslator::TranslateBlueprint(UObject* Asset, bool bSilent)
+void FAssetTranslator::ExtractBlueprintUnits(UBlueprint* Blueprint, TArray<FTranslationTextUnit>& OutUnits)
 {
-	UBlueprint* Blueprint = Cast<UBlueprint>(Asset);
 	if (!Blueprint)
 	{
 		return;
 	}
 
-	UE_LOG(LogTemp, Log, TEXT("Translating Blueprint: %s"), *Blueprint->GetName());
-
-	int32 TranslatedItemCount = 0;
+	TWeakObjectPtr<UBlueprint> WeakBlueprint(Blueprint);
 
 	// 翻译变量描述
 	// 注意：某些蓝图类型（如 ControlRig）可能有特殊的变量结构，需要安全检查
-	for (FBPVariableDescription& Variable : Blueprint->NewVariables)
+	// 写回时按变量名重新查找，避免 NewVariables 数组在翻译期间被修改
+	for (const FBPVariableDescription& Variable : Blueprint->NewVariables)
 	{
 		// 安全检查：确保变量有效
 		if (Variable.VarName.IsNone())
 		{
 			continue;
 		}
+
+		const FName VarName = Variable.VarName;
 		
 		// 翻译 Tooltip（使用兼容性辅助函数）
 		FString TooltipValue = LanguageOneBlueprintHelper::GetVariableTooltip(Variable);
 		if (!TooltipValue.IsEmpty())
 		{
-			if (bSilent && HasTranslation(TooltipValue))
+			FTranslationTextUnit& Unit = OutUnits.AddDefaulted_GetRef();
+			Unit.Asset = Blueprint;
+			Unit.CurrentText = MoveTemp(TooltipValue);
+			Unit.Location = FString::Printf(TEXT("%s.Tooltip"), *VarName.ToString());
+			Unit.Apply = [WeakBlueprint, VarName](const FString& NewText, const FString& OriginalText)
 			{
-				FString CleanText = StripExistingTranslation(TooltipValue);
-				LanguageOneBlueprintHelper::SetVariableTooltip(Variable, CleanText);
-				TranslatedItemCount++;
-				continue;
-			}
-
-			TranslateSingleText(
-				TooltipValue,
-				[&Variable, &TranslatedItemCount](const FString& TranslatedText)
+				UBlueprint* Target = WeakBlueprint.Get();
+				const int32 VarIndex = Target ? FBlueprintEditorUtils::FindNewVariableIndex(Target, VarName) : INDEX_NONE;
+				if (VarIndex != INDEX_NONE)
 				{
-					LanguageOneBlueprintHelper::SetVariableTooltip(Variable, TranslatedText);
-					TranslatedItemCount++;
-					UE_LOG(LogTemp, Log, TEXT("Translated variable tooltip: %s"), *Variable.VarName.ToString());
-				},
-				[]() {}
-			);
+					LanguageOneBlueprintHelper::SetVariableTooltip(Target->NewVariables[VarIndex], NewText);
+				}
+			};
 		}
 
 		// 翻译 Category
 		if (!Variable.Category.IsEmpty())
 		{
-			if (bSilent && HasTranslation(Variable.Category.ToString()))
+			FTranslationTextUnit& Unit = OutUnits.AddDefaulted_GetRef();
+			Unit.Asset = Blueprint;
+			Unit.CurrentText = Variable.Category.ToString();
+			Unit.Location = FString::Printf(TEXT("%s.Category"), *VarName.ToString());
+			Unit.Apply = [WeakBlueprint, VarName](const FString& NewText, const FString& OriginalText)
 			{
-				FString CleanText = StripExistingTranslation(Variable.Category.ToString());
-				Variable.Category = FText::FromString(CleanText);
-				TranslatedItemCount++;
-				continue;
-			}
-
-			TranslateSingleText(
-				Variable.Category.ToString(),
-				[&Variable, &TranslatedItemCount](const FString& TranslatedText)
+				UBlueprint* Target = WeakBlueprint.Get();
+				const int32 VarIndex = Target ? FBlueprintEditorUtils::FindNewVariableIndex(Target, VarName) : INDEX_NONE;
+				if (VarIndex != INDEX_NONE)
 				{
-					Variable.Category = FText::FromString(TranslatedText);
-					TranslatedItemCount++;
-				},
-				[]() {}
-			);
+					Target->NewVariables[VarIndex].Category = FText::FromString(NewText);
+				}
+			};
 		}
 	}
 
@@ -1146,27 +909,27 @@ void FAssetTranslator::TranslateBlueprint(UObject* Asset, bool bSilent)
 		// 翻译图表中所有节点的注释
 		for (UEdGraphNode* Node : Graph->Nodes)
 		{
-			if (Node && !Node->NodeComment.IsEmpty())
+			if (!Node)
 			{
-				if (bSilent && HasTranslation(Node->NodeComment))
-				{
-					FString CleanText = StripExistingTranslation(Node->NodeComment);
-					Node->Modify();
-					Node->NodeComment = CleanText;
-					TranslatedItemCount++;
-					continue;
-				}
+				continue;
+			}
 
-				TranslateSingleText(
-					Node->NodeComment,
-					[Node, &TranslatedItemCount](const FString& TranslatedText)
+			TWeakObjectPtr<UEdGraphNode> WeakNode(Node);
+
+			if (!Node->NodeComment.IsEmpty())
+			{
+				FTranslationTextUnit& Unit = OutUnits.AddDefaulted_GetRef();
+				Unit.Asset = Blueprint;
+				Unit.CurrentText = Node->NodeComment;
+				Unit.Location = FString::Printf(TEXT("%s.%s"), *Graph->GetName(), *Node->GetName());
+				Unit.Target = Node;
+				Unit.Apply = [WeakNode](const FString& NewText, const FString& OriginalText)
+				{
+					if (UEdGraphNode* Target = WeakNode.Get())
 					{
-						Node->Modify();
-						Node->NodeComment = TranslatedText;
-						TranslatedItemCount++;
-					},
-					[]() {}
-				);
+						Target->NodeComment = NewText;
+					}
+				};
 			}
 
 			// 翻译函数入口节点的描述
@@ -1175,232 +938,61 @@ void FAssetTranslator::TranslateBlueprint(UObject* Asset, bool bSilent)
 				FString TooltipStr = FunctionEntry->GetTooltipText().ToString();
 				if (!TooltipStr.IsEmpty())
 				{
-					if (bSilent && HasTranslation(TooltipStr))
+					FTranslationTextUnit& Unit = OutUnits.AddDefaulted_GetRef();
+					Unit.Asset = Blueprint;
+					Unit.CurrentText = MoveTemp(TooltipStr);
+					Unit.Location = FString::Printf(TEXT("%s.Tooltip"), *Graph->GetName());
+					Unit.Target = Node;
+					Unit.Apply = [WeakNode](const FString& NewText, const FString& OriginalText)
 					{
-						FString CleanText = StripExistingTranslation(TooltipStr);
-						FunctionEntry->Modify();
-						// 函数的Tooltip存储在MetaData中
-						if (LanguageOneBlueprintMetadataHelper::HasMetaData(FunctionEntry->MetaData, FBlueprintMetadata::MD_Tooltip))
+						UK2Node_FunctionEntry* Target = Cast<UK2Node_FunctionEntry>(WeakNode.Get());
+						if (!Target)
 						{
-							LanguageOneBlueprintMetadataHelper::SetMetaData(FunctionEntry->MetaData, FBlueprintMetadata::MD_Tooltip, CleanText);
+							return;
 						}
-						TranslatedItemCount++;
-						continue;
-					}
 
-					TranslateSingleText(
-						TooltipStr,
-						[FunctionEntry, &TranslatedItemCount](const FString& TranslatedText)
+						// 函数的Tooltip存储在MetaData中
+						if (LanguageOneBlueprintMetadataHelper::HasMetaData(Target->MetaData, FBlueprintMetadata::MD_Tooltip))
 						{
-							FunctionEntry->Modify();
-							// 函数的Tooltip存储在MetaData中
-							if (LanguageOneBlueprintMetadataHelper::HasMetaData(FunctionEntry->MetaData, FBlueprintMetadata::MD_Tooltip))
-							{
-								LanguageOneBlueprintMetadataHelper::SetMetaData(FunctionEntry->MetaData, FBlueprintMetadata::MD_Tooltip, TranslatedText);
-							}
-							TranslatedItemCount++;
-						},
-						[]() {}
-					);
+							LanguageOneBlueprintMetadataHelper::SetMetaData(Target->MetaData, FBlueprintMetadata::MD_Tooltip, NewText);
+						}
+					};
 				}
 			}
 		}
 	}
-
-	if (TranslatedItemCount > 0)
-	{
-		Blueprint->Modify();
-		FBlueprintEditorUtils::MarkBlueprintAsModified(Blueprint);
-		UE_LOG(LogTemp, Log, TEXT("Translated %d items in Blueprint: %s"), TranslatedItemCount, *Blueprint->GetName());
-	}
 }
 
-void FAssetTranslator::TranslateAssetMetadata(UObject* Asset, bool bSilent)
+void FAssetTranslator::FinalizeAsset(UObject* Asset)
 {
 	if (!Asset)
 	{
 		return;
 	}
 
-	UE_LOG(LogTemp, Log, TEXT("Translating asset metadata: %s"), *Asset->GetName());
-
-	// 获取资产的元数据
-	UPackage* Package = Asset->GetOutermost();
-	if (!Package)
-	{
-		return;
-	}
-
-	FAssetRegistryModule& AssetRegistryModule = FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry");
-	IAssetRegistry& AssetRegistry = AssetRegistryModule.Get();
-
-	FAssetData AssetData = LanguageOneAssetDataHelper::GetAssetByObjectPath(AssetRegistry, FSoftObjectPath(Asset));
-	
-	// 翻译资产描述
-	FString Description;
-	if (AssetData.GetTagValue("Description", Description) && !Description.IsEmpty())
+	if (UStringTable* StringTable = Cast<UStringTable>(Asset))
 	{
-		if (bSilent && HasTranslation(Description))
-		{
-			FString CleanText = StripExistingTranslation(Description);
-			Asset->Modify();
-			// 设置元数据 (需要通过资产的元数据系统)
-			// 注意：这里可能需要特殊的 API 来设置元数据，具体取决于资产类型
-			UE_LOG(LogTemp, Log, TEXT("Restored asset description: %s"), *Asset->GetName());
-			return;
-		}
-
-		TranslateSingleText(
-			Description,
-			[Asset](const FString& TranslatedText)
-			{
-				Asset->Modify();
-				// 设置元数据 (需要通过资产的元数据系统)
-				UE_LOG(LogTemp, Log, TEXT("Translated asset description: %s"), *Asset->GetName());
-			},
-			[]() {}
-		);
+		// 写入缓冲中剩余的条目并刷新 StringTable（不传 Key，避免改变选中项）
+		FStringTableWriteQueue::Get().Flush(StringTable);
 	}
-}
-
-void FAssetTranslator::TranslateSingleText(const FString& SourceText, TFunction<void(const FString&)> OnSuccess, TFunction<void()> OnError)
-{
-	if (SourceText.IsEmpty())
+	else if (UBlueprint* Blueprint = Cast<UBlueprint>(Asset))
 	{
-		return;
+		Blueprint->Modify();
+		FBlueprintEditorUtils::MarkBlueprintAsModified(Blueprint);
 	}
-
-	// 提取原文（避免重复翻译）
-	FString CleanSourceText = StripExistingTranslation(SourceText);
-
-	FCommentTranslator::TranslateText(
-		CleanSourceText,
-		FOnTranslationComplete::CreateLambda([CleanSourceText, OnSuccess](const FString& TranslatedText)
-		{
-			const ULanguageOneSettings* Settings = GetDefault<ULanguageOneSettings>();
-			const TCHAR HiddenStartMarker[] = { 0x200B, 0x200C, 0 }; // ZWSP + ZWNJ
-			const TCHAR HiddenEndMarker[] = { 0x200B, 0x200D, 0 };   // ZWSP + ZWJ
-			const FString HiddenStart(HiddenStartMarker);
-			const FString HiddenEnd(HiddenEndMarker);
-			
-			FString NewText;
-			if (Settings->bTranslationAboveOriginal)
-			{
-				// 译文在上方：译文\n---\n标记开始原文标记结束
-				NewText = FString::Printf(TEXT("%s\n---\n%s%s%s"), *TranslatedText, *HiddenStart, *CleanSourceText, *HiddenEnd);
-			}
-			else
-			{
-				// 译文在下方（默认）：标记开始原文标记结束\n---\n译文
-				NewText = FString::Printf(TEXT("%s%s%s\n---\n%s"), *HiddenStart, *CleanSourceText, *HiddenEnd, *TranslatedText);
-			}
-
-			OnSuccess(NewText);
-		}),
-		FOnTranslationError::CreateLambda([OnError](const FString& ErrorMessage)
-		{
-			OnError();
-			UE_LOG(LogTemp, Error, TEXT("Translation failed: %s"), *ErrorMessage);
-		})
-	);
-}
-
-void FAssetTranslator::ShowTranslationProgress(int32 Current, int32 Total, const FString& AssetName)
-{
-	// 已移除通知弹窗，只在日志输出
-	if (Current >= Total)
+	else
 	{
-		UE_LOG(LogTemp, Log, TEXT("Translation completed: %s (%d/%d)"), *AssetName, Current, Total);
+		Asset->MarkPackageDirty();
 	}
-}
 
-void FAssetTranslator::ShowTranslationComplete(int32 SuccessCount, int32 TotalCount)
-{
-	// 已移除通知弹窗，只在日志输出
-	UE_LOG(LogTemp, Log, TEXT("All translations completed: %d/%d successful"), SuccessCount, TotalCount);
+	UE_LOG(LogTemp, Log, TEXT("Finished applying text to asset: %s"), *Asset->GetName());
 }
 
-// 实现 GetDisplayText 函数（移除隐藏标记，只返回译文部分）
+// 实现 GetDisplayText 函数（移除隐藏标记，只返回译文部分；旧格式假设右边是译文）
 FString LanguageOneStringTableHelper::GetDisplayText(const FString& Text)
 {
-	if (Text.IsEmpty())
-	{
-		return Text;
-	}
-	
-	// 检查是否有零宽字符隐藏标记（新格式）
-	// 格式：标记原文标记\n---\n译文 或 译文\n---\n标记原文标记
-	const TCHAR HiddenStartMarker[] = { 0x200B, 0x200C, 0 };
-	const TCHAR HiddenEndMarker[] = { 0x200B, 0x200D, 0 };
-	const FString HiddenStart(HiddenStartMarker);
-	const FString HiddenEnd(HiddenEndMarker);
-	
-	int32 StartPos = Text.Find(HiddenStart, ESearchCase::CaseSensitive);
-	if (StartPos != INDEX_NONE && StartPos >= 0)
-	{
-		int32 SearchStartPos = StartPos + HiddenStart.Len();
-		int32 EndPos = Text.Find(HiddenEnd, ESearchCase::CaseSensitive, ESearchDir::FromStart, SearchStartPos);
-		
-		if (EndPos != INDEX_NONE && EndPos > StartPos)
-		{
-			// 找到标记，判断译文位置
-			// 检查是否有 --- 分隔符
-			const FString Separator = TEXT("\n---\n");
-			int32 SeparatorPos = Text.Find(Separator, ESearchCase::CaseSensitive);
-			
-			if (SeparatorPos != INDEX_NONE)
-			{
-				// 有分隔符，判断标记在哪边
-				if (StartPos < SeparatorPos && EndPos < SeparatorPos)
-				{
-					// 标记在分隔符左边：标记原文标记\n---\n译文
-					// 译文在分隔符右边
-					FString AfterSeparator = Text.Mid(SeparatorPos + Separator.Len());
-					return AfterSeparator.TrimStartAndEnd();
-				}
-				else if (StartPos > SeparatorPos)
-				{
-					// 标记在分隔符右边：译文\n---\n标记原文标记
-					// 译文在分隔符左边
-					FString BeforeSeparator = Text.Left(SeparatorPos);
-					return BeforeSeparator.TrimStartAndEnd();
-				}
-			}
-			
-			// 没有分隔符，使用旧逻辑
-			if (StartPos == 0)
-			{
-				// 标记在开头：标记原文标记\n译文
-				int32 AfterMarker = EndPos + HiddenEnd.Len();
-				if (AfterMarker < Text.Len())
-				{
-					FString AfterMarkerText = Text.Mid(AfterMarker);
-					return AfterMarkerText.TrimStartAndEnd();
-				}
-			}
-			else
-			{
-				// 标记不在开头：译文\n标记原文标记
-				FString BeforeMarker = Text.Left(StartPos);
-				return BeforeMarker.TrimStartAndEnd();
-			}
-		}
-	}
-	
-	// 检查是否有可见分隔符（旧格式或没有标记）
-	const FString Separator = TEXT("\n---\n");
-	if (Text.Contains(Separator))
-	{
-		FString Left, Right;
-		if (Text.Split(Separator, &Left, &Right))
-		{
-			// 假设右边是译文
-			return Right.TrimStartAndEnd();
-		}
-	}
-	
-	// 没有标记，返回原文本
-	return Text;
+	const FBilingualTextView View = FBilingualText::Parse(Text, false);
+	return View.bHasTranslation ? FString(View.Translation) : Text;
 }
 
 void FAssetTranslator::RestoreSelectedAssets(const TArray<FAssetData>& SelectedAssets)
@@ -1431,257 +1023,84 @@ void FAssetTranslator::RestoreSelectedAssets(const TArray<FAssetData>& SelectedA
 	PerformRestore(RestorableAssets);
 }
 
-void FAssetTranslator::PerformRestore(const TArray<FAssetData>& TranslatableAssets)
+TSharedRef<FAssetTranslationJob> FAssetTranslator::PerformRestore(const TArray<FAssetData>& TranslatableAssets)
 {
-	// 设置处理状态
-	FAssetTranslatorUI::SetProcessing(true);
-	
-	// 使用工具窗口集成的进度组件
+	// 使用工具窗口集成的进度组件；任务负责处理状态和成功/失败计数
 	TSharedPtr<STranslationProgressWindow> ProgressWidget = FAssetTranslatorUI::GetToolWindowProgress();
-	if (ProgressWidget.IsValid())
-	{
-		ProgressWidget->SetOperationName(TEXT("还原"));
-	}
+	TSharedRef<FAssetTranslationJob> Job = FAssetTranslationJob::Start(TEXT("还原"), TEXT("restore"), TranslatableAssets.Num(), ProgressWidget);
 	
-	// 创建还原状态追踪
-	struct FRestoreState
+	// 只在日志输出，不显示弹窗
+	Job->SetOnFinished([](const FAssetTranslationJobResult& Result)
 	{
-		int32 TotalAssets;
-		int32 CompletedAssets;
-		int32 SuccessAssets;
-		int32 FailedAssets;
-		TSharedPtr<STranslationProgressWindow> ProgressWidget;
-		
-		FRestoreState(int32 Total, TSharedPtr<STranslationProgressWindow> Widget)
-			: TotalAssets(Total), CompletedAssets(0), SuccessAssets(0), FailedAssets(0), ProgressWidget(Widget)
-		{}
-	};
-	
-	TSharedPtr<FRestoreState> State = MakeShared<FRestoreState>(TranslatableAssets.Num(), ProgressWidget);
+		UE_LOG(LogTemp, Log, TEXT("Asset restore completed: %d/%d success"), Result.SucceededAssets, Result.TotalAssets);
+	});
 	
-	// 还原每个资产（使用静默模式，会自动检测并还原）
-	for (int32 i = 0; i < TranslatableAssets.Num(); i++)
+	// 还原每个资产（资产加载完成后立即处理）
+	auto OnAssetLoaded = [Job](const FAssetData& AssetData, UObject* Asset, TSharedPtr<FStreamableHandle> Handle)
 	{
-		const FAssetData& AssetData = TranslatableAssets[i];
-		
-		// 更新进度（先更新进度，确保即使失败也能看到进度变化）
-		if (State->ProgressWidget.IsValid())
+		if (Job->IsFinished())
 		{
-			State->ProgressWidget->UpdateProgress(i + 1, AssetData.AssetName.ToString());
+			return;
 		}
 		
-		// 检查资产是否可以被加载
-		UObject* Asset = AssetData.GetAsset();
+		LANGUAGEONE_TRACE_SCOPE("LanguageOne::RestoreAsset");
+		
+		// 检查资产是否加载成功
 		if (!Asset)
 		{
-			UE_LOG(LogTemp, Warning, TEXT("Failed to load asset %d/%d: %s"), 
-				i + 1, TranslatableAssets.Num(), *AssetData.AssetName.ToString());
-			State->CompletedAssets++;
-			State->FailedAssets++;
-			if (State->ProgressWidget.IsValid())
-			{
-				State->ProgressWidget->IncrementFailed();
-			}
-			continue;
+			UE_LOG(LogTemp, Warning, TEXT("Failed to load asset: %s"), *AssetData.AssetName.ToString());
+			Job->CompleteAsset(AssetData.AssetName.ToString(), false);
+			return;
 		}
 		
 		// 检查资产类型是否支持
 		if (!CanTranslateAsset(AssetData))
 		{
-			UE_LOG(LogTemp, Warning, TEXT("Unsupported asset type %d/%d: %s (Type: %s)"), 
-				i + 1, TranslatableAssets.Num(), *AssetData.AssetName.ToString(), 
-				*LanguageOneAssetDataHelper::GetAssetClassName(AssetData));
-			State->CompletedAssets++;
-			State->FailedAssets++;
-			if (State->ProgressWidget.IsValid())
-			{
-				State->ProgressWidget->IncrementFailed();
-			}
-			continue;
+			UE_LOG(LogTemp, Warning, TEXT("Unsupported asset type: %s (Type: %s)"), 
+				*AssetData.AssetName.ToString(), *LanguageOneAssetDataHelper::GetAssetClassName(AssetData));
+			Job->CompleteAsset(AssetData.AssetName.ToString(), false);
+			return;
 		}
 
-		UE_LOG(LogTemp, Log, TEXT("Restoring asset %d/%d: %s (Type: %s)"), 
-			i + 1, TranslatableAssets.Num(), *AssetData.AssetName.ToString(), 
-			*LanguageOneAssetDataHelper::GetAssetClassName(AssetData));
-
-		// 根据资产类型调用相应的还原函数（使用静默模式，会自动还原）
-		FString ClassName = LanguageOneAssetDataHelper::GetAssetClassName(AssetData);
-		
-		if (ClassName.Contains(TEXT("StringTable")))
-		{
-			TranslateStringTable(Asset, true); // 静默模式会自动还原
-		}
-		else if (ClassName.Contains(TEXT("DataTable")))
-		{
-			TranslateDataTable(Asset, true);
-		}
-		else if (ClassName.Contains(TEXT("WidgetBlueprint")) || ClassName.Contains(TEXT("UserWidget")))
-		{
-			TranslateWidgetBlueprint(Asset, true);
-		}
-		else if (ClassName.Contains(TEXT("Blueprint")))
-		{
-			TranslateBlueprint(Asset, true);
-		}
-		else
-		{
-			TranslateAssetMetadata(Asset, true);
-		}
-		
-		// 标记为成功
-		State->SuccessAssets++;
-		State->CompletedAssets++;
-		if (State->ProgressWidget.IsValid())
-		{
-			State->ProgressWidget->IncrementSuccess();
-		}
-	}
-	
-	// 标记完成
-	if (State->ProgressWidget.IsValid())
-	{
-		State->ProgressWidget->MarkComplete(State->SuccessAssets, State->FailedAssets);
-	}
-	
-	// 恢复处理状态
-	FAssetTranslatorUI::SetProcessing(false);
-	
-	// 不再自动关闭窗口，让用户手动关闭
-	// if (State->ProgressWidget.IsValid())
-	// {
-	// 	FTimerHandle TimerHandle;
-	// 	GEditor->GetTimerManager()->SetTimer(TimerHandle, []()
-	// 	{
-	// 		FAssetTranslatorUI::CloseTranslationProgress();
-	// 	}, 3.0f, false);
-	// }
-	
-	// 只在日志输出，不显示弹窗
-	UE_LOG(LogTemp, Log, TEXT("Asset restore completed: %d/%d success"), State->SuccessAssets, State->TotalAssets);
-}
+		UE_LOG(LogTemp, Log, TEXT("Restoring asset: %s (Type: %s)"), 
+			*AssetData.AssetName.ToString(), *LanguageOneAssetDataHelper::GetAssetClassName(AssetData));
 
-// 辅助函数：从文本中提取译文（移除原文部分）
-static FString ExtractTranslationOnly(const FString& Text)
-{
-	if (Text.IsEmpty())
-	{
-		return Text;
-	}
-	
-	// 检查是否有零宽字符隐藏标记（新格式）
-	// 格式：标记原文标记\n---\n译文 或 译文\n---\n标记原文标记
-	const TCHAR HiddenStartMarker[] = { 0x200B, 0x200C, 0 }; // ZWSP + ZWNJ
-	const TCHAR HiddenEndMarker[] = { 0x200B, 0x200D, 0 };   // ZWSP + ZWJ
-	const FString HiddenStart(HiddenStartMarker);
-	const FString HiddenEnd(HiddenEndMarker);
-	
-	int32 StartPos = Text.Find(HiddenStart, ESearchCase::CaseSensitive);
-	if (StartPos != INDEX_NONE && StartPos >= 0)
-	{
-		int32 SearchStartPos = StartPos + HiddenStart.Len();
-		int32 EndPos = Text.Find(HiddenEnd, ESearchCase::CaseSensitive, ESearchDir::FromStart, SearchStartPos);
+		// 收集文本单元，把带有译文的单元还原为原文
+		FTranslationBatchStats& JobStats = Job->GetStats();
+		TArray<FTranslationTextUnit> Units;
+		ExtractTextUnits(Asset, AssetData, Units);
+		RecordUnitsUndo(*Job, Asset, Units);
+		JobStats.TranslatableUnits += Units.Num();
 		
-		if (EndPos != INDEX_NONE && EndPos > StartPos)
+		int32 RestoredCount = 0;
 		{
-			// 找到标记，判断译文位置
-			// 新格式：标记原文标记\n---\n译文 或 译文\n---\n标记原文标记
-			const FString Separator = TEXT("\n---\n");
-			int32 SeparatorPos = Text.Find(Separator, ESearchCase::CaseSensitive);
-			
-			if (SeparatorPos != INDEX_NONE)
+			FScopedDurationTimer ApplyTimer(JobStats.ApplySeconds);
+			for (FTranslationTextUnit& Unit : Units)
 			{
-				// 有分隔符，判断标记在哪边
-				if (StartPos < SeparatorPos && EndPos < SeparatorPos)
-				{
-					// 标记在分隔符左边：标记原文标记\n---\n译文
-					// 译文在分隔符右边
-					FString AfterSeparator = Text.Mid(SeparatorPos + Separator.Len());
-					return AfterSeparator.TrimStartAndEnd();
-				}
-				else if (StartPos > SeparatorPos)
+				const FBilingualTextView Bilingual = FBilingualText::Parse(Unit.CurrentText);
+				if (Bilingual.bHasTranslation)
 				{
-					// 标记在分隔符右边：译文\n---\n标记原文标记
-					// 译文在分隔符左边
-					FString BeforeSeparator = Text.Left(SeparatorPos);
-					return BeforeSeparator.TrimStartAndEnd();
+					Unit.Apply(FString(Bilingual.Original), FString());
+					RestoredCount++;
 				}
 			}
 			
-			// 没有分隔符，使用旧逻辑
-			if (StartPos == 0)
-			{
-				// 标记在开头：标记原文标记\n译文
-				int32 AfterMarker = EndPos + HiddenEnd.Len();
-				if (AfterMarker < Text.Len())
-				{
-					FString AfterMarkerText = Text.Mid(AfterMarker);
-					return AfterMarkerText.TrimStartAndEnd();
-				}
-			}
-			else
-			{
-				// 标记不在开头：译文\n标记原文标记
-				FString BeforeMarker = Text.Left(StartPos);
-				return BeforeMarker.TrimStartAndEnd();
-			}
+			FinalizeAsset(Asset);
 		}
-	}
+		JobStats.RestoredUnits += RestoredCount;
+		UE_LOG(LogTemp, Log, TEXT("Restored %d text units in %s"), RestoredCount, *AssetData.AssetName.ToString());
+		
+		// 标记为成功
+		Job->CompleteAsset(AssetData.AssetName.ToString(), true);
+	};
 	
-	// 检查是否有可见分隔符（旧格式或没有标记）
-	const FString Separator = TEXT("\n---\n");
-	if (Text.Contains(Separator))
+	// 低内存批处理时每个窗口处理完立即释放
+	Job->SetAssetLoader(FAssetStreamLoader::Start(TranslatableAssets, OnAssetLoaded, [Job]()
 	{
-		FString Left, Right;
-		if (Text.Split(Separator, &Left, &Right))
-		{
-			// 没有标记，根据设置判断
-			const ULanguageOneSettings* Settings = GetDefault<ULanguageOneSettings>();
-			if (Settings->bTranslationAboveOriginal)
-			{
-				// 译文在上方：译文\n---\n原文
-				// 译文在左边
-				return Left.TrimStartAndEnd();
-			}
-			else
-			{
-				// 译文在下方（默认）：原文\n---\n译文
-				// 译文在右边
-				return Right.TrimStartAndEnd();
-			}
-		}
-	}
-	
-	// 没有标记，返回原文本
-	return Text;
-}
+		Job->Seal();
+	}, FAssetStreamWindow::FromSettings(nullptr)));
 
-// 辅助函数：检查文本是否处于双语模式（有原文标记）
-static bool IsBilingualMode(const FString& Text)
-{
-	if (Text.IsEmpty())
-	{
-		return false;
-	}
-	
-	// 检查是否有零宽字符隐藏标记和 --- 分隔符（新格式）
-	const TCHAR HiddenStartMarker[] = { 0x200B, 0x200C, 0 }; // ZWSP + ZWNJ
-	const TCHAR HiddenEndMarker[] = { 0x200B, 0x200D, 0 };   // ZWSP + ZWJ
-	const FString HiddenStart(HiddenStartMarker);
-	const FString HiddenEnd(HiddenEndMarker);
-	
-	// 新格式：有隐藏标记和 --- 分隔符
-	if (Text.Contains(HiddenStart) && Text.Contains(HiddenEnd) && Text.Contains(TEXT("\n---\n")))
-	{
-		return true;
-	}
-	
-	// 兼容旧格式：只有 --- 分隔符
-	if (Text.Contains(TEXT("\n---\n")))
-	{
-		return true;
-	}
-	
-	return false;
+	return Job;
 }
 
 void FAssetTranslator::ClearOriginalText(const TArray<FAssetData>& SelectedAssets)
@@ -1724,78 +1143,50 @@ void FAssetTranslator::ClearOriginalText(const TArray<FAssetData>& SelectedAsset
 	);
 }
 
-void FAssetTranslator::PerformClearOriginal(const TArray<FAssetData>& TranslatableAssets)
+TSharedRef<FAssetTranslationJob> FAssetTranslator::PerformClearOriginal(const TArray<FAssetData>& TranslatableAssets)
 {
-	// 设置处理状态
-	FAssetTranslatorUI::SetProcessing(true);
-	
-	// 使用工具窗口集成的进度组件
+	// 使用工具窗口集成的进度组件；任务负责处理状态和成功/失败计数
 	TSharedPtr<STranslationProgressWindow> ProgressWidget = FAssetTranslatorUI::GetToolWindowProgress();
-	if (ProgressWidget.IsValid())
-	{
-		ProgressWidget->SetOperationName(TEXT("清除"));
-	}
+	TSharedRef<FAssetTranslationJob> Job = FAssetTranslationJob::Start(TEXT("清除"), TEXT("clear_original"), TranslatableAssets.Num(), ProgressWidget);
 	
-	// 创建清除状态追踪
-	struct FClearState
+	Job->SetOnFinished([](const FAssetTranslationJobResult& Result)
 	{
-		int32 TotalAssets;
-		int32 CompletedAssets;
-		int32 SuccessAssets;
-		int32 FailedAssets;
-		TSharedPtr<STranslationProgressWindow> ProgressWidget;
-		
-		FClearState(int32 Total, TSharedPtr<STranslationProgressWindow> Widget)
-			: TotalAssets(Total), CompletedAssets(0), SuccessAssets(0), FailedAssets(0), ProgressWidget(Widget)
-		{}
-	};
+		UE_LOG(LogTemp, Log, TEXT("Clear original text completed: %d/%d success"), Result.SucceededAssets, Result.TotalAssets);
+	});
 	
-	TSharedPtr<FClearState> State = MakeShared<FClearState>(TranslatableAssets.Num(), ProgressWidget);
-	
-	// 清除每个资产的原文
-	for (int32 i = 0; i < TranslatableAssets.Num(); i++)
+	// 清除每个资产的原文（资产加载完成后立即处理）
+	auto OnAssetLoaded = [Job](const FAssetData& AssetData, UObject* Asset, TSharedPtr<FStreamableHandle> Handle)
 	{
-		const FAssetData& AssetData = TranslatableAssets[i];
-		
-		// 更新进度（先更新进度，确保即使失败也能看到进度变化）
-		if (State->ProgressWidget.IsValid())
+		if (Job->IsFinished())
 		{
-			State->ProgressWidget->UpdateProgress(i + 1, AssetData.AssetName.ToString());
+			return;
 		}
 		
-		// 检查资产是否可以被加载
-		UObject* Asset = AssetData.GetAsset();
+		LANGUAGEONE_TRACE_SCOPE("LanguageOne::ClearOriginalAsset");
+		
+		// 检查资产是否加载成功
 		if (!Asset)
 		{
-			UE_LOG(LogTemp, Warning, TEXT("Failed to load asset %d/%d: %s"), 
-				i + 1, TranslatableAssets.Num(), *AssetData.AssetName.ToString());
-			State->CompletedAssets++;
-			State->FailedAssets++;
-			if (State->ProgressWidget.IsValid())
-			{
-				State->ProgressWidget->IncrementFailed();
-			}
-			continue;
+			UE_LOG(LogTemp, Warning, TEXT("Failed to load asset: %s"), *AssetData.AssetName.ToString());
+			Job->CompleteAsset(AssetData.AssetName.ToString(), false);
+			return;
 		}
 		
 		// 检查资产类型是否支持
 		if (!CanTranslateAsset(AssetData))
 		{
-			UE_LOG(LogTemp, Warning, TEXT("Unsupported asset type %d/%d: %s (Type: %s)"), 
-				i + 1, TranslatableAssets.Num(), *AssetData.AssetName.ToString(), 
-				*LanguageOneAssetDataHelper::GetAssetClassName(AssetData));
-			State->CompletedAssets++;
-			State->FailedAssets++;
-			if (State->ProgressWidget.IsValid())
-			{
-				State->ProgressWidget->IncrementFailed();
-			}
-			continue;
+			UE_LOG(LogTemp, Warning, TEXT("Unsupported asset type: %s (Type: %s)"), 
+				*AssetData.AssetName.ToString(), *LanguageOneAssetDataHelper::GetAssetClassName(AssetData));
+			Job->CompleteAsset(AssetData.AssetName.ToString(), false);
+			return;
 		}
 
-		UE_LOG(LogTemp, Log, TEXT("Clearing original text for asset %d/%d: %s (Type: %s)"), 
-			i + 1, TranslatableAssets.Num(), *AssetData.AssetName.ToString(), 
-			*LanguageOneAssetDataHelper::GetAssetClassName(AssetData));
+		UE_LOG(LogTemp, Log, TEXT("Clearing original text for asset: %s (Type: %s)"), 
+			*AssetData.AssetName.ToString(), *LanguageOneAssetDataHelper::GetAssetClassName(AssetData));
+
+		// 整个资产记录一个撤销事务
+		Job->RecordUndo(Asset, TArray<UObject*>());
+		const double ApplyStartTime = FPlatformTime::Seconds();
 
 		// 根据资产类型调用相应的清除函数
 		FString ClassName = LanguageOneAssetDataHelper::GetAssetClassName(AssetData);
@@ -1813,16 +1204,15 @@ void FAssetTranslator::PerformClearOriginal(const TArray<FAssetData>& Translatab
 				for (const FString& Key : Keys)
 				{
 					FString CurrentText = LanguageOneStringTableHelper::FindStringTableEntry(StringTableData, Key);
-					if (HasTranslation(CurrentText))
+					const FBilingualTextView Bilingual = FBilingualText::Parse(CurrentText);
+					if (Bilingual.bHasTranslation)
 					{
-						FString TranslationOnly = ExtractTranslationOnly(CurrentText);
-						LanguageOneStringTableHelper::SetStringTableEntry(StringTable, Key, TranslationOnly);
+						LanguageOneStringTableHelper::SetStringTableEntry(StringTable, Key, FString(Bilingual.Translation));
 						// 清除元数据中的原文
-						static const FName OriginalTextMetaDataId = TEXT("LanguageOne_OriginalText");
 						LanguageOneStringTableHelper::SetStringTableEntryMetaData(StringTable, Key, OriginalTextMetaDataId, FString());
 					}
 				}
-				RefreshStringTableEditor(StringTable);
+				FStringTableWriteQueue::RefreshStringTableEditor(StringTable);
 			}
 		}
 		else if (ClassName.Contains(TEXT("DataTable")))
@@ -1831,73 +1221,34 @@ void FAssetTranslator::PerformClearOriginal(const TArray<FAssetData>& Translatab
 			if (DataTable)
 			{
 				DataTable->Modify();
-				TArray<FName> RowNames = DataTable->GetRowNames();
-				const UScriptStruct* RowStruct = DataTable->GetRowStruct();
-				if (RowStruct)
+				TSharedRef<const FStructTextPlan> Plan = FStructTextPlan::Get(DataTable->GetRowStruct());
+				for (const TPair<FName, uint8*>& RowPair : DataTable->GetRowMap())
 				{
-					for (const FName& RowName : RowNames)
+					Plan->ForEachField(RowPair.Value, false, [](const FStructTextField& Field)
 					{
-						uint8* RowData = DataTable->FindRowUnchecked(RowName);
-						if (RowData)
+						const FBilingualTextView Bilingual = FBilingualText::Parse(Field.GetString());
+						if (Bilingual.bHasTranslation)
 						{
-							for (TFieldIterator<FProperty> It(const_cast<UScriptStruct*>(RowStruct)); It; ++It)
-							{
-								FProperty* Property = *It;
-								if (FTextProperty* TextProperty = CastField<FTextProperty>(Property))
-								{
-									FText* TextValue = TextProperty->ContainerPtrToValuePtr<FText>(RowData);
-									if (TextValue && HasTranslation(TextValue->ToString()))
-									{
-										FString TranslationOnly = ExtractTranslationOnly(TextValue->ToString());
-										*TextValue = FText::FromString(TranslationOnly);
-									}
-								}
-								else if (FStrProperty* StrProperty = CastField<FStrProperty>(Property))
-								{
-									FString* StrValue = StrProperty->ContainerPtrToValuePtr<FString>(RowData);
-									if (StrValue && HasTranslation(*StrValue))
-									{
-										FString TranslationOnly = ExtractTranslationOnly(*StrValue);
-										*StrValue = TranslationOnly;
-									}
-								}
-							}
+							Field.SetString(FString(Bilingual.Translation));
 						}
-					}
+					});
 				}
 			}
 		}
 		// 其他资产类型的清除逻辑类似...
 		
 		// 标记为成功
-		State->SuccessAssets++;
-		State->CompletedAssets++;
-		if (State->ProgressWidget.IsValid())
-		{
-			State->ProgressWidget->IncrementSuccess();
-		}
-	}
+		Job->GetStats().ApplySeconds += FPlatformTime::Seconds() - ApplyStartTime;
+		Job->CompleteAsset(AssetData.AssetName.ToString(), true);
+	};
 	
-	// 标记完成
-	if (State->ProgressWidget.IsValid())
+	// 低内存批处理时每个窗口处理完立即释放
+	Job->SetAssetLoader(FAssetStreamLoader::Start(TranslatableAssets, OnAssetLoaded, [Job]()
 	{
-		State->ProgressWidget->MarkComplete(State->SuccessAssets, State->FailedAssets);
-	}
-	
-	// 恢复处理状态
-	FAssetTranslatorUI::SetProcessing(false);
-	
-	// 不再自动关闭窗口，让用户手动关闭
-	// if (State->ProgressWidget.IsValid())
-	// {
-	// 	FTimerHandle TimerHandle;
-	// 	GEditor->GetTimerManager()->SetTimer(TimerHandle, []()
-	// 	{
-	// 		FAssetTranslatorUI::CloseTranslationProgress();
-	// 	}, 3.0f, false);
-	// }
-	
-	UE_LOG(LogTemp, Log, TEXT("Clear original text completed: %d/%d success"), State->SuccessAssets, State->TotalAssets);
+		Job->Seal();
+	}, FAssetStreamWindow::FromSettings(nullptr)));
+
+	return Job;
 }
 
 void FAssetTranslator::ToggleDisplayMode(const TArray<FAssetData>& SelectedAssets)
@@ -1928,35 +1279,37 @@ void FAssetTranslator::ToggleDisplayMode(const TArray<FAssetData>& SelectedAsset
 	PerformToggleDisplayMode(ToggleableAssets);
 }
 
-void FAssetTranslator::PerformToggleDisplayMode(const TArray<FAssetData>& TranslatableAssets)
+TSharedRef<FAssetTranslationJob> FAssetTranslator::PerformToggleDisplayMode(const TArray<FAssetData>& TranslatableAssets)
 {
-	// 设置处理状态
-	FAssetTranslatorUI::SetProcessing(true);
-	
-	// 使用工具窗口集成的进度组件
+	// 使用工具窗口集成的进度组件；任务负责处理状态和已切换/失败计数
 	TSharedPtr<STranslationProgressWindow> ProgressWidget = FAssetTranslatorUI::GetToolWindowProgress();
+	TSharedRef<FAssetTranslationJob> Job = FAssetTranslationJob::Start(TEXT("切换"), TEXT("toggle_display_mode"), TranslatableAssets.Num(), ProgressWidget);
 	
-	// 切换每个资产的显示模式
-	for (int32 i = 0; i < TranslatableAssets.Num(); i++)
+	Job->SetOnFinished([](const FAssetTranslationJobResult& Result)
 	{
-		const FAssetData& AssetData = TranslatableAssets[i];
-		
-		// 更新进度
-		if (ProgressWidget.IsValid())
+		UE_LOG(LogTemp, Log, TEXT("Toggle display mode completed: %d assets"), Result.SucceededAssets);
+	});
+	
+	// 切换每个资产的显示模式（资产加载完成后立即处理）
+	auto OnAssetLoaded = [Job](const FAssetData& AssetData, UObject* Asset, TSharedPtr<FStreamableHandle> Handle)
+	{
+		if (Job->IsFinished())
 		{
-			ProgressWidget->UpdateProgress(i + 1, AssetData.AssetName.ToString());
+			return;
 		}
 		
-		UObject* Asset = AssetData.GetAsset();
+		LANGUAGEONE_TRACE_SCOPE("LanguageOne::ToggleDisplayModeAsset");
+		
 		if (!Asset)
 		{
-			if (ProgressWidget.IsValid())
-			{
-				ProgressWidget->IncrementFailed();
-			}
-			continue;
+			Job->CompleteAsset(AssetData.AssetName.ToString(), false);
+			return;
 		}
 
+		// 整个资产记录一个撤销事务
+		Job->RecordUndo(Asset, TArray<UObject*>());
+		const double ApplyStartTime = FPlatformTime::Seconds();
+
 		FString ClassName = LanguageOneAssetDataHelper::GetAssetClassName(AssetData);
 		
 		if (ClassName.Contains(TEXT("StringTable")))
@@ -1972,46 +1325,29 @@ void FAssetTranslator::PerformToggleDisplayMode(const TArray<FAssetData>& Transl
 				for (const FString& Key : Keys)
 				{
 					FString CurrentText = LanguageOneStringTableHelper::FindStringTableEntry(StringTableData, Key);
-					if (HasTranslation(CurrentText))
+					const FBilingualTextView Bilingual = FBilingualText::Parse(CurrentText);
+					if (Bilingual.bHasTranslation)
 					{
 						FString NewText;
-						if (IsBilingualMode(CurrentText))
+						if (Bilingual.bIsBilingual)
 						{
 							// 切换到原文模式：只显示原文
-							NewText = StripExistingTranslation(CurrentText);
+							NewText = FString(Bilingual.Original);
 						}
 						else
 						{
 							// 切换到双语模式：显示原文\n译文 或 译文\n原文
 							// 从元数据中获取原文（最可靠）
-							static const FName OriginalTextMetaDataId = TEXT("LanguageOne_OriginalText");
 							FString OriginalText = LanguageOneStringTableHelper::GetStringTableEntryMetaData(StringTableData, Key, OriginalTextMetaDataId);
 							
 							// 如果元数据中没有原文，尝试从当前文本提取
 							if (OriginalText.IsEmpty())
 							{
-								OriginalText = StripExistingTranslation(CurrentText);
+								OriginalText = FString(Bilingual.Original);
 							}
 							
 							// 当前文本就是译文（因为是从原文模式切换过来的）
-							FString TranslationText = CurrentText;
-							
-							const TCHAR HiddenStartMarker[] = { 0x200B, 0x200C, 0 };
-							const TCHAR HiddenEndMarker[] = { 0x200B, 0x200D, 0 };
-							const FString HiddenStart(HiddenStartMarker);
-							const FString HiddenEnd(HiddenEndMarker);
-							
-							const ULanguageOneSettings* Settings = GetDefault<ULanguageOneSettings>();
-							if (Settings->bTranslationAboveOriginal)
-							{
-								// 译文在上方：译文\n---\n标记开始原文标记结束
-								NewText = FString::Printf(TEXT("%s\n---\n%s%s%s"), *TranslationText, *HiddenStart, *OriginalText, *HiddenEnd);
-							}
-							else
-							{
-								// 译文在下方（默认）：标记开始原文标记结束\n---\n译文
-								NewText = FString::Printf(TEXT("%s%s%s\n---\n%s"), *HiddenStart, *OriginalText, *HiddenEnd, *TranslationText);
-							}
+							NewText = FBilingualText::Format(CurrentText, OriginalText);
 							
 							// 恢复元数据
 							LanguageOneStringTableHelper::SetStringTableEntryMetaData(StringTable, Key, OriginalTextMetaDataId, OriginalText);
@@ -2019,26 +1355,20 @@ void FAssetTranslator::PerformToggleDisplayMode(const TArray<FAssetData>& Transl
 						LanguageOneStringTableHelper::SetStringTableEntry(StringTable, Key, NewText);
 					}
 				}
-				RefreshStringTableEditor(StringTable);  // 保持实时刷新功能不变！
+				FStringTableWriteQueue::RefreshStringTableEditor(StringTable);  // 保持实时刷新功能不变！
 			}
 		}
 		// 其他资产类型的切换逻辑类似...
 		
-		// 标记为已翻译切换
-		if (ProgressWidget.IsValid())
-		{
-			// ProgressWidget->IncrementTranslated();
-		}
-	}
+		Job->GetStats().ApplySeconds += FPlatformTime::Seconds() - ApplyStartTime;
+		Job->CompleteAsset(AssetData.AssetName.ToString(), true);
+	};
 	
-	// 标记完成
-	if (ProgressWidget.IsValid())
+	// 低内存批处理时每个窗口处理完立即释放
+	Job->SetAssetLoader(FAssetStreamLoader::Start(TranslatableAssets, OnAssetLoaded, [Job]()
 	{
-		ProgressWidget->MarkComplete(0, 0);  // 切换操作没有成功/失败，只有已翻译计数
-	}
-	
-	// 恢复处理状态
-	FAssetTranslatorUI::SetProcessing(false);
+		Job->Seal();
+	}, FAssetStreamWindow::FromSettings(nullptr)));
 
-	UE_LOG(LogTemp, Log, TEXT("Toggle display mode completed: %d assets"), TranslatableAssets.Num());
+	return Job;
 }
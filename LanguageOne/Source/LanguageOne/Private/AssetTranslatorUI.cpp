@@ -2,8 +2,10 @@
 
 #include "AssetTranslatorUI.h"
 #include "AssetTranslator.h"
+#include "AssetTranslationJob.h"
 #include "LanguageOneCompatibility.h"
 #include "LanguageOneSettings.h"
+#include "TranslationRequestScheduler.h"
 #include "Framework/Application/SlateApplication.h"
 #include "Widgets/SWindow.h"
 #include "Widgets/Layout/SBorder.h"
@@ -247,6 +249,15 @@ void STranslationProgressWindow::Construct(const FArguments& InArgs, int32 InTot
 						.AutoWrapText(true)
 						.ColorAndOpacity(FLinearColor(0.9f, 0.9f, 0.9f, 1.0f))
 					]
+					+ SVerticalBox::Slot()
+					.AutoHeight()
+					.Padding(0, 4, 0, 0)
+					[
+						SNew(STextBlock)
+						.Text(this, &STranslationProgressWindow::GetQueueText)
+						.Font(FAppStyle::GetFontStyle("SmallFont"))
+						.ColorAndOpacity(FLinearColor(0.6f, 0.6f, 0.6f, 1.0f))
+					]
 				]
 			]
 		]
@@ -418,6 +429,20 @@ FText STranslationProgressWindow::GetStatusText() const
 	}
 }
 
+FText STranslationProgressWindow::GetQueueText() const
+{
+	const FTranslationSchedulerStats Stats = FTranslationRequestScheduler::Get().GetStats();
+	if (Stats.QueuedRequests == 0 && Stats.InFlightRequests == 0)
+	{
+		return FText::GetEmpty();
+	}
+
+	return FText::FromString(FString::Printf(
+		TEXT("🌐 请求：排队 %d，进行中 %d，平均等待 %.1fs | Requests: %d queued, %d in flight, %.1fs avg wait"),
+		Stats.QueuedRequests, Stats.InFlightRequests, Stats.AverageWaitSeconds,
+		Stats.QueuedRequests, Stats.InFlightRequests, Stats.AverageWaitSeconds));
+}
+
 //////////////////////////////////////////////////////////////////////////
 // FAssetTranslatorUI
 //////////////////////////////////////////////////////////////////////////
@@ -711,8 +736,20 @@ void FAssetTranslatorUI::CloseTranslationProgress()
 	}
 }
 
+// 命令行运行（或 Slate 未初始化）时通知只输出到日志
+static bool IsHeadless()
+{
+	return IsRunningCommandlet() || !FSlateApplication::IsInitialized();
+}
+
 void FAssetTranslatorUI::ShowTranslationCompleteNotification(int32 SuccessCount, int32 TotalCount)
 {
+	if (IsHeadless())
+	{
+		UE_LOG(LogTemp, Display, TEXT("Translation completed: %d/%d successful"), SuccessCount, TotalCount);
+		return;
+	}
+
 	FNotificationInfo Info(FText::FromString(FString::Printf(
 		TEXT("✓ 翻译完成！成功 %d/%d | Translation completed! %d/%d successful"),
 		SuccessCount, TotalCount, SuccessCount, TotalCount
@@ -725,6 +762,12 @@ void FAssetTranslatorUI::ShowTranslationCompleteNotification(int32 SuccessCount,
 
 void FAssetTranslatorUI::ShowErrorNotification(const FString& Message)
 {
+	if (IsHeadless())
+	{
+		UE_LOG(LogTemp, Error, TEXT("%s"), *Message);
+		return;
+	}
+
 	FNotificationInfo Info(FText::FromString(FString::Printf(
 		TEXT("✗ 错误 | Error: %s"), *Message
 	)));
@@ -735,6 +778,12 @@ void FAssetTranslatorUI::ShowErrorNotification(const FString& Message)
 
 void FAssetTranslatorUI::ShowInfoNotification(const FString& Message)
 {
+	if (IsHeadless())
+	{
+		UE_LOG(LogTemp, Display, TEXT("%s"), *Message);
+		return;
+	}
+
 	FNotificationInfo Info(FText::FromString(Message));
 	Info.ExpireDuration = 3.0f;
 	FSlateNotificationManager::Get().AddNotification(Info);
@@ -742,6 +791,12 @@ void FAssetTranslatorUI::ShowInfoNotification(const FString& Message)
 
 void FAssetTranslatorUI::ShowWarningNotification(const FString& Message)
 {
+	if (IsHeadless())
+	{
+		UE_LOG(LogTemp, Warning, TEXT("%s"), *Message);
+		return;
+	}
+
 	FNotificationInfo Info(FText::FromString(Message));
 	Info.ExpireDuration = 5.0f;
 	Info.bFireAndForget = true;
@@ -1056,6 +1111,28 @@ void FAssetTranslatorUI::ShowAssetTranslationTool(const TArray<FAssetData>& Sele
 					})
 				]
 				
+				// 取消按钮（只在处理中可用）
+				+ SHorizontalBox::Slot()
+				.FillWidth(1.0f)
+				.Padding(0, 0, 8, 0)
+				[
+					SNew(SButton)
+					.Text(FText::FromString(TEXT("⏹ 取消 | Cancel")))
+					.HAlign(HAlign_Center)
+					.ContentPadding(FMargin(32, 10))
+					.ButtonStyle(FAppStyle::Get(), "Button")
+					.ToolTipText(FText::FromString(TEXT("停止当前操作，丢弃尚未发送的翻译请求（已写回的内容保留） | Stop the current operation and drop pending translation requests (applied text is kept)")))
+					.IsEnabled_Lambda([]() { return FAssetTranslatorUI::IsProcessing(); })
+					.OnClicked_Lambda([]() -> FReply
+					{
+						if (!FAssetTranslationJob::CancelActive())
+						{
+							FAssetTranslatorUI::ShowInfoNotification(TEXT("当前没有正在进行的操作 | No operation in progress"));
+						}
+						return FReply::Handled();
+					})
+				]
+				
 				// 关闭按钮
 				+ SHorizontalBox::Slot()
 				.FillWidth(1.0f)
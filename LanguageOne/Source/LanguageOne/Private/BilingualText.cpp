@@ -0,0 +1,202 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "BilingualText.h"
+#include "LanguageOneSettings.h"
+
+namespace BilingualTextInternal
+{
+	constexpr int32 MarkerLen = UE_ARRAY_COUNT(FBilingualText::HiddenStart) - 1;
+	constexpr int32 SeparatorLen = UE_ARRAY_COUNT(FBilingualText::Separator) - 1;
+
+	/** 一次扫描得到的位置（都是第一次出现的位置，结束标记只在开始标记之后查找） */
+	struct FScanResult
+	{
+		int32 StartPos = INDEX_NONE;
+		int32 EndPos = INDEX_NONE;
+		int32 SeparatorPos = INDEX_NONE;
+
+		bool HasMarkers() const { return StartPos != INDEX_NONE && EndPos != INDEX_NONE; }
+	};
+
+	static FScanResult Scan(FStringView Text)
+	{
+		FScanResult Result;
+		const TCHAR* Data = Text.GetData();
+		const int32 Len = Text.Len();
+
+		for (int32 Index = 0; Index < Len; ++Index)
+		{
+			const TCHAR Char = Data[Index];
+			if (Char == 0x200B && Index + 1 < Len)
+			{
+				const TCHAR Next = Data[Index + 1];
+				if (Next == FBilingualText::HiddenStart[1] && Result.StartPos == INDEX_NONE)
+				{
+					Result.StartPos = Index;
+				}
+				else if (Next == FBilingualText::HiddenEnd[1] && Result.StartPos != INDEX_NONE && Result.EndPos == INDEX_NONE)
+				{
+					Result.EndPos = Index;
+				}
+			}
+			else if (Char == TEXT('\n') && Result.SeparatorPos == INDEX_NONE
+				&& Index + SeparatorLen <= Len
+				&& FCString::Strncmp(Data + Index, FBilingualText::Separator, SeparatorLen) == 0)
+			{
+				Result.SeparatorPos = Index;
+			}
+
+			if (Result.EndPos != INDEX_NONE && Result.SeparatorPos != INDEX_NONE)
+			{
+				break;
+			}
+		}
+
+		return Result;
+	}
+}
+
+FBilingualTextView FBilingualText::Parse(FStringView Text, bool bLegacyTranslationAbove)
+{
+	using namespace BilingualTextInternal;
+
+	FBilingualTextView View;
+	View.Original = Text;
+	View.Translation = Text;
+
+	if (Text.IsEmpty())
+	{
+		return View;
+	}
+
+	const FScanResult Scanned = Scan(Text);
+	const bool bHasMarkers = Scanned.HasMarkers();
+	const bool bHasSeparator = Scanned.SeparatorPos != INDEX_NONE;
+
+	View.bIsBilingual = bHasSeparator;
+	View.bHasTranslation = bHasSeparator || bHasMarkers;
+	if (!View.bHasTranslation)
+	{
+		return View;
+	}
+
+	const FStringView BeforeSeparator = bHasSeparator ? Text.Left(Scanned.SeparatorPos) : FStringView();
+	const FStringView AfterSeparator = bHasSeparator ? Text.Mid(Scanned.SeparatorPos + SeparatorLen) : FStringView();
+
+	if (bHasMarkers)
+	{
+		// 隐藏标记中总是原文，不做额外清理（用户原文可能本身就包含空白或零宽字符）
+		View.Original = Text.Mid(Scanned.StartPos + MarkerLen, Scanned.EndPos - Scanned.StartPos - MarkerLen);
+
+		if (bHasSeparator && Scanned.EndPos < Scanned.SeparatorPos)
+		{
+			// 标记在分隔符左边，译文在右边
+			View.Layout = EBilingualLayout::TranslationBelow;
+			View.Translation = AfterSeparator.TrimStartAndEnd();
+			return View;
+		}
+		if (bHasSeparator && Scanned.StartPos > Scanned.SeparatorPos)
+		{
+			// 标记在分隔符右边，译文在左边
+			View.Layout = EBilingualLayout::TranslationAbove;
+			View.Translation = BeforeSeparator.TrimStartAndEnd();
+			return View;
+		}
+
+		// 没有分隔符（或标记跨过分隔符）：按标记位置判断
+		View.Layout = EBilingualLayout::MarkersOnly;
+		if (Scanned.StartPos > 0)
+		{
+			View.Translation = Text.Left(Scanned.StartPos).TrimStartAndEnd();
+			return View;
+		}
+
+		const int32 AfterMarker = Scanned.EndPos + MarkerLen;
+		if (AfterMarker < Text.Len())
+		{
+			View.Translation = Text.Mid(AfterMarker).TrimStartAndEnd();
+			return View;
+		}
+
+		// 标记后没有内容，译文按旧格式处理
+		if (!bHasSeparator)
+		{
+			return View;
+		}
+		View.Translation = bLegacyTranslationAbove ? BeforeSeparator.TrimStartAndEnd() : AfterSeparator.TrimStartAndEnd();
+		return View;
+	}
+
+	// 旧格式：没有隐藏标记，根据设置判断哪边是原文
+	View.Layout = EBilingualLayout::Legacy;
+	const FStringView LegacyOriginal = bLegacyTranslationAbove ? AfterSeparator.TrimStartAndEnd() : BeforeSeparator.TrimStartAndEnd();
+	const FStringView LegacyTranslation = bLegacyTranslationAbove ? BeforeSeparator.TrimStartAndEnd() : AfterSeparator.TrimStartAndEnd();
+	if (!LegacyOriginal.IsEmpty())
+	{
+		View.Original = LegacyOriginal;
+	}
+	View.Translation = LegacyTranslation;
+	return View;
+}
+
+FBilingualTextView FBilingualText::Parse(FStringView Text)
+{
+	return Parse(Text, GetDefault<ULanguageOneSettings>()->bTranslationAboveOriginal);
+}
+
+FString FBilingualText::Format(FStringView TranslatedText, FStringView OriginalText, bool bTranslationAbove)
+{
+	using namespace BilingualTextInternal;
+
+	FString Result;
+	Result.Reserve(TranslatedText.Len() + OriginalText.Len() + MarkerLen * 2 + SeparatorLen);
+
+	if (bTranslationAbove)
+	{
+		// 译文在上方：译文\n---\n标记开始原文标记结束
+		Result.Append(TranslatedText.GetData(), TranslatedText.Len());
+		Result.Append(Separator, SeparatorLen);
+		Result.Append(HiddenStart, MarkerLen);
+		Result.Append(OriginalText.GetData(), OriginalText.Len());
+		Result.Append(HiddenEnd, MarkerLen);
+	}
+	else
+	{
+		// 译文在下方（默认）：标记开始原文标记结束\n---\n译文
+		Result.Append(HiddenStart, MarkerLen);
+		Result.Append(OriginalText.GetData(), OriginalText.Len());
+		Result.Append(HiddenEnd, MarkerLen);
+		Result.Append(Separator, SeparatorLen);
+		Result.Append(TranslatedText.GetData(), TranslatedText.Len());
+	}
+
+	return Result;
+}
+
+FString FBilingualText::Format(FStringView TranslatedText, FStringView OriginalText)
+{
+	return Format(TranslatedText, OriginalText, GetDefault<ULanguageOneSettings>()->bTranslationAboveOriginal);
+}
+
+FString FBilingualText::GetOriginal(const FString& Text)
+{
+	const FBilingualTextView View = Parse(Text);
+	return View.Original.Len() == Text.Len() ? Text : FString(View.Original);
+}
+
+FString FBilingualText::GetTranslation(const FString& Text)
+{
+	const FBilingualTextView View = Parse(Text);
+	return View.Translation.Len() == Text.Len() ? Text : FString(View.Translation);
+}
+
+bool FBilingualText::HasTranslation(FStringView Text)
+{
+	const BilingualTextInternal::FScanResult Scanned = BilingualTextInternal::Scan(Text);
+	return Scanned.HasMarkers() || Scanned.SeparatorPos != INDEX_NONE;
+}
+
+bool FBilingualText::IsBilingual(FStringView Text)
+{
+	return BilingualTextInternal::Scan(Text).SeparatorPos != INDEX_NONE;
+}
@@ -3,6 +3,13 @@
 #include "CommentTranslator.h"
 #include "LanguageOneCompatibility.h"
 #include "LanguageOneSettings.h"
+#include "TranslationMemory.h"
+#include "MicrosoftAuthToken.h"
+#include "TranslationRequestScheduler.h"
+#include "LanguageOneTrace.h"
+#include "TranslationResultQueue.h"
+#include "ProviderRouter.h"
+#include "Containers/Ticker.h"
 #include "HttpModule.h"
 #include "Interfaces/IHttpRequest.h"
 #include "Interfaces/IHttpResponse.h"
@@ -10,6 +17,84 @@
 #include "JsonUtilities.h"
 #include "Misc/SecureHash.h"
 
+namespace LanguageOneCommentTranslator
+{
+	/** 等待同一次翻译结果的调用方 */
+	struct FTranslationWaiter
+	{
+		FOnTranslationComplete OnComplete;
+		FOnTranslationError OnError;
+	};
+
+	/** 进行中的单条翻译：键为 (请求组, 优先级, 服务, 目标语言, 规范化原文)，相同的后续调用只追加回调 */
+	static TMap<FString, TArray<FTranslationWaiter>> InFlightTranslations;
+
+	static FString MakeInFlightKey(ETranslateProvider Provider, const FString& TargetLang, const FString& SourceText)
+	{
+		const FTranslationRequestScheduler& Scheduler = FTranslationRequestScheduler::Get();
+		return FString::Printf(TEXT("%u\t%d\t%d\t%s\t%s"), Scheduler.GetCurrentRequestGroup(), (int32)Scheduler.GetCurrentPriority(),
+			(int32)Provider, *TargetLang, *FTranslationMemory::NormalizeSourceText(SourceText));
+	}
+}
+
+// 包装回调：在任意线程调用时把结果投递到结果队列，在游戏线程恢复请求组、优先级和追踪批次后执行
+template <typename ResultType>
+static TDelegate<void(const ResultType&)> DeferToGameThread(const TDelegate<void(const ResultType&)>& Callback, uint32 Group, ETranslationRequestPriority Priority, uint32 TraceBatch)
+{
+	// 工作线程只复制共享指针，原回调只在游戏线程执行和释放
+	TSharedRef<TDelegate<void(const ResultType&)>> SharedCallback = MakeShared<TDelegate<void(const ResultType&)>>(Callback);
+	return TDelegate<void(const ResultType&)>::CreateLambda([SharedCallback, Group, Priority, TraceBatch](const ResultType& Result)
+	{
+		FTranslationResultQueue::Get().Post(Group, Priority, TraceBatch, [SharedCallback, Result]()
+		{
+			SharedCallback->ExecuteIfBound(Result);
+		});
+	});
+}
+
+// 在工作线程解析响应：Parse 调用的 OnParsed / OnParseFailed 在游戏线程按时间预算执行
+// 必须在游戏线程调用（调度器的完成回调中），以记录当前请求组、优先级和追踪批次
+template <typename ResultType, typename ParseFunctionType>
+static void ParseResponseAsync(FHttpResponsePtr Response, bool bSuccess, const TDelegate<void(const ResultType&)>& OnComplete, const FOnTranslationError& OnError, const ParseFunctionType& Parse)
+{
+	const uint32 Group = FTranslationRequestScheduler::Get().GetCurrentRequestGroup();
+	const ETranslationRequestPriority Priority = FTranslationRequestScheduler::Get().GetCurrentPriority();
+	const uint32 TraceBatch = FLanguageOneTrace::GetCurrentBatch();
+	TDelegate<void(const ResultType&)> OnParsed = DeferToGameThread(OnComplete, Group, Priority, TraceBatch);
+	FOnTranslationError OnParseFailed = DeferToGameThread(OnError, Group, Priority, TraceBatch);
+
+	FTranslationResultQueue::Get().Launch([Parse, Response, bSuccess, OnParsed, OnParseFailed]()
+	{
+		Parse(Response, bSuccess, OnParsed, OnParseFailed);
+	});
+}
+
+// 请求完成回调：响应交给 ParseResponseAsync 在工作线程解析
+template <typename ResultType, typename ParseFunctionType>
+static FHttpRequestCompleteDelegate MakeAsyncParseHandler(const TDelegate<void(const ResultType&)>& OnComplete, const FOnTranslationError& OnError, ParseFunctionType Parse)
+{
+	return FHttpRequestCompleteDelegate::CreateLambda([OnComplete, OnError, Parse](FHttpRequestPtr Request, FHttpResponsePtr Response, bool bSuccess)
+	{
+		ParseResponseAsync(Response, bSuccess, OnComplete, OnError, Parse);
+	});
+}
+
+// 把批量接口的结果转换为单条翻译回调
+static FOnBatchTranslationComplete MakeSingleResultHandler(FOnTranslationComplete OnComplete, FOnTranslationError OnError)
+{
+	return FOnBatchTranslationComplete::CreateLambda([OnComplete, OnError](const TArray<FString>& Translations)
+	{
+		if (Translations.Num() > 0 && !Translations[0].IsEmpty())
+		{
+			OnComplete.ExecuteIfBound(Translations[0]);
+		}
+		else
+		{
+			OnError.ExecuteIfBound(TEXT("未找到翻译结果 | No translation result found"));
+		}
+	});
+}
+
 void FCommentTranslator::TranslateText(const FString& SourceText, FOnTranslationComplete OnComplete, FOnTranslationError OnError)
 {
 	if (SourceText.IsEmpty())
@@ -25,9 +110,262 @@ void FCommentTranslator::TranslateText(const FString& SourceText, FOnTranslation
 		return;
 	}
 
-	FString TargetLang = GetLanguageCode();
+	// 相同的翻译正在进行：等待同一个结果，不再发送重复请求
+	using namespace LanguageOneCommentTranslator;
+	const TArray<ETranslateProvider> Chain = GetProviderChain();
+	const FString InFlightKey = MakeInFlightKey(Chain[0], GetLanguageCode(Chain[0]), SourceText);
+	if (TArray<FTranslationWaiter>* Waiters = InFlightTranslations.Find(InFlightKey))
+	{
+		Waiters->Add({ OnComplete, OnError });
+		UE_LOG(LogTemp, Verbose, TEXT("Coalesced translation request with %d waiting callers"), Waiters->Num());
+		return;
+	}
+	InFlightTranslations.Add(InFlightKey).Add({ OnComplete, OnError });
+
+	// 先移除再回调，回调中再次请求同一文本时会重新发送
+	FOnTranslationComplete OnSharedComplete = FOnTranslationComplete::CreateLambda([InFlightKey](const FString& TranslatedText)
+	{
+		TArray<FTranslationWaiter> Waiters;
+		InFlightTranslations.RemoveAndCopyValue(InFlightKey, Waiters);
+		for (const FTranslationWaiter& Waiter : Waiters)
+		{
+			Waiter.OnComplete.ExecuteIfBound(TranslatedText);
+		}
+	});
+	FOnTranslationError OnSharedError = FOnTranslationError::CreateLambda([InFlightKey](const FString& ErrorMessage)
+	{
+		TArray<FTranslationWaiter> Waiters;
+		InFlightTranslations.RemoveAndCopyValue(InFlightKey, Waiters);
+		for (const FTranslationWaiter& Waiter : Waiters)
+		{
+			Waiter.OnError.ExecuteIfBound(ErrorMessage);
+		}
+	});
+
+	// 交互翻译更在意最慢的那次：对冲请求，并设置截止时间
+	if (FTranslationRequestScheduler::Get().GetCurrentPriority() == ETranslationRequestPriority::Interactive
+		&& (Settings->bHedgeInteractiveRequests || Settings->InteractiveDeadlineSeconds > 0.0f))
+	{
+		TranslateHedged(Chain, SourceText, OnSharedComplete, OnSharedError);
+		return;
+	}
+
+	TranslateWithFailover(Chain, 0, SourceText, OnSharedComplete, OnSharedError);
+}
+
+void FCommentTranslator::TranslateHedged(const TArray<ETranslateProvider>& Chain, const FString& SourceText, FOnTranslationComplete OnComplete, FOnTranslationError OnError)
+{
+	const ULanguageOneSettings* Settings = GetDefault<ULanguageOneSettings>();
+	FTranslationRequestScheduler& Scheduler = FTranslationRequestScheduler::Get();
+	const bool bHedge = Settings->bHedgeInteractiveRequests && Chain.Num() > 1;
 
-	switch (Settings->TranslateProvider)
+	// 对冲状态：先到的结果生效，之后的回调全部忽略
+	struct FHedgeState
+	{
+		bool bFinished = false;
+		bool bHedgeStarted = false;
+		int32 PendingLegs = 0;
+
+		/** 每路请求使用单独的请求组，结束时取消未完成的一路 */
+		uint32 PrimaryGroup = 0;
+		uint32 HedgeGroup = 0;
+
+		FTSTicker::FDelegateHandle HedgeTimer;
+		FTSTicker::FDelegateHandle DeadlineTimer;
+		FString LastError;
+		FOnTranslationComplete OnComplete;
+		FOnTranslationError OnError;
+
+		static void RemoveTimer(FTSTicker::FDelegateHandle& Timer)
+		{
+			if (Timer.IsValid())
+			{
+				FTSTicker::GetCoreTicker().RemoveTicker(Timer);
+				Timer.Reset();
+			}
+		}
+
+		void Finish()
+		{
+			bFinished = true;
+			RemoveTimer(HedgeTimer);
+			RemoveTimer(DeadlineTimer);
+
+			FTranslationRequestScheduler& RequestScheduler = FTranslationRequestScheduler::Get();
+			const int32 CancelledCount = RequestScheduler.CancelRequestGroup(PrimaryGroup) + RequestScheduler.CancelRequestGroup(HedgeGroup);
+			if (CancelledCount > 0)
+			{
+				UE_LOG(LogTemp, Log, TEXT("Hedged translation finished, cancelled %d outstanding requests"), CancelledCount);
+			}
+		}
+
+		void FailLeg(const FString& ErrorMessage)
+		{
+			if (bFinished)
+			{
+				return;
+			}
+
+			LastError = ErrorMessage;
+			if (--PendingLegs == 0)
+			{
+				Finish();
+				OnError.ExecuteIfBound(LastError);
+			}
+		}
+	};
+
+	TSharedRef<FHedgeState> State = MakeShared<FHedgeState>();
+	State->PrimaryGroup = Scheduler.AllocateRequestGroup();
+	State->HedgeGroup = bHedge ? Scheduler.AllocateRequestGroup() : 0;
+	State->OnComplete = OnComplete;
+	State->OnError = OnError;
+
+	FOnTranslationComplete OnLegComplete = FOnTranslationComplete::CreateLambda([State](const FString& TranslatedText)
+	{
+		if (!State->bFinished)
+		{
+			State->Finish();
+			State->OnComplete.ExecuteIfBound(TranslatedText);
+		}
+	});
+
+	// 对冲请求：发给首选服务之后的服务（保留故障转移）；在定时器中发出时恢复交互优先级
+	TArray<ETranslateProvider> HedgeChain = Chain;
+	HedgeChain.RemoveAt(0);
+	auto StartHedge = [State, HedgeChain, SourceText, OnLegComplete]()
+	{
+		if (State->bFinished || State->bHedgeStarted)
+		{
+			return;
+		}
+		State->bHedgeStarted = true;
+		State->PendingLegs++;
+
+		FTranslationRequestScheduler::FScopedRequestGroup GroupScope(State->HedgeGroup);
+		FTranslationRequestScheduler::FScopedRequestPriority PriorityScope(ETranslationRequestPriority::Interactive);
+		TranslateWithFailover(HedgeChain, 0, SourceText, OnLegComplete, FOnTranslationError::CreateLambda([State](const FString& ErrorMessage)
+		{
+			State->FailLeg(ErrorMessage);
+		}));
+	};
+
+	// 首选请求：对冲时只使用首选服务，失败后立即发出对冲请求；不对冲时使用完整的故障转移链
+	{
+		TArray<ETranslateProvider> PrimaryChain = Chain;
+		if (bHedge)
+		{
+			PrimaryChain.SetNum(1);
+		}
+
+		State->PendingLegs++;
+		FTranslationRequestScheduler::FScopedRequestGroup GroupScope(State->PrimaryGroup);
+		TranslateWithFailover(PrimaryChain, 0, SourceText, OnLegComplete, FOnTranslationError::CreateLambda([State, StartHedge, bHedge](const FString& ErrorMessage)
+		{
+			if (bHedge && !State->bFinished && !State->bHedgeStarted)
+			{
+				State->LastError = ErrorMessage;
+				State->PendingLegs--;
+				StartHedge();
+				return;
+			}
+			State->FailLeg(ErrorMessage);
+		}));
+	}
+
+	// 翻译记忆库命中或同步失败时已经结束
+	if (State->bFinished)
+	{
+		return;
+	}
+
+	if (bHedge)
+	{
+		// 对冲延迟：首选服务最近成功请求耗时的分位数，样本不足时使用默认延迟
+		double HedgeDelaySeconds = Settings->HedgeFallbackDelaySeconds;
+		FProviderRouter::Get().GetLatencyPercentile(Chain[0], Settings->HedgeLatencyPercentile, HedgeDelaySeconds);
+
+		State->HedgeTimer = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateLambda([State, StartHedge, HedgeDelaySeconds, Chain](float DeltaTime)
+		{
+			State->HedgeTimer.Reset();
+			if (!State->bFinished && !State->bHedgeStarted)
+			{
+				UE_LOG(LogTemp, Log, TEXT("Provider %d has not answered within %.2fs, hedging with provider %d"), (int32)Chain[0], HedgeDelaySeconds, (int32)Chain[1]);
+				StartHedge();
+			}
+			return false;
+		}), (float)HedgeDelaySeconds);
+	}
+
+	const float DeadlineSeconds = Settings->InteractiveDeadlineSeconds;
+	if (DeadlineSeconds > 0.0f)
+	{
+		State->DeadlineTimer = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateLambda([State, DeadlineSeconds](float DeltaTime)
+		{
+			State->DeadlineTimer.Reset();
+			if (!State->bFinished)
+			{
+				State->Finish();
+				State->OnError.ExecuteIfBound(FString::Printf(TEXT("翻译超时（%.0f 秒内没有结果） | Translation timed out (no result within %.0f seconds)"), DeadlineSeconds, DeadlineSeconds));
+			}
+			return false;
+		}), DeadlineSeconds);
+	}
+}
+
+void FCommentTranslator::TranslateWithFailover(const TArray<ETranslateProvider>& Chain, int32 ChainIndex, const FString& SourceText, FOnTranslationComplete OnComplete, FOnTranslationError OnError)
+{
+	const ETranslateProvider Provider = Chain[ChainIndex];
+	const FString TargetLang = GetLanguageCode(Provider);
+	const bool bUseMemory = GetDefault<ULanguageOneSettings>()->bEnableTranslationMemory;
+
+	// 先查翻译记忆库，命中则不发送网络请求
+	if (bUseMemory)
+	{
+		FString CachedTranslation;
+		if (FTranslationMemory::Get().Find(Provider, TEXT("auto"), TargetLang, SourceText, CachedTranslation))
+		{
+			FTranslationRequestScheduler::Get().RecordCacheHits(1);
+			OnComplete.ExecuteIfBound(CachedTranslation);
+			return;
+		}
+	}
+
+	TranslateWithProvider(
+		Provider,
+		SourceText,
+		TargetLang,
+		FOnTranslationComplete::CreateLambda([OnComplete, Provider, TargetLang, SourceText, bUseMemory](const FString& TranslatedText)
+		{
+			// 成功后写入记忆库
+			if (bUseMemory)
+			{
+				FTranslationMemory::Get().Add(Provider, TEXT("auto"), TargetLang, SourceText, TranslatedText);
+			}
+			OnComplete.ExecuteIfBound(TranslatedText);
+		}),
+		FOnTranslationError::CreateLambda([Chain, ChainIndex, SourceText, OnComplete, OnError](const FString& ErrorMessage)
+		{
+			// 当前服务失败（已在调度器中重试过），切换到下一个服务；请求组已取消时直接失败
+			FTranslationRequestScheduler& Scheduler = FTranslationRequestScheduler::Get();
+			if (Chain.IsValidIndex(ChainIndex + 1) && !Scheduler.IsGroupCancelled(Scheduler.GetCurrentRequestGroup()))
+			{
+				UE_LOG(LogTemp, Warning, TEXT("Translation provider %d failed (%s), failing over to provider %d"),
+					(int32)Chain[ChainIndex], *ErrorMessage, (int32)Chain[ChainIndex + 1]);
+				TranslateWithFailover(Chain, ChainIndex + 1, SourceText, OnComplete, OnError);
+				return;
+			}
+
+			OnError.ExecuteIfBound(ErrorMessage);
+		})
+	);
+}
+
+void FCommentTranslator::TranslateWithProvider(ETranslateProvider Provider, const FString& SourceText, const FString& TargetLang, FOnTranslationComplete OnComplete, FOnTranslationError OnError)
+{
+	FTranslationRequestScheduler::Get().RecordCharactersSent(Provider, SourceText.Len());
+
+	switch (Provider)
 	{
 	case ETranslateProvider::GoogleFree:
 		TranslateWithGoogleFree(SourceText, TargetLang, OnComplete, OnError);
@@ -53,23 +391,390 @@ void FCommentTranslator::TranslateText(const FString& SourceText, FOnTranslation
 	}
 }
 
+TArray<ETranslateProvider> FCommentTranslator::GetProviderChain()
+{
+	const ULanguageOneSettings* Settings = GetDefault<ULanguageOneSettings>();
+
+	// 自适应路由：按最近的耗时和失败率排列路由服务，首选服务和备用服务排在后面
+	TArray<ETranslateProvider> Chain;
+	if (Settings->bAdaptiveRouting)
+	{
+		Chain = FProviderRouter::Get().RankProviders(FTranslationRequestScheduler::Get().GetCurrentPriority());
+	}
+
+	// 首选服务在前，备用服务按设置顺序排列（去重）
+	Chain.AddUnique(Settings->TranslateProvider);
+	for (ETranslateProvider Provider : Settings->FailoverProviders)
+	{
+		Chain.AddUnique(Provider);
+	}
+
+	// 没有设置备用服务时，只有免费服务在免费服务之间切换；付费和自定义服务的文本不发送到用户没有选择的公共服务
+	if (Settings->FailoverProviders.Num() == 0 && !FProviderRouter::IsPaidProvider(Settings->TranslateProvider))
+	{
+		Chain.AddUnique(ETranslateProvider::MicrosoftFree);
+		Chain.AddUnique(ETranslateProvider::GoogleFree);
+		Chain.AddUnique(ETranslateProvider::YoudaoFree);
+	}
+	return Chain;
+}
+
+void FCommentTranslator::TranslateTexts(const TArray<FString>& SourceTexts, FOnBatchTranslationComplete OnComplete, FOnTranslationError OnError)
+{
+	if (SourceTexts.Num() == 0)
+	{
+		OnComplete.ExecuteIfBound(TArray<FString>());
+		return;
+	}
+
+	const ULanguageOneSettings* Settings = GetDefault<ULanguageOneSettings>();
+	if (!Settings)
+	{
+		OnError.ExecuteIfBound(TEXT("无法获取设置 | Cannot get settings"));
+		return;
+	}
+
+	const TArray<ETranslateProvider> Chain = GetProviderChain();
+	const ETranslateProvider Provider = Chain[0];
+	const FString TargetLang = GetLanguageCode(Provider);
+	const bool bUseMemory = Settings->bEnableTranslationMemory;
+
+	// 批量翻译状态：所有子请求完成后统一回调
+	struct FBatchState
+	{
+		TArray<FString> Translations;
+		int32 PendingRequests = 0;
+		int32 SuccessCount = 0;
+		int32 FailedCount = 0;
+		FString LastError = TEXT("未找到翻译结果 | No translation result found");
+		FOnBatchTranslationComplete OnComplete;
+		FOnTranslationError OnError;
+
+		void FinishRequest()
+		{
+			if (--PendingRequests > 0)
+			{
+				return;
+			}
+
+			if (SuccessCount == 0 && FailedCount > 0)
+			{
+				OnError.ExecuteIfBound(LastError);
+			}
+			else
+			{
+				OnComplete.ExecuteIfBound(Translations);
+			}
+		}
+	};
+
+	TSharedPtr<FBatchState> State = MakeShared<FBatchState>();
+	State->Translations.SetNum(SourceTexts.Num());
+	State->OnComplete = OnComplete;
+	State->OnError = OnError;
+
+	// 先查翻译记忆库，只请求未命中的文本
+	TArray<int32> MissIndices;
+	for (int32 i = 0; i < SourceTexts.Num(); i++)
+	{
+		if (SourceTexts[i].IsEmpty())
+		{
+			continue;
+		}
+
+		if (bUseMemory && FTranslationMemory::Get().Find(Provider, TEXT("auto"), TargetLang, SourceTexts[i], State->Translations[i]))
+		{
+			State->SuccessCount++;
+			continue;
+		}
+
+		MissIndices.Add(i);
+	}
+	FTranslationRequestScheduler::Get().RecordCacheHits(State->SuccessCount);
+
+	// 占位计数，保证所有请求发出前不会提前回调
+	State->PendingRequests = 1;
+
+	// 首选服务翻译失败的文本逐条交给备用服务（调用方随后调用 FinishRequest）
+	auto TranslateWithFallback = [State, Chain](int32 Index, const FString& SourceText, const FString& ErrorMessage)
+	{
+		FTranslationRequestScheduler& Scheduler = FTranslationRequestScheduler::Get();
+		if (Chain.Num() < 2 || Scheduler.IsGroupCancelled(Scheduler.GetCurrentRequestGroup()))
+		{
+			State->LastError = ErrorMessage;
+			State->FailedCount++;
+			return;
+		}
+
+		State->PendingRequests++;
+		TranslateWithFailover(
+			Chain,
+			1,
+			SourceText,
+			FOnTranslationComplete::CreateLambda([State, Index](const FString& TranslatedText)
+			{
+				State->Translations[Index] = TranslatedText;
+				State->SuccessCount++;
+				State->FinishRequest();
+			}),
+			FOnTranslationError::CreateLambda([State](const FString& FallbackError)
+			{
+				State->LastError = FallbackError;
+				State->FailedCount++;
+				State->FinishRequest();
+			})
+		);
+	};
+
+	const bool bSupportsBatch = Provider == ETranslateProvider::MicrosoftFree
+		|| Provider == ETranslateProvider::Google
+		|| Provider == ETranslateProvider::Baidu
+		|| (Provider == ETranslateProvider::Custom && Settings->bCustomApiSupportsBatch);
+
+	if (!bSupportsBatch)
+	{
+		// 不支持批量的服务逐条翻译
+		for (int32 Index : MissIndices)
+		{
+			const FString& SourceText = SourceTexts[Index];
+			State->PendingRequests++;
+			TranslateWithProvider(
+				Provider,
+				SourceText,
+				TargetLang,
+				FOnTranslationComplete::CreateLambda([State, Index, SourceText, Provider, TargetLang, bUseMemory](const FString& TranslatedText)
+				{
+					State->Translations[Index] = TranslatedText;
+					State->SuccessCount++;
+					if (bUseMemory)
+					{
+						FTranslationMemory::Get().Add(Provider, TEXT("auto"), TargetLang, SourceText, TranslatedText);
+					}
+					State->FinishRequest();
+				}),
+				FOnTranslationError::CreateLambda([State, Index, SourceText, TranslateWithFallback](const FString& ErrorMessage)
+				{
+					TranslateWithFallback(Index, SourceText, ErrorMessage);
+					State->FinishRequest();
+				})
+			);
+		}
+
+		State->FinishRequest();
+		return;
+	}
+
+	// 按服务的数量和长度限制分组，每组一个请求
+	TArray<FString> MissTexts;
+	MissTexts.Reserve(MissIndices.Num());
+	for (int32 Index : MissIndices)
+	{
+		MissTexts.Add(SourceTexts[Index]);
+	}
+
+	TArray<TArray<int32>> Batches;
+	SplitIntoBatches(Provider, MissTexts, Batches);
+
+	for (const TArray<int32>& Batch : Batches)
+	{
+		TArray<FString> BatchTexts;
+		TArray<int32> BatchIndices;
+		BatchTexts.Reserve(Batch.Num());
+		BatchIndices.Reserve(Batch.Num());
+		int32 BatchChars = 0;
+		for (int32 MissIndex : Batch)
+		{
+			BatchTexts.Add(MissTexts[MissIndex]);
+			BatchIndices.Add(MissIndices[MissIndex]);
+			BatchChars += MissTexts[MissIndex].Len();
+		}
+		FTranslationRequestScheduler::Get().RecordCharactersSent(Provider, BatchChars);
+
+		FOnBatchTranslationComplete OnBatchComplete = FOnBatchTranslationComplete::CreateLambda(
+			[State, BatchTexts, BatchIndices, Provider, TargetLang, bUseMemory, TranslateWithFallback](const TArray<FString>& Translations)
+			{
+				// 按索引把结果映射回原始位置
+				for (int32 i = 0; i < BatchIndices.Num(); i++)
+				{
+					if (!Translations.IsValidIndex(i) || Translations[i].IsEmpty())
+					{
+						TranslateWithFallback(BatchIndices[i], BatchTexts[i], TEXT("未找到翻译结果 | No translation result found"));
+						continue;
+					}
+
+					State->Translations[BatchIndices[i]] = Translations[i];
+					State->SuccessCount++;
+
+					if (bUseMemory)
+					{
+						FTranslationMemory::Get().Add(Provider, TEXT("auto"), TargetLang, BatchTexts[i], Translations[i]);
+					}
+				}
+
+				State->FinishRequest();
+			});
+
+		FOnTranslationError OnBatchError = FOnTranslationError::CreateLambda([State, BatchTexts, BatchIndices, TranslateWithFallback](const FString& ErrorMessage)
+		{
+			// 请求组已取消时是调用方主动放弃，不输出错误
+			FTranslationRequestScheduler& Scheduler = FTranslationRequestScheduler::Get();
+			if (!Scheduler.IsGroupCancelled(Scheduler.GetCurrentRequestGroup()))
+			{
+				UE_LOG(LogTemp, Error, TEXT("Batch translation request failed (%d texts): %s"), BatchTexts.Num(), *ErrorMessage);
+			}
+			for (int32 i = 0; i < BatchIndices.Num(); i++)
+			{
+				TranslateWithFallback(BatchIndices[i], BatchTexts[i], ErrorMessage);
+			}
+			State->FinishRequest();
+		});
+
+		State->PendingRequests++;
+		switch (Provider)
+		{
+		case ETranslateProvider::MicrosoftFree:
+			TranslateBatchWithMicrosoftFree(BatchTexts, TargetLang, OnBatchComplete, OnBatchError);
+			break;
+		case ETranslateProvider::Baidu:
+			TranslateBatchWithBaidu(BatchTexts, TargetLang, OnBatchComplete, OnBatchError);
+			break;
+		case ETranslateProvider::Google:
+			TranslateBatchWithGoogle(BatchTexts, TargetLang, OnBatchComplete, OnBatchError);
+			break;
+		case ETranslateProvider::Custom:
+			TranslateBatchWithCustom(BatchTexts, TargetLang, OnBatchComplete, OnBatchError);
+			break;
+		default:
+			OnBatchError.ExecuteIfBound(TEXT("未知的翻译服务商 | Unknown translation provider"));
+			break;
+		}
+	}
+
+	State->FinishRequest();
+}
+
+int32 FCommentTranslator::GetMaxBatchSize(ETranslateProvider Provider)
+{
+	int32 MaxTexts = 1;
+	int32 MaxChars = 0;
+	GetBatchLimits(Provider, MaxTexts, MaxChars);
+	return MaxTexts;
+}
+
+FString FCommentTranslator::ResolveProviderUrl(ETranslateProvider Provider, const FString& DefaultUrl)
+{
+	const FString* Override = GetDefault<ULanguageOneSettings>()->ProviderBaseUrlOverrides.Find(Provider);
+	if (!Override || Override->IsEmpty())
+	{
+		return DefaultUrl;
+	}
+
+	// 保留 DefaultUrl 中主机之后的路径和参数
+	FString PathAndQuery;
+	const int32 SchemeEnd = DefaultUrl.Find(TEXT("://"));
+	if (SchemeEnd != INDEX_NONE)
+	{
+		const int32 PathStart = DefaultUrl.Find(TEXT("/"), ESearchCase::CaseSensitive, ESearchDir::FromStart, SchemeEnd + 3);
+		if (PathStart != INDEX_NONE)
+		{
+			PathAndQuery = DefaultUrl.Mid(PathStart);
+		}
+	}
+
+	FString BaseUrl = *Override;
+	BaseUrl.RemoveFromEnd(TEXT("/"));
+	return BaseUrl + PathAndQuery;
+}
+
+void FCommentTranslator::GetBatchLimits(ETranslateProvider Provider, int32& OutMaxTexts, int32& OutMaxChars)
+{
+	switch (Provider)
+	{
+	case ETranslateProvider::MicrosoftFree:
+		// 微软：每次最多 100 条，总长度不超过 50000 字符
+		OutMaxTexts = 100;
+		OutMaxChars = 50000;
+		break;
+	case ETranslateProvider::Google:
+		// Google v2：每次最多 128 个 q，建议不超过 5000 字符
+		OutMaxTexts = 128;
+		OutMaxChars = 5000;
+		break;
+	case ETranslateProvider::Baidu:
+		// 百度：q 最多 6000 字节（UTF-8），中文按 3 字节估算
+		OutMaxTexts = 100;
+		OutMaxChars = 2000;
+		break;
+	case ETranslateProvider::Custom:
+		OutMaxTexts = 100;
+		OutMaxChars = 50000;
+		break;
+	default:
+		// 不支持批量
+		OutMaxTexts = 1;
+		OutMaxChars = 0;
+		break;
+	}
+}
+
+void FCommentTranslator::SplitIntoBatches(ETranslateProvider Provider, const TArray<FString>& SourceTexts, TArray<TArray<int32>>& OutBatches)
+{
+	int32 MaxTexts = 1;
+	int32 MaxChars = 0;
+	GetBatchLimits(Provider, MaxTexts, MaxChars);
+
+	TArray<int32> CurrentBatch;
+	int32 CurrentChars = 0;
+
+	for (int32 i = 0; i < SourceTexts.Num(); i++)
+	{
+		const FString& Text = SourceTexts[i];
+
+		// 百度按行拆分结果，包含换行的文本必须单独成批
+		if (Provider == ETranslateProvider::Baidu && (Text.Contains(TEXT("\n")) || Text.Contains(TEXT("\r"))))
+		{
+			OutBatches.Add({ i });
+			continue;
+		}
+
+		if (CurrentBatch.Num() > 0 && (CurrentBatch.Num() >= MaxTexts || CurrentChars + Text.Len() > MaxChars))
+		{
+			OutBatches.Add(MoveTemp(CurrentBatch));
+			CurrentBatch.Reset();
+			CurrentChars = 0;
+		}
+
+		CurrentBatch.Add(i);
+		CurrentChars += Text.Len();
+	}
+
+	if (CurrentBatch.Num() > 0)
+	{
+		OutBatches.Add(MoveTemp(CurrentBatch));
+	}
+}
+
 void FCommentTranslator::TranslateWithGoogleFree(const FString& SourceText, const FString& TargetLang, FOnTranslationComplete OnComplete, FOnTranslationError OnError)
 {
+	LANGUAGEONE_TRACE_SCOPE("LanguageOne::BuildRequest");
+
 	// 使用 Google Translate 的免费接口（通过 translate.googleapis.com 的公开端点）
 	// 注意：这个接口不稳定，可能随时失效
 	FString EncodedText = LANGUAGEONE_URL_ENCODE(SourceText);
-	FString Url = FString::Printf(TEXT("https://translate.googleapis.com/translate_a/single?client=gtx&sl=auto&tl=%s&dt=t&q=%s"),
-		*TargetLang, *EncodedText);
+	FString Url = ResolveProviderUrl(ETranslateProvider::GoogleFree, FString::Printf(TEXT("https://translate.googleapis.com/translate_a/single?client=gtx&sl=auto&tl=%s&dt=t&q=%s"),
+		*TargetLang, *EncodedText));
 
 	TSharedRef<IHttpRequest, ESPMode::ThreadSafe> HttpRequest = FHttpModule::Get().CreateRequest();
 	HttpRequest->SetURL(Url);
 	HttpRequest->SetVerb(TEXT("GET"));
 	HttpRequest->SetHeader(TEXT("User-Agent"), TEXT("Mozilla/5.0"));
-	HttpRequest->OnProcessRequestComplete().BindLambda([OnComplete, OnError](FHttpRequestPtr Request, FHttpResponsePtr Response, bool bSuccess)
+	HttpRequest->OnProcessRequestComplete() = MakeAsyncParseHandler(OnComplete, OnError, [](FHttpResponsePtr Response, bool bSuccess, const FOnTranslationComplete& OnParsed, const FOnTranslationError& OnParseFailed)
 	{
+		LANGUAGEONE_TRACE_SCOPE("LanguageOne::ParseResponse");
+
 		if (!bSuccess || !Response.IsValid())
 		{
-			OnError.ExecuteIfBound(TEXT("网络请求失败 | Network request failed"));
+			OnParseFailed.ExecuteIfBound(TEXT("网络请求失败 | Network request failed"));
 			return;
 		}
 
@@ -81,7 +786,7 @@ void FCommentTranslator::TranslateWithGoogleFree(const FString& SourceText, cons
 
 		if (!FJsonSerializer::Deserialize(Reader, JsonValue) || !JsonValue.IsValid())
 		{
-			OnError.ExecuteIfBound(TEXT("解析响应失败 | Failed to parse response"));
+			OnParseFailed.ExecuteIfBound(TEXT("解析响应失败 | Failed to parse response"));
 			return;
 		}
 
@@ -108,125 +813,161 @@ void FCommentTranslator::TranslateWithGoogleFree(const FString& SourceText, cons
 				
 				if (!TranslatedText.IsEmpty())
 				{
-					OnComplete.ExecuteIfBound(TranslatedText);
+					OnParsed.ExecuteIfBound(TranslatedText);
 					return;
 				}
 			}
 		}
 
-		OnError.ExecuteIfBound(TEXT("未找到翻译结果 | No translation result found"));
+		OnParseFailed.ExecuteIfBound(TEXT("未找到翻译结果 | No translation result found"));
 	});
 
-	HttpRequest->ProcessRequest();
+	FTranslationRequestScheduler::Get().Enqueue(ETranslateProvider::GoogleFree, HttpRequest);
 }
 
 void FCommentTranslator::TranslateWithMicrosoftFree(const FString& SourceText, const FString& TargetLang, FOnTranslationComplete OnComplete, FOnTranslationError OnError)
+{
+	TranslateBatchWithMicrosoftFree({ SourceText }, TargetLang, MakeSingleResultHandler(OnComplete, OnError), OnError);
+}
+
+void FCommentTranslator::TranslateBatchWithMicrosoftFree(const TArray<FString>& SourceTexts, const FString& TargetLang, FOnBatchTranslationComplete OnComplete, FOnTranslationError OnError)
 {
 	// 使用 Microsoft Edge 浏览器内置翻译接口（无需 Key，免费且稳定）
 	// 这是目前最推荐的免费方案，支持多语言，速度快
 	
 	// 第一步：获取 Authorization Token
-	// 这个 Token 是动态的，必须每次（或定期）获取
-	FString AuthUrl = TEXT("https://edge.microsoft.com/translate/auth");
+	// Token 由 FMicrosoftAuthTokenManager 缓存到过期前，并发请求共享同一次刷新
+	// Token 可能异步返回：保存请求组、优先级和追踪批次，在回调中恢复
+	const uint32 Group = FTranslationRequestScheduler::Get().GetCurrentRequestGroup();
+	const ETranslationRequestPriority Priority = FTranslationRequestScheduler::Get().GetCurrentPriority();
+	const uint32 TraceBatch = FLanguageOneTrace::GetCurrentBatch();
+	FMicrosoftAuthTokenManager::Get().RequestToken(
+		FOnMicrosoftAuthTokenReady::CreateLambda([SourceTexts, TargetLang, OnComplete, OnError, Group, Priority, TraceBatch](const FString& Token)
+		{
+			FTranslationRequestScheduler::FScopedRequestGroup GroupScope(Group);
+			FTranslationRequestScheduler::FScopedRequestPriority PriorityScope(Priority);
+			FLanguageOneTrace::FScopedBatch BatchScope(TraceBatch);
+
+			// 第二步：使用 Token 调用翻译接口
+			SendMicrosoftTranslateRequest(SourceTexts, TargetLang, Token, true, OnComplete, OnError);
+		}),
+		OnError
+	);
+}
+
+void FCommentTranslator::SendMicrosoftTranslateRequest(const TArray<FString>& SourceTexts, const FString& TargetLang, const FString& Token, bool bRetryOnUnauthorized, FOnBatchTranslationComplete OnComplete, FOnTranslationError OnError)
+{
+	LANGUAGEONE_TRACE_SCOPE("LanguageOne::BuildRequest");
+
+	// Edge API 需要特定的语言代码格式 (例如中文必须是 zh-Hans)
+	FString EdgeTargetLang = TargetLang;
+	if (EdgeTargetLang == TEXT("zh") || EdgeTargetLang == TEXT("zh-CN")) EdgeTargetLang = TEXT("zh-Hans");
+	
+	// API URL
+	FString TranslateUrl = ResolveProviderUrl(ETranslateProvider::MicrosoftFree, FString::Printf(TEXT("https://api-edge.cognitive.microsofttranslator.com/translate?from=&to=%s&api-version=3.0&includeSentenceLength=true"), *EdgeTargetLang));
 	
-	TSharedRef<IHttpRequest, ESPMode::ThreadSafe> AuthRequest = FHttpModule::Get().CreateRequest();
-	AuthRequest->SetURL(AuthUrl);
-	AuthRequest->SetVerb(TEXT("GET"));
-	AuthRequest->SetHeader(TEXT("User-Agent"), TEXT("Mozilla/5.0 (Windows NT 10.0; Win64; x64) AppleWebKit/537.36 (KHTML, like Gecko) Chrome/120.0.0.0 Safari/537.36 Edg/120.0.0.0"));
+	TSharedRef<IHttpRequest, ESPMode::ThreadSafe> TransRequest = FHttpModule::Get().CreateRequest();
+	TransRequest->SetURL(TranslateUrl);
+	TransRequest->SetVerb(TEXT("POST"));
 	
-	AuthRequest->OnProcessRequestComplete().BindLambda([SourceText, TargetLang, OnComplete, OnError](FHttpRequestPtr Request, FHttpResponsePtr Response, bool bSuccess)
+	// 必须带上 Bearer Token
+	TransRequest->SetHeader(TEXT("Authorization"), FString::Printf(TEXT("Bearer %s"), *Token));
+	TransRequest->SetHeader(TEXT("Content-Type"), TEXT("application/json"));
+	TransRequest->SetHeader(TEXT("User-Agent"), TEXT("Mozilla/5.0 (Windows NT 10.0; Win64; x64) AppleWebKit/537.36 (KHTML, like Gecko) Chrome/120.0.0.0 Safari/537.36 Edg/120.0.0.0"));
+	
+	// 构造请求体 [{"Text": "..."}, {"Text": "..."}]（最多 100 条）
+	TArray<TSharedPtr<FJsonValue>> RequestArray;
+	for (const FString& SourceText : SourceTexts)
 	{
-		if (!bSuccess || !Response.IsValid())
-		{
-			OnError.ExecuteIfBound(TEXT("获取微软翻译授权失败，请检查网络 | Failed to get Microsoft auth"));
-			return;
-		}
-		
-		FString Token = Response->GetContentAsString();
-		if (Token.IsEmpty())
-		{
-			OnError.ExecuteIfBound(TEXT("获取到的微软授权Token为空 | Microsoft auth token is empty"));
-			return;
-		}
-		
-		// 第二步：使用 Token 调用翻译接口
-		// Edge API 需要特定的语言代码格式 (例如中文必须是 zh-Hans)
-		FString EdgeTargetLang = TargetLang;
-		if (EdgeTargetLang == TEXT("zh") || EdgeTargetLang == TEXT("zh-CN")) EdgeTargetLang = TEXT("zh-Hans");
-		
-		// API URL
-		FString TranslateUrl = FString::Printf(TEXT("https://api-edge.cognitive.microsofttranslator.com/translate?from=&to=%s&api-version=3.0&includeSentenceLength=true"), *EdgeTargetLang);
-		
-		TSharedRef<IHttpRequest, ESPMode::ThreadSafe> TransRequest = FHttpModule::Get().CreateRequest();
-		TransRequest->SetURL(TranslateUrl);
-		TransRequest->SetVerb(TEXT("POST"));
-		
-		// 必须带上 Bearer Token
-		TransRequest->SetHeader(TEXT("Authorization"), FString::Printf(TEXT("Bearer %s"), *Token));
-		TransRequest->SetHeader(TEXT("Content-Type"), TEXT("application/json"));
-		TransRequest->SetHeader(TEXT("User-Agent"), TEXT("Mozilla/5.0 (Windows NT 10.0; Win64; x64) AppleWebKit/537.36 (KHTML, like Gecko) Chrome/120.0.0.0 Safari/537.36 Edg/120.0.0.0"));
-		
-		// 构造请求体 [{"Text": "..."}]
 		TSharedPtr<FJsonObject> TextObj = MakeShareable(new FJsonObject);
 		TextObj->SetStringField(TEXT("Text"), SourceText);
-		TArray<TSharedPtr<FJsonValue>> RequestArray;
 		RequestArray.Add(MakeShareable(new FJsonValueObject(TextObj)));
+	}
+	
+	FString RequestBody;
+	TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&RequestBody);
+	FJsonSerializer::Serialize(RequestArray, Writer);
+	
+	TransRequest->SetContentAsString(RequestBody);
+	
+	TransRequest->OnProcessRequestComplete().BindLambda([SourceTexts, TargetLang, Token, bRetryOnUnauthorized, OnComplete, OnError](FHttpRequestPtr TransReq, FHttpResponsePtr TransResp, bool bTransSuccess)
+	{
+		if (!bTransSuccess || !TransResp.IsValid())
+		{
+			OnError.ExecuteIfBound(TEXT("微软翻译请求失败 | Microsoft Translation request failed"));
+			return;
+		}
 		
-		FString RequestBody;
-		TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&RequestBody);
-		FJsonSerializer::Serialize(RequestArray, Writer);
-		
-		TransRequest->SetContentAsString(RequestBody);
-		
-		TransRequest->OnProcessRequestComplete().BindLambda([OnComplete, OnError](FHttpRequestPtr TransReq, FHttpResponsePtr TransResp, bool bTransSuccess)
+		// Token 被拒绝（提前失效）：刷新一次后重试
+		if (TransResp->GetResponseCode() == EHttpResponseCodes::Denied)
 		{
-			if (!bTransSuccess || !TransResp.IsValid())
+			if (!bRetryOnUnauthorized)
 			{
-				OnError.ExecuteIfBound(TEXT("微软翻译请求失败 | Microsoft Translation request failed"));
+				OnError.ExecuteIfBound(TEXT("微软翻译授权无效 | Microsoft auth token rejected"));
 				return;
 			}
 			
-			FString TransRespStr = TransResp->GetContentAsString();
+			FMicrosoftAuthTokenManager::Get().Invalidate(Token);
+			const uint32 Group = FTranslationRequestScheduler::Get().GetCurrentRequestGroup();
+			const ETranslationRequestPriority Priority = FTranslationRequestScheduler::Get().GetCurrentPriority();
+			const uint32 TraceBatch = FLanguageOneTrace::GetCurrentBatch();
+			FMicrosoftAuthTokenManager::Get().RequestToken(
+				FOnMicrosoftAuthTokenReady::CreateLambda([SourceTexts, TargetLang, OnComplete, OnError, Group, Priority, TraceBatch](const FString& NewToken)
+				{
+					FTranslationRequestScheduler::FScopedRequestGroup GroupScope(Group);
+					FTranslationRequestScheduler::FScopedRequestPriority PriorityScope(Priority);
+					FLanguageOneTrace::FScopedBatch BatchScope(TraceBatch);
+					SendMicrosoftTranslateRequest(SourceTexts, TargetLang, NewToken, false, OnComplete, OnError);
+				}),
+				OnError
+			);
+			return;
+		}
+		
+		// 授权处理在游戏线程，响应解析在工作线程
+		const int32 TextCount = SourceTexts.Num();
+		ParseResponseAsync(TransResp, bTransSuccess, OnComplete, OnError, [TextCount](FHttpResponsePtr Response, bool bSuccess, const FOnBatchTranslationComplete& OnParsed, const FOnTranslationError& OnParseFailed)
+		{
+			LANGUAGEONE_TRACE_SCOPE("LanguageOne::ParseResponse");
+
+			FString TransRespStr = Response->GetContentAsString();
 			TArray<TSharedPtr<FJsonValue>> JsonArray;
 			TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(TransRespStr);
 			
 			if (!FJsonSerializer::Deserialize(Reader, JsonArray) || JsonArray.Num() == 0)
 			{
-				OnError.ExecuteIfBound(TEXT("解析微软翻译响应失败 | Failed to parse Microsoft response"));
+				OnParseFailed.ExecuteIfBound(TEXT("解析微软翻译响应失败 | Failed to parse Microsoft response"));
 				return;
 			}
 			
-			// 响应格式: [{"translations":[{"text":"..."}]}]
-			TSharedPtr<FJsonObject> FirstItem = JsonArray[0]->AsObject();
-			if (FirstItem.IsValid())
+			// 响应格式: [{"translations":[{"text":"..."}]}, ...]，顺序与请求一致
+			TArray<FString> Translations;
+			Translations.SetNum(TextCount);
+			for (int32 i = 0; i < TextCount && i < JsonArray.Num(); i++)
 			{
-				const TArray<TSharedPtr<FJsonValue>>* Translations;
-				if (FirstItem->TryGetArrayField(TEXT("translations"), Translations) && Translations->Num() > 0)
+				TSharedPtr<FJsonObject> Item = JsonArray[i]->AsObject();
+				const TArray<TSharedPtr<FJsonValue>>* ItemTranslations;
+				if (Item.IsValid() && Item->TryGetArrayField(TEXT("translations"), ItemTranslations) && ItemTranslations->Num() > 0)
 				{
-					TSharedPtr<FJsonObject> FirstTrans = (*Translations)[0]->AsObject();
+					TSharedPtr<FJsonObject> FirstTrans = (*ItemTranslations)[0]->AsObject();
 					if (FirstTrans.IsValid())
 					{
-						FString TranslatedText = FirstTrans->GetStringField(TEXT("text"));
-						if (!TranslatedText.IsEmpty())
-						{
-							OnComplete.ExecuteIfBound(TranslatedText);
-							return;
-						}
+						Translations[i] = FirstTrans->GetStringField(TEXT("text"));
 					}
 				}
 			}
 			
-			OnError.ExecuteIfBound(TEXT("未找到翻译结果 | No translation result found"));
+			OnParsed.ExecuteIfBound(Translations);
 		});
-		
-		TransRequest->ProcessRequest();
 	});
 	
-	AuthRequest->ProcessRequest();
+	FTranslationRequestScheduler::Get().Enqueue(ETranslateProvider::MicrosoftFree, TransRequest);
 }
 
 void FCommentTranslator::TranslateWithYoudaoFree(const FString& SourceText, const FString& TargetLang, FOnTranslationComplete OnComplete, FOnTranslationError OnError)
 {
+	LANGUAGEONE_TRACE_SCOPE("LanguageOne::BuildRequest");
+
 	// 使用 MyMemory 翻译 API（免费，无需密钥，作为备用）
 	// 注意：MyMemory 不支持 auto 源语言检测，需要手动检测
 	
@@ -264,17 +1005,19 @@ void FCommentTranslator::TranslateWithYoudaoFree(const FString& SourceText, cons
 	
 	FString EncodedText = LANGUAGEONE_URL_ENCODE(SourceText);
 	// 使用 langpair=source|target 格式
-	FString Url = FString::Printf(TEXT("https://api.mymemory.translated.net/get?q=%s&langpair=%s|%s"),
-		*EncodedText, *SourceLang, *TargetLang);
+	FString Url = ResolveProviderUrl(ETranslateProvider::YoudaoFree, FString::Printf(TEXT("https://api.mymemory.translated.net/get?q=%s&langpair=%s|%s"),
+		*EncodedText, *SourceLang, *TargetLang));
 
 	TSharedRef<IHttpRequest, ESPMode::ThreadSafe> HttpRequest = FHttpModule::Get().CreateRequest();
 	HttpRequest->SetURL(Url);
 	HttpRequest->SetVerb(TEXT("GET"));
-	HttpRequest->OnProcessRequestComplete().BindLambda([OnComplete, OnError](FHttpRequestPtr Request, FHttpResponsePtr Response, bool bSuccess)
+	HttpRequest->OnProcessRequestComplete() = MakeAsyncParseHandler(OnComplete, OnError, [](FHttpResponsePtr Response, bool bSuccess, const FOnTranslationComplete& OnParsed, const FOnTranslationError& OnParseFailed)
 	{
+		LANGUAGEONE_TRACE_SCOPE("LanguageOne::ParseResponse");
+
 		if (!bSuccess || !Response.IsValid())
 		{
-			OnError.ExecuteIfBound(TEXT("网络请求失败 | Network request failed"));
+			OnParseFailed.ExecuteIfBound(TEXT("网络请求失败 | Network request failed"));
 			return;
 		}
 
@@ -284,7 +1027,7 @@ void FCommentTranslator::TranslateWithYoudaoFree(const FString& SourceText, cons
 
 		if (!FJsonSerializer::Deserialize(Reader, JsonObject) || !JsonObject.IsValid())
 		{
-			OnError.ExecuteIfBound(TEXT("解析响应失败 | Failed to parse response"));
+			OnParseFailed.ExecuteIfBound(TEXT("解析响应失败 | Failed to parse response"));
 			return;
 		}
 
@@ -297,7 +1040,7 @@ void FCommentTranslator::TranslateWithYoudaoFree(const FString& SourceText, cons
 				FString ErrorMsg = JsonObject->HasField(TEXT("responseDetails")) 
 					? JsonObject->GetStringField(TEXT("responseDetails"))
 					: TEXT("翻译服务返回错误 | Translation service error");
-				OnError.ExecuteIfBound(ErrorMsg);
+				OnParseFailed.ExecuteIfBound(ErrorMsg);
 				return;
 			}
 		}
@@ -309,19 +1052,26 @@ void FCommentTranslator::TranslateWithYoudaoFree(const FString& SourceText, cons
 			FString TranslatedText = ResponseData->GetStringField(TEXT("translatedText"));
 			if (!TranslatedText.IsEmpty())
 			{
-				OnComplete.ExecuteIfBound(TranslatedText);
+				OnParsed.ExecuteIfBound(TranslatedText);
 				return;
 			}
 		}
 
-		OnError.ExecuteIfBound(TEXT("未找到翻译结果 | No translation result found"));
+		OnParseFailed.ExecuteIfBound(TEXT("未找到翻译结果 | No translation result found"));
 	});
 
-	HttpRequest->ProcessRequest();
+	FTranslationRequestScheduler::Get().Enqueue(ETranslateProvider::YoudaoFree, HttpRequest);
 }
 
 void FCommentTranslator::TranslateWithBaidu(const FString& SourceText, const FString& TargetLang, FOnTranslationComplete OnComplete, FOnTranslationError OnError)
 {
+	TranslateBatchWithBaidu({ SourceText }, TargetLang, MakeSingleResultHandler(OnComplete, OnError), OnError);
+}
+
+void FCommentTranslator::TranslateBatchWithBaidu(const TArray<FString>& SourceTexts, const FString& TargetLang, FOnBatchTranslationComplete OnComplete, FOnTranslationError OnError)
+{
+	LANGUAGEONE_TRACE_SCOPE("LanguageOne::BuildRequest");
+
 	const ULanguageOneSettings* Settings = GetDefault<ULanguageOneSettings>();
 	
 	if (Settings->BaiduAppId.IsEmpty() || Settings->BaiduSecretKey.IsEmpty())
@@ -331,21 +1081,28 @@ void FCommentTranslator::TranslateWithBaidu(const FString& SourceText, const FSt
 	}
 
 	// 百度翻译 API: https://fanyi-api.baidu.com/api/trans/vip/translate
+	// 多条文本用换行符拼接，百度按行返回 trans_result
+	// 包含换行的文本由 SplitIntoBatches 单独成批，此时把所有行的译文拼接回去
+	FString Query = FString::Join(SourceTexts, TEXT("\n"));
 	FString Salt = FString::FromInt(FMath::Rand());
-	FString Sign = GenerateMD5(Settings->BaiduAppId + SourceText + Salt + Settings->BaiduSecretKey);
+	FString Sign = GenerateMD5(Settings->BaiduAppId + Query + Salt + Settings->BaiduSecretKey);
 	
-	FString EncodedText = LANGUAGEONE_URL_ENCODE(SourceText);
-	FString Url = FString::Printf(TEXT("https://fanyi-api.baidu.com/api/trans/vip/translate?q=%s&from=auto&to=%s&appid=%s&salt=%s&sign=%s"),
-		*EncodedText, *TargetLang, *Settings->BaiduAppId, *Salt, *Sign);
+	// 使用 POST 表单提交，避免批量文本超出 URL 长度限制
+	FString RequestBody = FString::Printf(TEXT("q=%s&from=auto&to=%s&appid=%s&salt=%s&sign=%s"),
+		*LANGUAGEONE_URL_ENCODE(Query), *TargetLang, *Settings->BaiduAppId, *Salt, *Sign);
 
 	TSharedRef<IHttpRequest, ESPMode::ThreadSafe> HttpRequest = FHttpModule::Get().CreateRequest();
-	HttpRequest->SetURL(Url);
-	HttpRequest->SetVerb(TEXT("GET"));
-	HttpRequest->OnProcessRequestComplete().BindLambda([OnComplete, OnError](FHttpRequestPtr Request, FHttpResponsePtr Response, bool bSuccess)
+	HttpRequest->SetURL(ResolveProviderUrl(ETranslateProvider::Baidu, TEXT("https://fanyi-api.baidu.com/api/trans/vip/translate")));
+	HttpRequest->SetVerb(TEXT("POST"));
+	HttpRequest->SetHeader(TEXT("Content-Type"), TEXT("application/x-www-form-urlencoded"));
+	HttpRequest->SetContentAsString(RequestBody);
+	HttpRequest->OnProcessRequestComplete() = MakeAsyncParseHandler(OnComplete, OnError, [SourceTexts](FHttpResponsePtr Response, bool bSuccess, const FOnBatchTranslationComplete& OnParsed, const FOnTranslationError& OnParseFailed)
 	{
+		LANGUAGEONE_TRACE_SCOPE("LanguageOne::ParseResponse");
+
 		if (!bSuccess || !Response.IsValid())
 		{
-			OnError.ExecuteIfBound(TEXT("网络请求失败 | Network request failed"));
+			OnParseFailed.ExecuteIfBound(TEXT("网络请求失败 | Network request failed"));
 			return;
 		}
 
@@ -355,7 +1112,7 @@ void FCommentTranslator::TranslateWithBaidu(const FString& SourceText, const FSt
 
 		if (!FJsonSerializer::Deserialize(Reader, JsonObject) || !JsonObject.IsValid())
 		{
-			OnError.ExecuteIfBound(TEXT("解析响应失败 | Failed to parse response"));
+			OnParseFailed.ExecuteIfBound(TEXT("解析响应失败 | Failed to parse response"));
 			return;
 		}
 
@@ -363,31 +1120,80 @@ void FCommentTranslator::TranslateWithBaidu(const FString& SourceText, const FSt
 		if (JsonObject->HasField(TEXT("error_code")))
 		{
 			FString ErrorMsg = JsonObject->GetStringField(TEXT("error_msg"));
-			OnError.ExecuteIfBound(FString::Printf(TEXT("百度翻译错误: %s | Baidu Translation Error: %s"), *ErrorMsg, *ErrorMsg));
+			OnParseFailed.ExecuteIfBound(FString::Printf(TEXT("百度翻译错误: %s | Baidu Translation Error: %s"), *ErrorMsg, *ErrorMsg));
 			return;
 		}
 
 		// 获取翻译结果
 		const TArray<TSharedPtr<FJsonValue>>* TransResults;
-		if (JsonObject->TryGetArrayField(TEXT("trans_result"), TransResults) && TransResults->Num() > 0)
+		if (!JsonObject->TryGetArrayField(TEXT("trans_result"), TransResults) || TransResults->Num() == 0)
 		{
-			TSharedPtr<FJsonObject> FirstResult = (*TransResults)[0]->AsObject();
-			if (FirstResult.IsValid())
+			OnParseFailed.ExecuteIfBound(TEXT("未找到翻译结果 | No translation result found"));
+			return;
+		}
+
+		TArray<FString> Translations;
+		Translations.SetNum(SourceTexts.Num());
+
+		if (SourceTexts.Num() == 1)
+		{
+			// 单条（可能多行）文本：拼接所有行的译文
+			TArray<FString> Lines;
+			for (const TSharedPtr<FJsonValue>& ResultValue : *TransResults)
 			{
-				FString TranslatedText = FirstResult->GetStringField(TEXT("dst"));
-				OnComplete.ExecuteIfBound(TranslatedText);
-				return;
+				TSharedPtr<FJsonObject> Result = ResultValue->AsObject();
+				if (Result.IsValid())
+				{
+					Lines.Add(Result->GetStringField(TEXT("dst")));
+				}
+			}
+			Translations[0] = FString::Join(Lines, TEXT("\n"));
+		}
+		else if (TransResults->Num() == SourceTexts.Num())
+		{
+			// 每行对应一条文本
+			for (int32 i = 0; i < SourceTexts.Num(); i++)
+			{
+				TSharedPtr<FJsonObject> Result = (*TransResults)[i]->AsObject();
+				if (Result.IsValid())
+				{
+					Translations[i] = Result->GetStringField(TEXT("dst"));
+				}
+			}
+		}
+		else
+		{
+			// 行数不一致（例如百度合并了空行），按原文匹配
+			TMap<FString, FString> TranslationBySource;
+			for (const TSharedPtr<FJsonValue>& ResultValue : *TransResults)
+			{
+				TSharedPtr<FJsonObject> Result = ResultValue->AsObject();
+				if (Result.IsValid())
+				{
+					TranslationBySource.Add(Result->GetStringField(TEXT("src")).TrimStartAndEnd(), Result->GetStringField(TEXT("dst")));
+				}
+			}
+			for (int32 i = 0; i < SourceTexts.Num(); i++)
+			{
+				Translations[i] = TranslationBySource.FindRef(SourceTexts[i].TrimStartAndEnd());
 			}
 		}
 
-		OnError.ExecuteIfBound(TEXT("未找到翻译结果 | No translation result found"));
+		OnParsed.ExecuteIfBound(Translations);
 	});
 
-	HttpRequest->ProcessRequest();
+	FTranslationRequestScheduler::Get().Enqueue(ETranslateProvider::Baidu, HttpRequest);
 }
 
 void FCommentTranslator::TranslateWithGoogle(const FString& SourceText, const FString& TargetLang, FOnTranslationComplete OnComplete, FOnTranslationError OnError)
 {
+	TranslateBatchWithGoogle({ SourceText }, TargetLang, MakeSingleResultHandler(OnComplete, OnError), OnError);
+}
+
+void FCommentTranslator::TranslateBatchWithGoogle(const TArray<FString>& SourceTexts, const FString& TargetLang, FOnBatchTranslationComplete OnComplete, FOnTranslationError OnError)
+{
+	LANGUAGEONE_TRACE_SCOPE("LanguageOne::BuildRequest");
+
 	const ULanguageOneSettings* Settings = GetDefault<ULanguageOneSettings>();
 	
 	if (Settings->GoogleApiKey.IsEmpty())
@@ -396,18 +1202,29 @@ void FCommentTranslator::TranslateWithGoogle(const FString& SourceText, const FS
 		return;
 	}
 
-	FString EncodedText = LANGUAGEONE_URL_ENCODE(SourceText);
-	FString Url = FString::Printf(TEXT("https://translation.googleapis.com/language/translate/v2?key=%s&q=%s&target=%s"),
-		*Settings->GoogleApiKey, *EncodedText, *TargetLang);
+	// Google v2 接受重复的 q 参数，结果按顺序返回
+	// 使用 POST 表单提交，避免批量文本超出 URL 长度限制
+	FString Url = ResolveProviderUrl(ETranslateProvider::Google, FString::Printf(TEXT("https://translation.googleapis.com/language/translate/v2?key=%s"), *Settings->GoogleApiKey));
+	FString RequestBody = FString::Printf(TEXT("target=%s&format=text"), *TargetLang);
+	for (const FString& SourceText : SourceTexts)
+	{
+		RequestBody += TEXT("&q=");
+		RequestBody += LANGUAGEONE_URL_ENCODE(SourceText);
+	}
 
 	TSharedRef<IHttpRequest, ESPMode::ThreadSafe> HttpRequest = FHttpModule::Get().CreateRequest();
 	HttpRequest->SetURL(Url);
 	HttpRequest->SetVerb(TEXT("POST"));
-	HttpRequest->OnProcessRequestComplete().BindLambda([OnComplete, OnError](FHttpRequestPtr Request, FHttpResponsePtr Response, bool bSuccess)
+	HttpRequest->SetHeader(TEXT("Content-Type"), TEXT("application/x-www-form-urlencoded"));
+	HttpRequest->SetContentAsString(RequestBody);
+	const int32 TextCount = SourceTexts.Num();
+	HttpRequest->OnProcessRequestComplete() = MakeAsyncParseHandler(OnComplete, OnError, [TextCount](FHttpResponsePtr Response, bool bSuccess, const FOnBatchTranslationComplete& OnParsed, const FOnTranslationError& OnParseFailed)
 	{
+		LANGUAGEONE_TRACE_SCOPE("LanguageOne::ParseResponse");
+
 		if (!bSuccess || !Response.IsValid())
 		{
-			OnError.ExecuteIfBound(TEXT("网络请求失败 | Network request failed"));
+			OnParseFailed.ExecuteIfBound(TEXT("网络请求失败 | Network request failed"));
 			return;
 		}
 
@@ -417,7 +1234,7 @@ void FCommentTranslator::TranslateWithGoogle(const FString& SourceText, const FS
 
 		if (!FJsonSerializer::Deserialize(Reader, JsonObject) || !JsonObject.IsValid())
 		{
-			OnError.ExecuteIfBound(TEXT("解析响应失败 | Failed to parse response"));
+			OnParseFailed.ExecuteIfBound(TEXT("解析响应失败 | Failed to parse response"));
 			return;
 		}
 
@@ -426,35 +1243,40 @@ void FCommentTranslator::TranslateWithGoogle(const FString& SourceText, const FS
 		{
 			TSharedPtr<FJsonObject> ErrorObj = JsonObject->GetObjectField(TEXT("error"));
 			FString ErrorMsg = ErrorObj->GetStringField(TEXT("message"));
-			OnError.ExecuteIfBound(FString::Printf(TEXT("Google 翻译错误: %s | Google Translation Error: %s"), *ErrorMsg, *ErrorMsg));
+			OnParseFailed.ExecuteIfBound(FString::Printf(TEXT("Google 翻译错误: %s | Google Translation Error: %s"), *ErrorMsg, *ErrorMsg));
 			return;
 		}
 
-		// 获取翻译结果
+		// 获取翻译结果 {"data":{"translations":[{"translatedText":"..."}, ...]}}
 		TSharedPtr<FJsonObject> DataObj = JsonObject->GetObjectField(TEXT("data"));
-		if (DataObj.IsValid())
+		const TArray<TSharedPtr<FJsonValue>>* ResultArray;
+		if (!DataObj.IsValid() || !DataObj->TryGetArrayField(TEXT("translations"), ResultArray) || ResultArray->Num() == 0)
+		{
+			OnParseFailed.ExecuteIfBound(TEXT("未找到翻译结果 | No translation result found"));
+			return;
+		}
+
+		TArray<FString> Translations;
+		Translations.SetNum(TextCount);
+		for (int32 i = 0; i < TextCount && i < ResultArray->Num(); i++)
 		{
-			const TArray<TSharedPtr<FJsonValue>>* Translations;
-			if (DataObj->TryGetArrayField(TEXT("translations"), Translations) && Translations->Num() > 0)
+			TSharedPtr<FJsonObject> Translation = (*ResultArray)[i]->AsObject();
+			if (Translation.IsValid())
 			{
-				TSharedPtr<FJsonObject> FirstTranslation = (*Translations)[0]->AsObject();
-				if (FirstTranslation.IsValid())
-				{
-					FString TranslatedText = FirstTranslation->GetStringField(TEXT("translatedText"));
-					OnComplete.ExecuteIfBound(TranslatedText);
-					return;
-				}
+				Translations[i] = Translation->GetStringField(TEXT("translatedText"));
 			}
 		}
 
-		OnError.ExecuteIfBound(TEXT("未找到翻译结果 | No translation result found"));
+		OnParsed.ExecuteIfBound(Translations);
 	});
 
-	HttpRequest->ProcessRequest();
+	FTranslationRequestScheduler::Get().Enqueue(ETranslateProvider::Google, HttpRequest);
 }
 
 void FCommentTranslator::TranslateWithCustom(const FString& SourceText, const FString& TargetLang, FOnTranslationComplete OnComplete, FOnTranslationError OnError)
 {
+	LANGUAGEONE_TRACE_SCOPE("LanguageOne::BuildRequest");
+
 	const ULanguageOneSettings* Settings = GetDefault<ULanguageOneSettings>();
 	
 	if (Settings->CustomApiUrl.IsEmpty())
@@ -473,7 +1295,7 @@ void FCommentTranslator::TranslateWithCustom(const FString& SourceText, const FS
 	FJsonSerializer::Serialize(RequestObj.ToSharedRef(), Writer);
 
 	TSharedRef<IHttpRequest, ESPMode::ThreadSafe> HttpRequest = FHttpModule::Get().CreateRequest();
-	HttpRequest->SetURL(Settings->CustomApiUrl);
+	HttpRequest->SetURL(ResolveProviderUrl(ETranslateProvider::Custom, Settings->CustomApiUrl));
 	HttpRequest->SetVerb(TEXT("POST"));
 	HttpRequest->SetHeader(TEXT("Content-Type"), TEXT("application/json"));
 	
@@ -483,11 +1305,13 @@ void FCommentTranslator::TranslateWithCustom(const FString& SourceText, const FS
 	}
 	
 	HttpRequest->SetContentAsString(RequestBody);
-	HttpRequest->OnProcessRequestComplete().BindLambda([OnComplete, OnError](FHttpRequestPtr Request, FHttpResponsePtr Response, bool bSuccess)
+	HttpRequest->OnProcessRequestComplete() = MakeAsyncParseHandler(OnComplete, OnError, [](FHttpResponsePtr Response, bool bSuccess, const FOnTranslationComplete& OnParsed, const FOnTranslationError& OnParseFailed)
 	{
+		LANGUAGEONE_TRACE_SCOPE("LanguageOne::ParseResponse");
+
 		if (!bSuccess || !Response.IsValid())
 		{
-			OnError.ExecuteIfBound(TEXT("网络请求失败 | Network request failed"));
+			OnParseFailed.ExecuteIfBound(TEXT("网络请求失败 | Network request failed"));
 			return;
 		}
 
@@ -497,7 +1321,7 @@ void FCommentTranslator::TranslateWithCustom(const FString& SourceText, const FS
 
 		if (!FJsonSerializer::Deserialize(Reader, JsonObject) || !JsonObject.IsValid())
 		{
-			OnError.ExecuteIfBound(TEXT("解析响应失败 | Failed to parse response"));
+			OnParseFailed.ExecuteIfBound(TEXT("解析响应失败 | Failed to parse response"));
 			return;
 		}
 
@@ -505,23 +1329,103 @@ void FCommentTranslator::TranslateWithCustom(const FString& SourceText, const FS
 		if (JsonObject->HasField(TEXT("translated_text")))
 		{
 			FString TranslatedText = JsonObject->GetStringField(TEXT("translated_text"));
-			OnComplete.ExecuteIfBound(TranslatedText);
+			OnParsed.ExecuteIfBound(TranslatedText);
 		}
 		else
 		{
-			OnError.ExecuteIfBound(TEXT("未找到翻译结果 | No translation result found"));
+			OnParseFailed.ExecuteIfBound(TEXT("未找到翻译结果 | No translation result found"));
 		}
 	});
 
-	HttpRequest->ProcessRequest();
+	FTranslationRequestScheduler::Get().Enqueue(ETranslateProvider::Custom, HttpRequest);
+}
+
+void FCommentTranslator::TranslateBatchWithCustom(const TArray<FString>& SourceTexts, const FString& TargetLang, FOnBatchTranslationComplete OnComplete, FOnTranslationError OnError)
+{
+	LANGUAGEONE_TRACE_SCOPE("LanguageOne::BuildRequest");
+
+	const ULanguageOneSettings* Settings = GetDefault<ULanguageOneSettings>();
+	
+	if (Settings->CustomApiUrl.IsEmpty())
+	{
+		OnError.ExecuteIfBound(TEXT("请先在编辑器设置中配置自定义 API 地址\nPlease configure Custom API URL in Editor Settings"));
+		return;
+	}
+
+	// 批量请求格式：{"texts": ["...", "..."], "target_lang": "..."}
+	TArray<TSharedPtr<FJsonValue>> TextArray;
+	for (const FString& SourceText : SourceTexts)
+	{
+		TextArray.Add(MakeShareable(new FJsonValueString(SourceText)));
+	}
+
+	TSharedPtr<FJsonObject> RequestObj = MakeShareable(new FJsonObject);
+	RequestObj->SetArrayField(TEXT("texts"), TextArray);
+	RequestObj->SetStringField(TEXT("target_lang"), TargetLang);
+
+	FString RequestBody;
+	TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&RequestBody);
+	FJsonSerializer::Serialize(RequestObj.ToSharedRef(), Writer);
+
+	TSharedRef<IHttpRequest, ESPMode::ThreadSafe> HttpRequest = FHttpModule::Get().CreateRequest();
+	HttpRequest->SetURL(ResolveProviderUrl(ETranslateProvider::Custom, Settings->CustomApiUrl));
+	HttpRequest->SetVerb(TEXT("POST"));
+	HttpRequest->SetHeader(TEXT("Content-Type"), TEXT("application/json"));
+	
+	if (!Settings->CustomApiKey.IsEmpty())
+	{
+		HttpRequest->SetHeader(TEXT("Authorization"), FString::Printf(TEXT("Bearer %s"), *Settings->CustomApiKey));
+	}
+	
+	HttpRequest->SetContentAsString(RequestBody);
+	const int32 TextCount = SourceTexts.Num();
+	HttpRequest->OnProcessRequestComplete() = MakeAsyncParseHandler(OnComplete, OnError, [TextCount](FHttpResponsePtr Response, bool bSuccess, const FOnBatchTranslationComplete& OnParsed, const FOnTranslationError& OnParseFailed)
+	{
+		LANGUAGEONE_TRACE_SCOPE("LanguageOne::ParseResponse");
+
+		if (!bSuccess || !Response.IsValid())
+		{
+			OnParseFailed.ExecuteIfBound(TEXT("网络请求失败 | Network request failed"));
+			return;
+		}
+
+		FString ResponseStr = Response->GetContentAsString();
+		TSharedPtr<FJsonObject> JsonObject;
+		TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(ResponseStr);
+
+		if (!FJsonSerializer::Deserialize(Reader, JsonObject) || !JsonObject.IsValid())
+		{
+			OnParseFailed.ExecuteIfBound(TEXT("解析响应失败 | Failed to parse response"));
+			return;
+		}
+
+		// 批量响应格式：{"translated_texts": ["...", "..."]}，顺序与请求一致
+		const TArray<TSharedPtr<FJsonValue>>* ResultArray;
+		if (!JsonObject->TryGetArrayField(TEXT("translated_texts"), ResultArray))
+		{
+			OnParseFailed.ExecuteIfBound(TEXT("未找到翻译结果 | No translation result found"));
+			return;
+		}
+
+		TArray<FString> Translations;
+		Translations.SetNum(TextCount);
+		for (int32 i = 0; i < TextCount && i < ResultArray->Num(); i++)
+		{
+			(*ResultArray)[i]->TryGetString(Translations[i]);
+		}
+
+		OnParsed.ExecuteIfBound(Translations);
+	});
+
+	FTranslationRequestScheduler::Get().Enqueue(ETranslateProvider::Custom, HttpRequest);
 }
 
-FString FCommentTranslator::GetLanguageCode(bool bIsBaidu)
+FString FCommentTranslator::GetLanguageCode(ETranslateProvider Provider)
 {
 	const ULanguageOneSettings* Settings = GetDefault<ULanguageOneSettings>();
 	
 	// 根据不同的翻译服务返回对应的语言代码
-	switch (Settings->TranslateProvider)
+	switch (Provider)
 	{
 	case ETranslateProvider::GoogleFree:
 	case ETranslateProvider::Google:
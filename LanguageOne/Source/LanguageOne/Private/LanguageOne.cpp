@@ -6,8 +6,17 @@
 #include "LanguageOneSettings.h"
 #include "LanguageOneCompatibility.h"
 #include "CommentTranslator.h"
+#include "TranslationMemory.h"
+#include "TranslationRequestScheduler.h"
+#include "TranslationResultQueue.h"
+#include "ProviderRouter.h"
 #include "AssetTranslator.h"
 #include "AssetTranslatorUI.h"
+#include "BilingualText.h"
+#include "StringTableWriteQueue.h"
+#include "AssetTranslationTags.h"
+#include "AssetTranslationJournal.h"
+#include "MockTranslationServer.h"
 #include "Toolkits/AssetEditorToolkit.h"
 #include "Misc/MessageDialog.h"
 #include "ToolMenus.h"
@@ -150,6 +159,24 @@ void FLanguageOneModule::StartupModule()
 		);
 	}
 
+	// 加载翻译记忆库
+	FTranslationMemory::Get().Initialize();
+
+	// 加载翻译服务的耗时和失败率统计（自适应路由）
+	FProviderRouter::Get().Initialize();
+
+	// 启动翻译请求调度器
+	FTranslationRequestScheduler::Get().Initialize();
+
+	// 启动翻译结果队列（分帧写回）
+	FTranslationResultQueue::Get().Initialize();
+
+	// 注册资产翻译状态标签
+	FAssetTranslationTags::Initialize();
+
+	// 删除过期的批量翻译日志
+	FAssetTranslationJournal::CleanupStaleJournals();
+
 	// 初始化当前语言显示
 	ULanguageOneSettings* Settings = GetMutableDefault<ULanguageOneSettings>();
 	if (Settings)
@@ -180,6 +207,27 @@ void FLanguageOneModule::ShutdownModule()
 		SettingsModule->UnregisterSettings("Editor", "Plugins", "LanguageOne");
 	}
 
+	// 停止模拟翻译服务器（如果启动过）
+	FMockTranslationServer::Get().Stop();
+
+	// 丢弃排队请求，中止进行中的请求
+	FTranslationRequestScheduler::Get().Shutdown();
+
+	// 等待后台解析结束，丢弃尚未写回的结果
+	FTranslationResultQueue::Get().Shutdown();
+
+	// 保存翻译服务统计
+	FProviderRouter::Get().Shutdown();
+
+	// 写入尚未写入的 String Table 条目
+	FStringTableWriteQueue::Get().Shutdown();
+
+	// 注销资产翻译状态标签
+	FAssetTranslationTags::Shutdown();
+
+	// 保存翻译记忆库中尚未写盘的条目
+	FTranslationMemory::Get().Shutdown();
+
 	UToolMenus::UnRegisterStartupCallback(this);
 
 	UToolMenus::UnregisterOwner(this);
@@ -816,6 +864,9 @@ void FLanguageOneModule::TranslateSelectedNodes()
 	int32 TotalCount = UntranslatedNodes.Num();
 	int32 CurrentIndex = 0;
 
+	// 交互翻译：先于排队的批量资产请求发送
+	FTranslationRequestScheduler::FScopedRequestPriority InteractivePriority(ETranslationRequestPriority::Interactive);
+
 	for (UEdGraphNode* Node : UntranslatedNodes)
 	{
 		FString NodeComment = Node->NodeComment;
@@ -841,24 +892,8 @@ void FLanguageOneModule::TranslateSelectedNodes()
 						}
 						
 					UEdGraphNode* NodeToModify = WeakNode.Get();
-					const ULanguageOneSettings* Settings = GetDefault<ULanguageOneSettings>();
-					FString NewComment;
-					
-					const TCHAR HiddenStartMarker[] = { 0x200B, 0x200C, 0 }; // ZWSP + ZWNJ
-					const TCHAR HiddenEndMarker[] = { 0x200B, 0x200D, 0 };   // ZWSP + ZWJ
-					const FString HiddenStart(HiddenStartMarker);
-					const FString HiddenEnd(HiddenEndMarker);
-					
-					if (Settings->bTranslationAboveOriginal)
-					{
-						// 译文在上方：译文\n---\n标记开始原文标记结束
-						NewComment = FString::Printf(TEXT("%s\n---\n%s%s%s"), *TranslatedText, *HiddenStart, *NodeComment, *HiddenEnd);
-					}
-					else
-					{
-						// 译文在下方（默认）：标记开始原文标记结束\n---\n译文
-						NewComment = FString::Printf(TEXT("%s%s%s\n---\n%s"), *HiddenStart, *NodeComment, *HiddenEnd, *TranslatedText);
-					}
+					// 双语格式：标记开始原文标记结束\n---\n译文（或译文在上方）
+					const FString NewComment = FBilingualText::Format(TranslatedText, NodeComment);
 
 						NodeToModify->Modify();
 						NodeToModify->NodeComment = NewComment;
@@ -0,0 +1,377 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "LanguageOneCommandlet.h"
+#include "AssetTranslator.h"
+#include "AssetTranslationJob.h"
+#include "BilingualText.h"
+#include "CommentTranslator.h"
+#include "LanguageOneSettings.h"
+#include "LanguageOneCompatibility.h"
+#include "MockTranslationServer.h"
+#include "AssetRegistry/AssetRegistryModule.h"
+#include "AssetRegistry/ARFilter.h"
+#include "Async/TaskGraphInterfaces.h"
+#include "Containers/Ticker.h"
+#include "FileHelpers.h"
+#include "HAL/PlatformProcess.h"
+#include "UObject/UObjectGlobals.h"
+#include "UObject/Package.h"
+
+namespace LanguageOneCommandlet
+{
+	/** 退出码 */
+	static const int32 ExitSuccess = 0;
+	static const int32 ExitFailure = 1;
+	static const int32 ExitInvalidArguments = 2;
+
+	/** 任务进行中输出进度的间隔（秒） */
+	static const double ProgressLogInterval = 30.0;
+
+	/** 演练模式每处理多少个资产执行一次垃圾回收 */
+	static const int32 DryRunGCInterval = 50;
+
+	/** 拆分逗号分隔的参数 */
+	static TArray<FString> SplitList(const FString& Value)
+	{
+		TArray<FString> Items;
+		Value.ParseIntoArray(Items, TEXT(","), true);
+		for (FString& Item : Items)
+		{
+			Item.TrimStartAndEndInline();
+		}
+		return Items;
+	}
+
+	/** 按名称查找枚举值（不区分是否带枚举前缀）；找不到时返回 false */
+	template<typename EnumType>
+	static bool ParseEnum(const FString& Name, EnumType& OutValue)
+	{
+		const int64 Value = StaticEnum<EnumType>()->GetValueByNameString(Name);
+		if (Value == INDEX_NONE)
+		{
+			return false;
+		}
+		OutValue = (EnumType)Value;
+		return true;
+	}
+
+	static double ToMB(uint64 Bytes)
+	{
+		return (double)Bytes / (1024.0 * 1024.0);
+	}
+}
+
+ULanguageOneCommandlet::ULanguageOneCommandlet()
+{
+	IsClient = false;
+	IsServer = false;
+	IsEditor = true;
+	LogToConsole = true;
+	ShowErrorCount = true;
+
+	HelpDescription = TEXT("Translate String Table, Data Table and Blueprint text without the editor UI");
+	HelpUsage = TEXT("UnrealEditor-Cmd <Project>.uproject -run=LanguageOne [-paths=/Game/UI,/Game/Data] [-classes=StringTable,DataTable] [-provider=Google] [-target=Chinese] [-concurrency=8] [-timeout=3600] [-dryrun] [-save] [-mockserver[=18080]]");
+	HelpParamNames.Add(TEXT("paths"));
+	HelpParamDescriptions.Add(TEXT("Comma separated content paths to translate recursively (default /Game)"));
+	HelpParamNames.Add(TEXT("classes"));
+	HelpParamDescriptions.Add(TEXT("Only process assets whose class name contains one of these keywords"));
+	HelpParamNames.Add(TEXT("provider"));
+	HelpParamDescriptions.Add(TEXT("Translation provider (ETranslateProvider name), overrides the settings for this run"));
+	HelpParamNames.Add(TEXT("target"));
+	HelpParamDescriptions.Add(TEXT("Target language (ETranslateTargetLanguage name), overrides the settings for this run"));
+	HelpParamNames.Add(TEXT("concurrency"));
+	HelpParamDescriptions.Add(TEXT("Maximum concurrent translation requests"));
+	HelpParamNames.Add(TEXT("timeout"));
+	HelpParamDescriptions.Add(TEXT("Cancel the job after this many seconds"));
+	HelpParamNames.Add(TEXT("dryrun"));
+	HelpParamDescriptions.Add(TEXT("Only gather text and print statistics; no requests are sent and no asset is modified"));
+	HelpParamNames.Add(TEXT("save"));
+	HelpParamDescriptions.Add(TEXT("Save modified packages when the job finishes"));
+	HelpParamNames.Add(TEXT("mockserver"));
+	HelpParamDescriptions.Add(TEXT("Send all requests to the loopback mock translation server (optionally on the given port) instead of the real providers"));
+}
+
+int32 ULanguageOneCommandlet::Main(const FString& Params)
+{
+	TArray<FString> Tokens;
+	TArray<FString> Switches;
+	TMap<FString, FString> ParamVals;
+	ParseCommandLine(*Params, Tokens, Switches, ParamVals);
+
+	const bool bDryRun = Switches.Contains(TEXT("dryrun"));
+	const bool bSave = Switches.Contains(TEXT("save"));
+
+	double TimeoutSeconds = 0.0;
+	if (const FString* Timeout = ParamVals.Find(TEXT("timeout")))
+	{
+		LexFromString(TimeoutSeconds, **Timeout);
+	}
+
+	if (!ApplySettingOverrides(ParamVals, bSave))
+	{
+		return LanguageOneCommandlet::ExitInvalidArguments;
+	}
+
+	const TArray<FAssetData> Assets = GatherAssets(ParamVals);
+	if (Assets.Num() == 0)
+	{
+		UE_LOG(LogTemp, Display, TEXT("LanguageOne: no translatable assets found"));
+		return LanguageOneCommandlet::ExitSuccess;
+	}
+
+	// 使用本地模拟服务器（离线吞吐测试）
+	const FString* MockServerPort = ParamVals.Find(TEXT("mockserver"));
+	const bool bMockServer = MockServerPort || Switches.Contains(TEXT("mockserver"));
+	if (bMockServer && !bDryRun)
+	{
+		FMockTranslationServerConfig MockConfig;
+		if (MockServerPort)
+		{
+			LexFromString(MockConfig.Port, **MockServerPort);
+		}
+		if (!FMockTranslationServer::Get().Start(MockConfig))
+		{
+			return LanguageOneCommandlet::ExitFailure;
+		}
+		FMockTranslationServer::Get().PointSettingsAtServer();
+	}
+
+	const int32 ExitCode = bDryRun ? RunDryRun(Assets) : RunTranslation(Assets, bSave, TimeoutSeconds);
+
+	if (FMockTranslationServer::Get().IsRunning())
+	{
+		const FMockTranslationServerStats& MockStats = FMockTranslationServer::Get().GetStats();
+		UE_LOG(LogTemp, Display, TEXT("LanguageOne: mock server handled %d requests, %d texts"), MockStats.Requests, MockStats.Texts);
+		FMockTranslationServer::Get().Stop();
+	}
+	return ExitCode;
+}
+
+TArray<FAssetData> ULanguageOneCommandlet::GatherAssets(const TMap<FString, FString>& ParamVals)
+{
+	const FString* PathsParam = ParamVals.Find(TEXT("paths"));
+	TArray<FString> Paths = LanguageOneCommandlet::SplitList(PathsParam ? *PathsParam : FString(TEXT("/Game")));
+
+	const FString* ClassesParam = ParamVals.Find(TEXT("classes"));
+	const TArray<FString> ClassKeywords = ClassesParam ? LanguageOneCommandlet::SplitList(*ClassesParam) : TArray<FString>();
+
+	// 命令行启动时资产注册表还没有扫描完成，先同步扫描要处理的目录
+	IAssetRegistry& AssetRegistry = FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry").Get();
+	AssetRegistry.ScanPathsSynchronous(Paths, true);
+
+	FARFilter Filter;
+	Filter.bRecursivePaths = true;
+	for (const FString& Path : Paths)
+	{
+		Filter.PackagePaths.Add(FName(*Path));
+	}
+
+	TArray<FAssetData> FoundAssets;
+	AssetRegistry.GetAssets(Filter, FoundAssets);
+
+	TArray<FAssetData> Assets;
+	for (const FAssetData& AssetData : FoundAssets)
+	{
+		if (!FAssetTranslator::CanTranslateAsset(AssetData))
+		{
+			continue;
+		}
+
+		if (ClassKeywords.Num() > 0)
+		{
+			const FString ClassName = LanguageOneAssetDataHelper::GetAssetClassName(AssetData);
+			if (!ClassKeywords.ContainsByPredicate([&ClassName](const FString& Keyword) { return ClassName.Contains(Keyword); }))
+			{
+				continue;
+			}
+		}
+
+		Assets.Add(AssetData);
+	}
+
+	UE_LOG(LogTemp, Display, TEXT("LanguageOne: %d translatable assets of %d found under %s"),
+		Assets.Num(), FoundAssets.Num(), *FString::Join(Paths, TEXT(", ")));
+	return Assets;
+}
+
+bool ULanguageOneCommandlet::ApplySettingOverrides(const TMap<FString, FString>& ParamVals, bool bSave)
+{
+	// 只修改内存中的设置，不调用 SaveConfig
+	ULanguageOneSettings* Settings = GetMutableDefault<ULanguageOneSettings>();
+
+	if (const FString* Provider = ParamVals.Find(TEXT("provider")))
+	{
+		if (!LanguageOneCommandlet::ParseEnum(*Provider, Settings->TranslateProvider))
+		{
+			UE_LOG(LogTemp, Error, TEXT("LanguageOne: unknown provider '%s'"), **Provider);
+			return false;
+		}
+	}
+
+	if (const FString* Target = ParamVals.Find(TEXT("target")))
+	{
+		if (!LanguageOneCommandlet::ParseEnum(*Target, Settings->TargetLanguage))
+		{
+			UE_LOG(LogTemp, Error, TEXT("LanguageOne: unknown target language '%s'"), **Target);
+			return false;
+		}
+	}
+
+	if (const FString* Concurrency = ParamVals.Find(TEXT("concurrency")))
+	{
+		int32 MaxConcurrentRequests = 0;
+		LexFromString(MaxConcurrentRequests, **Concurrency);
+		if (MaxConcurrentRequests <= 0)
+		{
+			UE_LOG(LogTemp, Error, TEXT("LanguageOne: invalid concurrency '%s'"), **Concurrency);
+			return false;
+		}
+		Settings->MaxConcurrentRequests = MaxConcurrentRequests;
+	}
+
+	// 低内存批处理会在每个窗口结束时保存，不保存的运行不能使用
+	if (!bSave && Settings->bBoundedMemoryBatch)
+	{
+		UE_LOG(LogTemp, Display, TEXT("LanguageOne: bounded-memory batch mode disabled because -save was not given"));
+		Settings->bBoundedMemoryBatch = false;
+	}
+
+	UE_LOG(LogTemp, Display, TEXT("LanguageOne: provider %s, target %s, %d concurrent requests"),
+		*StaticEnum<ETranslateProvider>()->GetNameStringByValue((int64)Settings->TranslateProvider),
+		*StaticEnum<ETranslateTargetLanguage>()->GetNameStringByValue((int64)Settings->TargetLanguage),
+		Settings->MaxConcurrentRequests);
+	return true;
+}
+
+int32 ULanguageOneCommandlet::RunDryRun(const TArray<FAssetData>& Assets)
+{
+	const double StartTime = FPlatformTime::Seconds();
+	const int32 BatchSize = FMath::Max(1, FCommentTranslator::GetMaxBatchSize(GetDefault<ULanguageOneSettings>()->TranslateProvider));
+
+	int32 LoadFailures = 0;
+	int32 TotalUnits = 0;
+	int32 TranslatedUnits = 0;
+	TSet<FString> UniqueSources;
+
+	for (int32 AssetIndex = 0; AssetIndex < Assets.Num(); AssetIndex++)
+	{
+		const FAssetData& AssetData = Assets[AssetIndex];
+		UObject* Asset = AssetData.GetAsset();
+		if (!Asset)
+		{
+			UE_LOG(LogTemp, Warning, TEXT("Failed to load asset: %s"), *AssetData.GetObjectPathString());
+			LoadFailures++;
+			continue;
+		}
+
+		TArray<FTranslationTextUnit> Units;
+		FAssetTranslator::ExtractTextUnits(Asset, AssetData, Units);
+
+		int32 AssetUnits = 0;
+		for (const FTranslationTextUnit& Unit : Units)
+		{
+			const FBilingualTextView Bilingual = FBilingualText::Parse(Unit.CurrentText);
+			if (Bilingual.Original.IsEmpty())
+			{
+				continue;
+			}
+
+			AssetUnits++;
+			if (Bilingual.bHasTranslation)
+			{
+				TranslatedUnits++;
+			}
+			UniqueSources.Add(FString(Bilingual.Original));
+		}
+		TotalUnits += AssetUnits;
+
+		UE_LOG(LogTemp, Display, TEXT("  %s: %d text units"), *AssetData.GetObjectPathString(), AssetUnits);
+
+		if ((AssetIndex + 1) % LanguageOneCommandlet::DryRunGCInterval == 0)
+		{
+			CollectGarbage(GARBAGE_COLLECTION_KEEPFLAGS);
+		}
+	}
+
+	const int32 EstimatedRequests = FMath::DivideAndRoundUp(UniqueSources.Num(), BatchSize);
+	UE_LOG(LogTemp, Display, TEXT("LanguageOne dry run: %d assets (%d failed to load), %d text units (%d already translated), %d unique sources, ~%d requests, %.1fs"),
+		Assets.Num(), LoadFailures, TotalUnits, TranslatedUnits, UniqueSources.Num(), EstimatedRequests, FPlatformTime::Seconds() - StartTime);
+
+	return LoadFailures > 0 ? LanguageOneCommandlet::ExitFailure : LanguageOneCommandlet::ExitSuccess;
+}
+
+int32 ULanguageOneCommandlet::RunTranslation(const TArray<FAssetData>& Assets, bool bSave, double TimeoutSeconds)
+{
+	const double StartTime = FPlatformTime::Seconds();
+
+	TSharedRef<FAssetTranslationJob> Job = FAssetTranslator::PerformTranslation(Assets);
+	TSharedFuture<FAssetTranslationJobResult> Future = Job->GetFuture();
+
+	// 没有编辑器主循环：在这里驱动游戏线程任务、异步加载和定时器（HTTP、调度器、String Table 写入都依赖定时器）
+	double LastTickTime = StartTime;
+	double LastProgressTime = StartTime;
+	while (!Future.IsReady())
+	{
+		const double Now = FPlatformTime::Seconds();
+		const float DeltaTime = (float)(Now - LastTickTime);
+		LastTickTime = Now;
+
+		FTaskGraphInterface::Get().ProcessThreadUntilIdle(ENamedThreads::GameThread);
+		ProcessAsyncLoading(true, false, 0.01);
+		FTSTicker::GetCoreTicker().Tick(DeltaTime);
+
+		if (TimeoutSeconds > 0.0 && Now - StartTime > TimeoutSeconds && !Job->IsFinished())
+		{
+			UE_LOG(LogTemp, Error, TEXT("LanguageOne: timed out after %.0fs, cancelling"), TimeoutSeconds);
+			Job->Cancel();
+		}
+
+		if (Now - LastProgressTime >= LanguageOneCommandlet::ProgressLogInterval)
+		{
+			LastProgressTime = Now;
+			const FTranslationBatchStats& Stats = Job->GetStats();
+			UE_LOG(LogTemp, Display, TEXT("LanguageOne: %d/%d text units applied, %d failed (%.0fs)"),
+				Stats.AppliedUnits, Stats.TranslatableUnits, Stats.FailedUnits, Now - StartTime);
+		}
+
+		FPlatformProcess::Sleep(0.005f);
+	}
+
+	const FAssetTranslationJobResult& Result = Future.Get();
+	const double Elapsed = FMath::Max(FPlatformTime::Seconds() - StartTime, 0.001);
+	const FTranslationBatchStats& Stats = Result.Stats;
+
+	UE_LOG(LogTemp, Display, TEXT("LanguageOne: %d/%d assets succeeded, %d failed, %d cancelled in %.1fs (%.2f assets/s)"),
+		Result.SucceededAssets, Result.TotalAssets, Result.FailedAssets, Result.CancelledAssets, Elapsed, (Result.SucceededAssets + Result.FailedAssets) / Elapsed);
+	UE_LOG(LogTemp, Display, TEXT("LanguageOne: %d/%d text units applied, %d failed, %d unique sources (dedupe ratio %.1f%%), %.1f units/s"),
+		Stats.AppliedUnits, Stats.TranslatableUnits, Stats.FailedUnits, Stats.UniqueUnits, Stats.GetDedupeRatio() * 100.0f, Stats.AppliedUnits / Elapsed);
+	UE_LOG(LogTemp, Display, TEXT("LanguageOne: memory %.1f MB -> %.1f MB, peak %.1f MB"),
+		LanguageOneCommandlet::ToMB(Result.StartMemoryBytes), LanguageOneCommandlet::ToMB(Result.EndMemoryBytes), LanguageOneCommandlet::ToMB(Result.PeakMemoryBytes));
+	if (!Result.ReportPath.IsEmpty())
+	{
+		UE_LOG(LogTemp, Display, TEXT("LanguageOne: report written to %s"), *Result.ReportPath);
+	}
+
+	bool bSaveFailed = false;
+	if (bSave)
+	{
+		TArray<UPackage*> DirtyPackages;
+		for (const FAssetData& AssetData : Assets)
+		{
+			UPackage* Package = FindPackage(nullptr, *AssetData.PackageName.ToString());
+			if (Package && Package->IsDirty())
+			{
+				DirtyPackages.AddUnique(Package);
+			}
+		}
+
+		if (DirtyPackages.Num() > 0)
+		{
+			bSaveFailed = !UEditorLoadingAndSavingUtils::SavePackages(DirtyPackages, true);
+			UE_LOG(LogTemp, Display, TEXT("LanguageOne: saved %d packages%s"), DirtyPackages.Num(), bSaveFailed ? TEXT(" (some failed)") : TEXT(""));
+		}
+	}
+
+	const bool bFailed = Result.bCancelled || Result.FailedAssets > 0 || Stats.FailedUnits > 0 || bSaveFailed;
+	return bFailed ? LanguageOneCommandlet::ExitFailure : LanguageOneCommandlet::ExitSuccess;
+}
@@ -20,10 +20,45 @@ ULanguageOneSettings::ULanguageOneSettings()
 	, GoogleApiKey(TEXT(""))
 	, CustomApiUrl(TEXT(""))
 	, CustomApiKey(TEXT(""))
+	, bCustomApiSupportsBatch(false)  // 默认逐条请求，兼容旧的自定义接口
 	, TargetLanguage(ETranslateTargetLanguage::Chinese)
 	, bTranslationAboveOriginal(false)  // 默认译文在下方（原文在上方）
 	, bConfirmBeforeAssetTranslation(false)  // 默认不需要确认
+	, bEnableTranslationMemory(true)  // 默认启用翻译记忆库
+	, MaxConcurrentRequests(6)  // 默认最多 6 个并发请求
+	, InteractiveReservedRequests(1)  // 默认为交互翻译保留 1 个名额
+	, bHedgeInteractiveRequests(true)  // 默认对冲交互请求
+	, HedgeLatencyPercentile(95.0f)  // 默认超过 p95 耗时后对冲
+	, HedgeFallbackDelaySeconds(1.5f)  // 默认样本不足时 1.5 秒后对冲
+	, InteractiveDeadlineSeconds(15.0f)  // 默认 15 秒超时
+	, MaxRetryAttempts(3)  // 默认重试 3 次
+	, RetryBaseDelaySeconds(1.0f)  // 默认基础间隔 1 秒
+	, bAdaptiveRouting(false)  // 默认使用固定的首选服务
+	, RoutingLatencySloSeconds(3.0f)  // 默认平均耗时不超过 3 秒
+	, RoutingMaxErrorRate(0.2f)  // 默认失败率不超过 20%
+	, AssetLoadLookAhead(16)  // 默认同时加载 16 个资产
+	, ResultApplyBudgetMs(4.0f)  // 默认每帧写回 4 毫秒
+	, bBoundedMemoryBatch(false)  // 默认不分窗口（不自动保存）
+	, BatchWindowSize(200)  // 默认每个窗口 200 个资产
+	, BatchMemoryCeilingMB(8192)  // 默认内存上限 8 GB
+	, bRecordUndoTransactions(true)  // 默认记录撤销
+	, bResumeInterruptedJobs(true)  // 默认启用断点续传
+	, bWriteRunReports(true)  // 默认写入任务报告
 	, bVerboseAssetTranslationLog(false)  // 默认不显示详细日志
 {
+	// 默认请求速率：免费接口保守，付费接口按官方配额
+	ProviderRequestsPerSecond.Add(ETranslateProvider::GoogleFree, 3.0f);
+	ProviderRequestsPerSecond.Add(ETranslateProvider::MicrosoftFree, 5.0f);
+	ProviderRequestsPerSecond.Add(ETranslateProvider::YoudaoFree, 2.0f);
+	ProviderRequestsPerSecond.Add(ETranslateProvider::Baidu, 1.0f);  // 百度标准版 QPS = 1
+	ProviderRequestsPerSecond.Add(ETranslateProvider::Google, 10.0f);
+	ProviderRequestsPerSecond.Add(ETranslateProvider::Custom, 10.0f);
+
+	// 备用服务默认留空：选择免费接口时自动在免费接口之间切换，付费和自定义接口不切换（见 FCommentTranslator::GetProviderChain）
+
+	// 默认路由服务：只在免费接口之间选择
+	RoutingProviders.Add(ETranslateProvider::MicrosoftFree);
+	RoutingProviders.Add(ETranslateProvider::GoogleFree);
+	RoutingProviders.Add(ETranslateProvider::YoudaoFree);
 }
 
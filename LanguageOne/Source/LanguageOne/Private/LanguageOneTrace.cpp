@@ -0,0 +1,104 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "LanguageOneTrace.h"
+#include "HAL/PlatformTime.h"
+#include "ProfilingDebugging/MiscTrace.h"
+
+UE_TRACE_CHANNEL_DEFINE(LanguageOneChannel)
+
+UE_TRACE_EVENT_BEGIN(LanguageOne, UnitBatch)
+	UE_TRACE_EVENT_FIELD(uint64, Cycle)
+	UE_TRACE_EVENT_FIELD(uint32, JobId)
+	UE_TRACE_EVENT_FIELD(uint32, BatchId)
+	UE_TRACE_EVENT_FIELD(int32[], UnitIds)
+UE_TRACE_EVENT_END()
+
+UE_TRACE_EVENT_BEGIN(LanguageOne, RequestTiming)
+	UE_TRACE_EVENT_FIELD(uint64, Cycle)
+	UE_TRACE_EVENT_FIELD(uint32, RequestId)
+	UE_TRACE_EVENT_FIELD(uint32, JobId)
+	UE_TRACE_EVENT_FIELD(uint32, BatchId)
+	UE_TRACE_EVENT_FIELD(uint8, Provider)
+	UE_TRACE_EVENT_FIELD(uint8, Phase)
+	UE_TRACE_EVENT_FIELD(int32, Attempt)
+	UE_TRACE_EVENT_FIELD(int32, ResponseCode)
+UE_TRACE_EVENT_END()
+
+uint32 FLanguageOneTrace::CurrentBatch = 0;
+uint32 FLanguageOneTrace::NextBatch = 1;
+uint32 FLanguageOneTrace::NextRequestId = 1;
+
+namespace LanguageOneTrace
+{
+	/** Timing Region 名称：开始和结束必须使用同一个名称 */
+	static FString MakeRegionName(uint32 RequestId, ETranslateProvider Provider)
+	{
+		return FString::Printf(TEXT("LanguageOne Request %u (%s)"), RequestId, *StaticEnum<ETranslateProvider>()->GetNameStringByValue((int64)Provider));
+	}
+}
+
+bool FLanguageOneTrace::IsEnabled()
+{
+#if UE_TRACE_ENABLED
+	return UE_TRACE_CHANNELEXPR_IS_ENABLED(LanguageOneChannel);
+#else
+	return false;
+#endif
+}
+
+uint32 FLanguageOneTrace::TraceUnitBatch(uint32 JobId, TConstArrayView<int32> UnitIds)
+{
+	if (!IsEnabled())
+	{
+		return 0;
+	}
+
+	const uint32 BatchId = NextBatch++;
+
+#if UE_TRACE_ENABLED
+	UE_TRACE_LOG(LanguageOne, UnitBatch, LanguageOneChannel)
+		<< UnitBatch.Cycle(FPlatformTime::Cycles64())
+		<< UnitBatch.JobId(JobId)
+		<< UnitBatch.BatchId(BatchId)
+		<< UnitBatch.UnitIds(UnitIds.GetData(), UnitIds.Num());
+#endif
+
+	return BatchId;
+}
+
+uint32 FLanguageOneTrace::AllocateRequestId()
+{
+	return IsEnabled() ? NextRequestId++ : 0;
+}
+
+void FLanguageOneTrace::TraceRequestPhase(uint32 RequestId, uint32 JobId, uint32 BatchId, ETranslateProvider Provider, ELanguageOneRequestPhase Phase, int32 Attempt, int32 ResponseCode)
+{
+	if (RequestId == 0 || !IsEnabled())
+	{
+		return;
+	}
+
+#if UE_TRACE_ENABLED
+	UE_TRACE_LOG(LanguageOne, RequestTiming, LanguageOneChannel)
+		<< RequestTiming.Cycle(FPlatformTime::Cycles64())
+		<< RequestTiming.RequestId(RequestId)
+		<< RequestTiming.JobId(JobId)
+		<< RequestTiming.BatchId(BatchId)
+		<< RequestTiming.Provider((uint8)Provider)
+		<< RequestTiming.Phase((uint8)Phase)
+		<< RequestTiming.Attempt(Attempt)
+		<< RequestTiming.ResponseCode(ResponseCode);
+#endif
+
+#if (ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION >= 2)
+	// 发送到完成显示为时间线上的区间
+	if (Phase == ELanguageOneRequestPhase::Sent)
+	{
+		TRACE_BEGIN_REGION(*LanguageOneTrace::MakeRegionName(RequestId, Provider));
+	}
+	else if (Phase == ELanguageOneRequestPhase::Completed)
+	{
+		TRACE_END_REGION(*LanguageOneTrace::MakeRegionName(RequestId, Provider));
+	}
+#endif
+}
@@ -0,0 +1,159 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "MicrosoftAuthToken.h"
+#include "HttpModule.h"
+#include "Interfaces/IHttpRequest.h"
+#include "Interfaces/IHttpResponse.h"
+#include "Json.h"
+#include "Misc/Base64.h"
+
+namespace LanguageOneMicrosoftAuth
+{
+	static const TCHAR* AuthUrl = TEXT("https://edge.microsoft.com/translate/auth");
+
+	/** 提前刷新的时间（秒），避免请求途中过期 */
+	static const double RefreshMarginSeconds = 60.0;
+
+	/** 无法解析过期时间时的默认有效期（秒），Edge Token 一般为 10 分钟，这里保守取 5 分钟 */
+	static const double DefaultLifetimeSeconds = 300.0;
+}
+
+FMicrosoftAuthTokenManager& FMicrosoftAuthTokenManager::Get()
+{
+	static FMicrosoftAuthTokenManager Instance;
+	return Instance;
+}
+
+void FMicrosoftAuthTokenManager::RequestToken(FOnMicrosoftAuthTokenReady OnReady, FOnTranslationError OnError)
+{
+	if (IsTokenValid())
+	{
+		OnReady.ExecuteIfBound(CachedToken);
+		return;
+	}
+
+	Waiters.Emplace(OnReady, OnError);
+
+	// 已有刷新请求时只需等待
+	if (!bRefreshInFlight)
+	{
+		StartRefresh();
+	}
+}
+
+void FMicrosoftAuthTokenManager::Invalidate(const FString& RejectedToken)
+{
+	if (CachedToken == RejectedToken)
+	{
+		UE_LOG(LogTemp, Log, TEXT("Microsoft auth token rejected, will refresh"));
+		CachedToken.Empty();
+		ExpiryUtc = FDateTime::MinValue();
+	}
+}
+
+bool FMicrosoftAuthTokenManager::IsTokenValid() const
+{
+	return !CachedToken.IsEmpty() && FDateTime::UtcNow() + FTimespan::FromSeconds(LanguageOneMicrosoftAuth::RefreshMarginSeconds) < ExpiryUtc;
+}
+
+void FMicrosoftAuthTokenManager::StartRefresh()
+{
+	bRefreshInFlight = true;
+
+	TSharedRef<IHttpRequest, ESPMode::ThreadSafe> AuthRequest = FHttpModule::Get().CreateRequest();
+	AuthRequest->SetURL(FCommentTranslator::ResolveProviderUrl(ETranslateProvider::MicrosoftFree, LanguageOneMicrosoftAuth::AuthUrl));
+	AuthRequest->SetVerb(TEXT("GET"));
+	AuthRequest->SetHeader(TEXT("User-Agent"), TEXT("Mozilla/5.0 (Windows NT 10.0; Win64; x64) AppleWebKit/537.36 (KHTML, like Gecko) Chrome/120.0.0.0 Safari/537.36 Edg/120.0.0.0"));
+	AuthRequest->OnProcessRequestComplete().BindLambda([this](FHttpRequestPtr Request, FHttpResponsePtr Response, bool bSuccess)
+	{
+		if (!bSuccess || !Response.IsValid() || !EHttpResponseCodes::IsOk(Response->GetResponseCode()))
+		{
+			FinishRefresh(FString(), TEXT("获取微软翻译授权失败，请检查网络 | Failed to get Microsoft auth"));
+			return;
+		}
+
+		FString Token = Response->GetContentAsString().TrimStartAndEnd();
+		if (Token.IsEmpty())
+		{
+			FinishRefresh(FString(), TEXT("获取到的微软授权Token为空 | Microsoft auth token is empty"));
+			return;
+		}
+
+		FinishRefresh(Token, FString());
+	});
+
+	AuthRequest->ProcessRequest();
+}
+
+void FMicrosoftAuthTokenManager::FinishRefresh(const FString& NewToken, const FString& ErrorMessage)
+{
+	bRefreshInFlight = false;
+
+	if (!NewToken.IsEmpty())
+	{
+		CachedToken = NewToken;
+		if (!DecodeTokenExpiry(NewToken, ExpiryUtc))
+		{
+			ExpiryUtc = FDateTime::UtcNow() + FTimespan::FromSeconds(LanguageOneMicrosoftAuth::DefaultLifetimeSeconds);
+		}
+
+		UE_LOG(LogTemp, Log, TEXT("Microsoft auth token refreshed, expires at %s UTC"), *ExpiryUtc.ToString());
+	}
+
+	// 先取出等待者，回调中可能再次请求 Token
+	TArray<TPair<FOnMicrosoftAuthTokenReady, FOnTranslationError>> PendingWaiters = MoveTemp(Waiters);
+	Waiters.Reset();
+
+	for (TPair<FOnMicrosoftAuthTokenReady, FOnTranslationError>& Waiter : PendingWaiters)
+	{
+		if (NewToken.IsEmpty())
+		{
+			Waiter.Value.ExecuteIfBound(ErrorMessage);
+		}
+		else
+		{
+			Waiter.Key.ExecuteIfBound(NewToken);
+		}
+	}
+}
+
+bool FMicrosoftAuthTokenManager::DecodeTokenExpiry(const FString& Token, FDateTime& OutExpiryUtc)
+{
+	// JWT 格式：header.payload.signature，payload 为 base64url 编码的 JSON
+	TArray<FString> Parts;
+	if (Token.ParseIntoArray(Parts, TEXT("."), false) != 3)
+	{
+		return false;
+	}
+
+	FString Payload = Parts[1].Replace(TEXT("-"), TEXT("+")).Replace(TEXT("_"), TEXT("/"));
+	while (Payload.Len() % 4 != 0)
+	{
+		Payload.AppendChar(TEXT('='));
+	}
+
+	TArray<uint8> PayloadBytes;
+	if (!FBase64::Decode(Payload, PayloadBytes))
+	{
+		return false;
+	}
+
+	FUTF8ToTCHAR PayloadConverter(reinterpret_cast<const ANSICHAR*>(PayloadBytes.GetData()), PayloadBytes.Num());
+	FString PayloadJson(PayloadConverter.Length(), PayloadConverter.Get());
+
+	TSharedPtr<FJsonObject> JsonObject;
+	TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(PayloadJson);
+	if (!FJsonSerializer::Deserialize(Reader, JsonObject) || !JsonObject.IsValid())
+	{
+		return false;
+	}
+
+	int64 Expiry = 0;
+	if (!JsonObject->TryGetNumberField(TEXT("exp"), Expiry) || Expiry <= 0)
+	{
+		return false;
+	}
+
+	OutExpiryUtc = FDateTime::FromUnixTimestamp(Expiry);
+	return true;
+}
@@ -0,0 +1,591 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "MockTranslationServer.h"
+#include "CommentTranslator.h"
+#include "HttpServerModule.h"
+#include "IHttpRouter.h"
+#include "HttpPath.h"
+#include "HttpServerRequest.h"
+#include "HttpServerResponse.h"
+#include "GenericPlatform/GenericPlatformHttp.h"
+#include "Containers/Ticker.h"
+#include "HAL/IConsoleManager.h"
+#include "Misc/Base64.h"
+#include "Json.h"
+
+namespace LanguageOneMockServer
+{
+	/** 授权 Token 有效期（秒） */
+	static const int64 AuthTokenLifetimeSeconds = 600;
+
+	/** HTTPServer 的处理函数在 5.4 改为委托 */
+	template<typename FunctorType>
+	static FHttpRequestHandler MakeHandler(FunctorType&& Functor)
+	{
+#if (ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION >= 4)
+		return FHttpRequestHandler::CreateLambda(Forward<FunctorType>(Functor));
+#else
+		return FHttpRequestHandler(Forward<FunctorType>(Functor));
+#endif
+	}
+
+	static FString GetBodyString(const FHttpServerRequest& Request)
+	{
+		FUTF8ToTCHAR Converter(reinterpret_cast<const ANSICHAR*>(Request.Body.GetData()), Request.Body.Num());
+		return FString(Converter.Length(), Converter.Get());
+	}
+
+	static FString GetQueryParam(const FHttpServerRequest& Request, const TCHAR* Name)
+	{
+		const FString* Value = Request.QueryParams.Find(Name);
+		return Value ? FGenericPlatformHttp::UrlDecode(*Value) : FString();
+	}
+
+	static FString GetHeader(const FHttpServerRequest& Request, const TCHAR* Name)
+	{
+		const TArray<FString>* Values = Request.Headers.Find(Name);
+		return (Values && Values->Num() > 0) ? (*Values)[0] : FString();
+	}
+
+	/** 解析 application/x-www-form-urlencoded 请求体（保留重复的键） */
+	static TArray<TPair<FString, FString>> ParseForm(const FString& Body)
+	{
+		TArray<TPair<FString, FString>> Fields;
+		TArray<FString> Pairs;
+		Body.ParseIntoArray(Pairs, TEXT("&"), true);
+		for (const FString& Pair : Pairs)
+		{
+			FString Key;
+			FString Value;
+			if (!Pair.Split(TEXT("="), &Key, &Value))
+			{
+				Key = Pair;
+			}
+			Fields.Emplace(FGenericPlatformHttp::UrlDecode(Key), FGenericPlatformHttp::UrlDecode(Value.Replace(TEXT("+"), TEXT("%20"))));
+		}
+		return Fields;
+	}
+
+	static FString FindFormValue(const TArray<TPair<FString, FString>>& Fields, const TCHAR* Key)
+	{
+		for (const TPair<FString, FString>& Field : Fields)
+		{
+			if (Field.Key == Key)
+			{
+				return Field.Value;
+			}
+		}
+		return FString();
+	}
+
+	static FString ToJson(const TSharedRef<FJsonObject>& Object)
+	{
+		FString Output;
+		TSharedRef<TJsonWriter<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>> Writer = TJsonWriterFactory<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>::Create(&Output);
+		FJsonSerializer::Serialize(Object, Writer);
+		return Output;
+	}
+
+	static FString ToJson(const TArray<TSharedPtr<FJsonValue>>& Array)
+	{
+		FString Output;
+		TSharedRef<TJsonWriter<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>> Writer = TJsonWriterFactory<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>::Create(&Output);
+		FJsonSerializer::Serialize(Array, Writer);
+		return Output;
+	}
+
+	/** base64url 编码（无填充） */
+	static FString Base64UrlEncode(const FString& Text)
+	{
+		FTCHARToUTF8 Utf8(*Text);
+		TArray<uint8> Bytes(reinterpret_cast<const uint8*>(Utf8.Get()), Utf8.Length());
+		FString Encoded = FBase64::Encode(Bytes);
+		Encoded.ReplaceCharInline(TEXT('+'), TEXT('-'));
+		Encoded.ReplaceCharInline(TEXT('/'), TEXT('_'));
+		while (Encoded.RemoveFromEnd(TEXT("=")))
+		{
+		}
+		return Encoded;
+	}
+
+	/** 标准正态分布抽样（Box-Muller） */
+	static float SampleStandardNormal(FRandomStream& Random)
+	{
+		const float U1 = FMath::Max(Random.GetFraction(), KINDA_SMALL_NUMBER);
+		const float U2 = Random.GetFraction();
+		return FMath::Sqrt(-2.0f * FMath::Loge(U1)) * FMath::Cos(2.0f * PI * U2);
+	}
+}
+
+FMockTranslationServer& FMockTranslationServer::Get()
+{
+	static FMockTranslationServer Instance;
+	return Instance;
+}
+
+FString FMockTranslationServer::GetBaseUrl() const
+{
+	return FString::Printf(TEXT("http://127.0.0.1:%u"), Config.Port);
+}
+
+bool FMockTranslationServer::Start(const FMockTranslationServerConfig& InConfig)
+{
+	using namespace LanguageOneMockServer;
+
+	Stop();
+
+	Config = InConfig;
+	Random.Initialize(Config.Seed);
+	ResetStats();
+
+	FHttpServerModule& HttpServerModule = FHttpServerModule::Get();
+	Router = HttpServerModule.GetHttpRouter(Config.Port);
+	if (!Router.IsValid())
+	{
+		UE_LOG(LogTemp, Error, TEXT("Mock translation server: failed to get HTTP router on port %u"), Config.Port);
+		return false;
+	}
+
+	// 谷歌(Web版)：GET /translate_a/single?tl=..&q=..，返回 [[["译文","原文",null,null,10]],null,"auto"]
+	BindProviderRoute(ETranslateProvider::GoogleFree, TEXT("/translate_a/single"), false, [](const FHttpServerRequest& Request, int32& OutTextCount)
+	{
+		const FString Source = GetQueryParam(Request, TEXT("q"));
+		OutTextCount = 1;
+
+		TArray<TSharedPtr<FJsonValue>> Segment;
+		Segment.Add(MakeShared<FJsonValueString>(MakeTranslation(Source, GetQueryParam(Request, TEXT("tl")))));
+		Segment.Add(MakeShared<FJsonValueString>(Source));
+		Segment.Add(MakeShared<FJsonValueNull>());
+		Segment.Add(MakeShared<FJsonValueNull>());
+		Segment.Add(MakeShared<FJsonValueNumber>(10));
+
+		TArray<TSharedPtr<FJsonValue>> Segments;
+		Segments.Add(MakeShared<FJsonValueArray>(Segment));
+
+		TArray<TSharedPtr<FJsonValue>> Root;
+		Root.Add(MakeShared<FJsonValueArray>(Segments));
+		Root.Add(MakeShared<FJsonValueNull>());
+		Root.Add(MakeShared<FJsonValueString>(TEXT("auto")));
+
+		FMockResponse Response;
+		Response.Body = ToJson(Root);
+		return Response;
+	});
+
+	// 微软授权：GET /translate/auth，返回 JWT 格式的 Token 文本
+	BindProviderRoute(ETranslateProvider::MicrosoftFree, TEXT("/translate/auth"), false, [](const FHttpServerRequest& Request, int32& OutTextCount)
+	{
+		OutTextCount = 0;
+		FMockResponse Response;
+		Response.Body = MakeAuthToken();
+		Response.ContentType = TEXT("text/plain");
+		return Response;
+	});
+
+	// 微软翻译：POST /translate?to=..，请求体 [{"Text":".."}]，返回 [{"translations":[{"text":"..","to":".."}]}]
+	BindProviderRoute(ETranslateProvider::MicrosoftFree, TEXT("/translate"), true, [this](const FHttpServerRequest& Request, int32& OutTextCount)
+	{
+		FMockResponse Response;
+		if (!GetHeader(Request, TEXT("Authorization")).StartsWith(TEXT("Bearer ")))
+		{
+			Response.Code = 401;
+			Response.Body = TEXT("{\"error\":{\"code\":401000,\"message\":\"The request is not authorized because credentials are missing or invalid.\"}}");
+			return Response;
+		}
+
+		TArray<TSharedPtr<FJsonValue>> Items;
+		TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(GetBodyString(Request));
+		if (!FJsonSerializer::Deserialize(Reader, Items))
+		{
+			Response.Code = 400;
+			Response.Body = TEXT("{\"error\":{\"code\":400074,\"message\":\"The body of the request is not valid JSON.\"}}");
+			return Response;
+		}
+
+		OutTextCount = Items.Num();
+		if (ExceedsBatchLimit(ETranslateProvider::MicrosoftFree, Items.Num()))
+		{
+			Response.Code = 400;
+			Response.Body = TEXT("{\"error\":{\"code\":400077,\"message\":\"The maximum request size has been exceeded.\"}}");
+			return Response;
+		}
+
+		const FString TargetLang = GetQueryParam(Request, TEXT("to"));
+		TArray<TSharedPtr<FJsonValue>> Results;
+		for (const TSharedPtr<FJsonValue>& Item : Items)
+		{
+			const TSharedPtr<FJsonObject>* ItemObject = nullptr;
+			FString Source;
+			if (Item->TryGetObject(ItemObject))
+			{
+				(*ItemObject)->TryGetStringField(TEXT("Text"), Source);
+			}
+
+			TSharedRef<FJsonObject> Translation = MakeShared<FJsonObject>();
+			Translation->SetStringField(TEXT("text"), MakeTranslation(Source, TargetLang));
+			Translation->SetStringField(TEXT("to"), TargetLang);
+
+			TArray<TSharedPtr<FJsonValue>> Translations;
+			Translations.Add(MakeShared<FJsonValueObject>(Translation));
+
+			TSharedRef<FJsonObject> Result = MakeShared<FJsonObject>();
+			Result->SetArrayField(TEXT("translations"), Translations);
+			Results.Add(MakeShared<FJsonValueObject>(Result));
+		}
+
+		Response.Body = ToJson(Results);
+		return Response;
+	});
+
+	// MyMemory：GET /get?q=..&langpair=src|dst，返回 {"responseData":{"translatedText":".."},"responseStatus":200}
+	BindProviderRoute(ETranslateProvider::YoudaoFree, TEXT("/get"), false, [](const FHttpServerRequest& Request, int32& OutTextCount)
+	{
+		FString SourceLang;
+		FString TargetLang;
+		GetQueryParam(Request, TEXT("langpair")).Split(TEXT("|"), &SourceLang, &TargetLang);
+		OutTextCount = 1;
+
+		TSharedRef<FJsonObject> Data = MakeShared<FJsonObject>();
+		Data->SetStringField(TEXT("translatedText"), MakeTranslation(GetQueryParam(Request, TEXT("q")), TargetLang));
+
+		TSharedRef<FJsonObject> Root = MakeShared<FJsonObject>();
+		Root->SetObjectField(TEXT("responseData"), Data);
+		Root->SetNumberField(TEXT("responseStatus"), 200);
+
+		FMockResponse Response;
+		Response.Body = ToJson(Root);
+		return Response;
+	});
+
+	// 百度：POST 表单 q（多条用换行拼接）、to、appid、sign，返回 {"trans_result":[{"src":"..","dst":".."}]}；错误为 {"error_code","error_msg"}
+	BindProviderRoute(ETranslateProvider::Baidu, TEXT("/api/trans/vip/translate"), true, [this](const FHttpServerRequest& Request, int32& OutTextCount)
+	{
+		const TArray<TPair<FString, FString>> Form = ParseForm(GetBodyString(Request));
+		FMockResponse Response;
+
+		if (FindFormValue(Form, TEXT("appid")).IsEmpty() || FindFormValue(Form, TEXT("sign")).IsEmpty())
+		{
+			Response.Body = TEXT("{\"error_code\":\"52003\",\"error_msg\":\"UNAUTHORIZED USER\"}");
+			return Response;
+		}
+
+		TArray<FString> Lines;
+		FindFormValue(Form, TEXT("q")).ParseIntoArray(Lines, TEXT("\n"), false);
+		OutTextCount = Lines.Num();
+		if (ExceedsBatchLimit(ETranslateProvider::Baidu, Lines.Num()))
+		{
+			Response.Body = TEXT("{\"error_code\":\"54005\",\"error_msg\":\"Long query too frequently, please try later\"}");
+			return Response;
+		}
+
+		const FString TargetLang = FindFormValue(Form, TEXT("to"));
+		TArray<TSharedPtr<FJsonValue>> Results;
+		for (const FString& Line : Lines)
+		{
+			TSharedRef<FJsonObject> Result = MakeShared<FJsonObject>();
+			Result->SetStringField(TEXT("src"), Line);
+			Result->SetStringField(TEXT("dst"), MakeTranslation(Line, TargetLang));
+			Results.Add(MakeShared<FJsonValueObject>(Result));
+		}
+
+		TSharedRef<FJsonObject> Root = MakeShared<FJsonObject>();
+		Root->SetStringField(TEXT("from"), TEXT("auto"));
+		Root->SetStringField(TEXT("to"), TargetLang);
+		Root->SetArrayField(TEXT("trans_result"), Results);
+		Response.Body = ToJson(Root);
+		return Response;
+	});
+
+	// Google API：POST /language/translate/v2?key=..，表单 target 和重复的 q，返回 {"data":{"translations":[{"translatedText":".."}]}}
+	BindProviderRoute(ETranslateProvider::Google, TEXT("/language/translate/v2"), true, [this](const FHttpServerRequest& Request, int32& OutTextCount)
+	{
+		FMockResponse Response;
+		if (GetQueryParam(Request, TEXT("key")).IsEmpty())
+		{
+			Response.Code = 400;
+			Response.Body = TEXT("{\"error\":{\"code\":400,\"message\":\"API key not valid. Please pass a valid API key.\"}}");
+			return Response;
+		}
+
+		const TArray<TPair<FString, FString>> Form = ParseForm(GetBodyString(Request));
+		const FString TargetLang = FindFormValue(Form, TEXT("target"));
+
+		TArray<TSharedPtr<FJsonValue>> Translations;
+		for (const TPair<FString, FString>& Field : Form)
+		{
+			if (Field.Key == TEXT("q"))
+			{
+				TSharedRef<FJsonObject> Translation = MakeShared<FJsonObject>();
+				Translation->SetStringField(TEXT("translatedText"), MakeTranslation(Field.Value, TargetLang));
+				Translations.Add(MakeShared<FJsonValueObject>(Translation));
+			}
+		}
+
+		OutTextCount = Translations.Num();
+		if (ExceedsBatchLimit(ETranslateProvider::Google, Translations.Num()))
+		{
+			Response.Code = 400;
+			Response.Body = TEXT("{\"error\":{\"code\":400,\"message\":\"Too many text segments\"}}");
+			return Response;
+		}
+
+		TSharedRef<FJsonObject> Data = MakeShared<FJsonObject>();
+		Data->SetArrayField(TEXT("translations"), Translations);
+		TSharedRef<FJsonObject> Root = MakeShared<FJsonObject>();
+		Root->SetObjectField(TEXT("data"), Data);
+		Response.Body = ToJson(Root);
+		return Response;
+	});
+
+	// 自定义 API：POST /custom，{"text","target_lang"} -> {"translated_text"}；{"texts":[..]} -> {"translated_texts":[..]}
+	BindProviderRoute(ETranslateProvider::Custom, TEXT("/custom"), true, [this](const FHttpServerRequest& Request, int32& OutTextCount)
+	{
+		FMockResponse Response;
+		TSharedPtr<FJsonObject> RequestObject;
+		TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(GetBodyString(Request));
+		if (!FJsonSerializer::Deserialize(Reader, RequestObject) || !RequestObject.IsValid())
+		{
+			Response.Code = 400;
+			Response.Body = TEXT("{\"error\":\"invalid json\"}");
+			return Response;
+		}
+
+		const FString TargetLang = RequestObject->GetStringField(TEXT("target_lang"));
+		TSharedRef<FJsonObject> Root = MakeShared<FJsonObject>();
+
+		const TArray<TSharedPtr<FJsonValue>>* Texts = nullptr;
+		if (RequestObject->TryGetArrayField(TEXT("texts"), Texts))
+		{
+			OutTextCount = Texts->Num();
+			if (ExceedsBatchLimit(ETranslateProvider::Custom, Texts->Num()))
+			{
+				Response.Code = 400;
+				Response.Body = TEXT("{\"error\":\"too many texts\"}");
+				return Response;
+			}
+
+			TArray<TSharedPtr<FJsonValue>> Results;
+			for (const TSharedPtr<FJsonValue>& Text : *Texts)
+			{
+				Results.Add(MakeShared<FJsonValueString>(MakeTranslation(Text->AsString(), TargetLang)));
+			}
+			Root->SetArrayField(TEXT("translated_texts"), Results);
+		}
+		else
+		{
+			OutTextCount = 1;
+			Root->SetStringField(TEXT("translated_text"), MakeTranslation(RequestObject->GetStringField(TEXT("text")), TargetLang));
+		}
+
+		Response.Body = ToJson(Root);
+		return Response;
+	});
+
+	HttpServerModule.StartAllListeners();
+
+	UE_LOG(LogTemp, Log, TEXT("Mock translation server listening on %s (latency %.0f ms +/- %.0f, error rate %.2f, 429 rate %.2f, seed %d)"),
+		*GetBaseUrl(), Config.LatencyMs, Config.LatencySpreadMs, Config.ErrorRate, Config.RateLimitRate, Config.Seed);
+	return true;
+}
+
+void FMockTranslationServer::Stop()
+{
+	if (Router.IsValid())
+	{
+		for (const FHttpRouteHandle& Handle : RouteHandles)
+		{
+			Router->UnbindRoute(Handle);
+		}
+
+		// 监听器可能由其他模块共用（如 Remote Control），这里只解除路由
+		UE_LOG(LogTemp, Log, TEXT("Mock translation server stopped: %d requests, %d texts, %d injected errors, %d injected 429s, %d rejected batches"),
+			Stats.Requests, Stats.Texts, Stats.InjectedErrors, Stats.InjectedRateLimits, Stats.RejectedBatches);
+	}
+	RouteHandles.Empty();
+	Router.Reset();
+
+	// 恢复设置
+	if (SavedUrlOverrides.IsSet())
+	{
+		ULanguageOneSettings* Settings = GetMutableDefault<ULanguageOneSettings>();
+		Settings->ProviderBaseUrlOverrides = SavedUrlOverrides.GetValue();
+		Settings->CustomApiUrl = SavedCustomApiUrl;
+		Settings->BaiduAppId = SavedBaiduAppId;
+		Settings->BaiduSecretKey = SavedBaiduSecretKey;
+		Settings->GoogleApiKey = SavedGoogleApiKey;
+		SavedUrlOverrides.Reset();
+	}
+}
+
+void FMockTranslationServer::PointSettingsAtServer()
+{
+	ULanguageOneSettings* Settings = GetMutableDefault<ULanguageOneSettings>();
+
+	if (!SavedUrlOverrides.IsSet())
+	{
+		SavedUrlOverrides = Settings->ProviderBaseUrlOverrides;
+		SavedCustomApiUrl = Settings->CustomApiUrl;
+		SavedBaiduAppId = Settings->BaiduAppId;
+		SavedBaiduSecretKey = Settings->BaiduSecretKey;
+		SavedGoogleApiKey = Settings->GoogleApiKey;
+	}
+
+	const FString BaseUrl = GetBaseUrl();
+	const UEnum* ProviderEnum = StaticEnum<ETranslateProvider>();
+	for (int32 Index = 0; Index < ProviderEnum->NumEnums() - 1; Index++)
+	{
+		Settings->ProviderBaseUrlOverrides.Add((ETranslateProvider)ProviderEnum->GetValueByIndex(Index), BaseUrl);
+	}
+
+	// 需要密钥的服务填入占位值，模拟服务器只检查是否存在
+	Settings->CustomApiUrl = BaseUrl / TEXT("custom");
+	Settings->BaiduAppId = TEXT("mock");
+	Settings->BaiduSecretKey = TEXT("mock");
+	Settings->GoogleApiKey = TEXT("mock");
+}
+
+void FMockTranslationServer::BindProviderRoute(ETranslateProvider Provider, const FString& Path, bool bPost, FTranslateFunc TranslateFunc)
+{
+	using namespace LanguageOneMockServer;
+
+	FHttpRouteHandle Handle = Router->BindRoute(
+		FHttpPath(Path),
+		bPost ? EHttpServerRequestVerbs::VERB_POST : EHttpServerRequestVerbs::VERB_GET,
+		MakeHandler([this, Provider, TranslateFunc](const FHttpServerRequest& Request, const FHttpResultCallback& OnComplete)
+		{
+			Stats.Requests++;
+			Stats.RequestsByProvider.FindOrAdd(Provider)++;
+
+			FMockResponse Response;
+			if (!TryInjectFailure(Response))
+			{
+				int32 TextCount = 0;
+				Response = TranslateFunc(Request, TextCount);
+				if (Response.Code == 200)
+				{
+					Stats.Texts += TextCount;
+				}
+			}
+
+			// 延迟后在游戏线程发送响应
+			FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateLambda([OnComplete, Response](float DeltaTime)
+			{
+				TUniquePtr<FHttpServerResponse> HttpResponse = FHttpServerResponse::Create(Response.Body, Response.ContentType);
+				HttpResponse->Code = (EHttpServerResponseCodes)Response.Code;
+				if (!Response.RetryAfter.IsEmpty())
+				{
+					HttpResponse->Headers.Add(TEXT("Retry-After"), { Response.RetryAfter });
+				}
+				OnComplete(MoveTemp(HttpResponse));
+				return false;
+			}), SampleLatencySeconds());
+
+			return true;
+		}));
+
+	if (Handle.IsValid())
+	{
+		RouteHandles.Add(Handle);
+	}
+	else
+	{
+		UE_LOG(LogTemp, Warning, TEXT("Mock translation server: failed to bind %s"), *Path);
+	}
+}
+
+bool FMockTranslationServer::TryInjectFailure(FMockResponse& OutResponse)
+{
+	const float Roll = Random.GetFraction();
+	if (Roll < Config.RateLimitRate)
+	{
+		Stats.InjectedRateLimits++;
+		OutResponse.Code = 429;
+		OutResponse.Body = TEXT("{\"error\":{\"code\":429,\"message\":\"Too many requests\"}}");
+		OutResponse.RetryAfter = FString::FromInt(Config.RetryAfterSeconds);
+		return true;
+	}
+	if (Roll < Config.RateLimitRate + Config.ErrorRate)
+	{
+		Stats.InjectedErrors++;
+		OutResponse.Code = 500;
+		OutResponse.Body = TEXT("{\"error\":{\"code\":500,\"message\":\"Injected server error\"}}");
+		return true;
+	}
+	return false;
+}
+
+bool FMockTranslationServer::ExceedsBatchLimit(ETranslateProvider Provider, int32 TextCount)
+{
+	const int32 Limit = Config.MaxBatchTexts > 0 ? Config.MaxBatchTexts : FCommentTranslator::GetMaxBatchSize(Provider);
+	if (TextCount > Limit)
+	{
+		Stats.RejectedBatches++;
+		return true;
+	}
+	return false;
+}
+
+float FMockTranslationServer::SampleLatencySeconds()
+{
+	float LatencyMs = Config.LatencyMs;
+	switch (Config.LatencyDistribution)
+	{
+	case EMockLatencyDistribution::Uniform:
+		LatencyMs = Random.FRandRange(Config.LatencyMs - Config.LatencySpreadMs, Config.LatencyMs + Config.LatencySpreadMs);
+		break;
+
+	case EMockLatencyDistribution::LogNormal:
+		if (Config.LatencyMs > 0.0f && Config.LatencySpreadMs > 0.0f)
+		{
+			// 中位数 LatencyMs，一个标准差对应 LatencyMs + LatencySpreadMs
+			const float Sigma = FMath::Loge((Config.LatencyMs + Config.LatencySpreadMs) / Config.LatencyMs);
+			LatencyMs = Config.LatencyMs * FMath::Exp(Sigma * LanguageOneMockServer::SampleStandardNormal(Random));
+		}
+		break;
+
+	default:
+		break;
+	}
+	return FMath::Max(LatencyMs, 0.0f) / 1000.0f;
+}
+
+FString FMockTranslationServer::MakeTranslation(const FString& SourceText, const FString& TargetLang)
+{
+	return FString::Printf(TEXT("[%s] %s"), *TargetLang, *SourceText);
+}
+
+FString FMockTranslationServer::MakeAuthToken()
+{
+	using namespace LanguageOneMockServer;
+
+	const int64 Expiry = FDateTime::UtcNow().ToUnixTimestamp() + AuthTokenLifetimeSeconds;
+	return Base64UrlEncode(TEXT("{\"alg\":\"HS256\",\"typ\":\"JWT\"}")) + TEXT(".")
+		+ Base64UrlEncode(FString::Printf(TEXT("{\"exp\":%lld}"), Expiry)) + TEXT(".")
+		+ Base64UrlEncode(TEXT("mock"));
+}
+
+// 控制台命令：LanguageOne.MockServer.Start [端口] [延迟ms] [错误率] [429比例]、LanguageOne.MockServer.Stop
+static FAutoConsoleCommand GMockServerStartCommand(
+	TEXT("LanguageOne.MockServer.Start"),
+	TEXT("Start the loopback mock translation server and point all providers at it. Args: [Port] [LatencyMs] [ErrorRate] [RateLimitRate]"),
+	FConsoleCommandWithArgsDelegate::CreateLambda([](const TArray<FString>& Args)
+	{
+		FMockTranslationServerConfig Config;
+		if (Args.IsValidIndex(0)) { LexFromString(Config.Port, *Args[0]); }
+		if (Args.IsValidIndex(1)) { LexFromString(Config.LatencyMs, *Args[1]); }
+		if (Args.IsValidIndex(2)) { LexFromString(Config.ErrorRate, *Args[2]); }
+		if (Args.IsValidIndex(3)) { LexFromString(Config.RateLimitRate, *Args[3]); }
+
+		if (FMockTranslationServer::Get().Start(Config))
+		{
+			FMockTranslationServer::Get().PointSettingsAtServer();
+		}
+	}));
+
+static FAutoConsoleCommand GMockServerStopCommand(
+	TEXT("LanguageOne.MockServer.Stop"),
+	TEXT("Stop the mock translation server and restore provider settings"),
+	FConsoleCommandDelegate::CreateLambda([]()
+	{
+		FMockTranslationServer::Get().Stop();
+	}));
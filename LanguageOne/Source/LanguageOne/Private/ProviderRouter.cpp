@@ -0,0 +1,328 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "ProviderRouter.h"
+#include "CommentTranslator.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Json.h"
+
+namespace LanguageOneProviderRouter
+{
+	static const int32 StatsVersion = 1;
+
+	/** 移动平均的新样本权重 */
+	static const double SmoothingFactor = 0.2;
+
+	/** 没有样本的服务按该耗时估计（秒），保证新服务会被尝试 */
+	static const double PriorLatencySeconds = 1.0;
+
+	/** 失败率的半衰期（分钟）：之前失败的服务过一段时间后重新参与排序 */
+	static const double ErrorRateHalfLifeMinutes = 30.0;
+
+	/** 每个服务保留的最近耗时样本数，以及计算分位数需要的最少样本数 */
+	static const int32 MaxRecentLatencies = 64;
+	static const int32 MinPercentileSamples = 8;
+
+	/** 定时保存间隔（秒） */
+	static const float SaveIntervalSeconds = 60.0f;
+}
+
+FProviderRouter& FProviderRouter::Get()
+{
+	static FProviderRouter Instance;
+	return Instance;
+}
+
+FString FProviderRouter::GetStatsFilePath()
+{
+	return FPaths::ProjectSavedDir() / TEXT("LanguageOne") / TEXT("ProviderStats.json");
+}
+
+void FProviderRouter::Initialize()
+{
+	if (bInitialized)
+	{
+		return;
+	}
+	bInitialized = true;
+
+	Load();
+	TickerHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateRaw(this, &FProviderRouter::Tick), LanguageOneProviderRouter::SaveIntervalSeconds);
+}
+
+void FProviderRouter::Shutdown()
+{
+	if (!bInitialized)
+	{
+		return;
+	}
+	bInitialized = false;
+
+	if (TickerHandle.IsValid())
+	{
+		FTSTicker::GetCoreTicker().RemoveTicker(TickerHandle);
+		TickerHandle.Reset();
+	}
+
+	Save();
+}
+
+bool FProviderRouter::Tick(float DeltaTime)
+{
+	Save();
+	return true;
+}
+
+void FProviderRouter::RecordResult(ETranslateProvider Provider, double LatencySeconds, bool bSucceeded)
+{
+	using namespace LanguageOneProviderRouter;
+
+	FProviderHealth& Entry = Health.FindOrAdd(Provider);
+	const double Failure = bSucceeded ? 0.0 : 1.0;
+	if (Entry.Samples == 0)
+	{
+		Entry.LatencySeconds = LatencySeconds;
+		Entry.ErrorRate = SmoothingFactor * Failure;
+	}
+	else
+	{
+		// 先按时间衰减旧的失败率，再计入新样本
+		Entry.ErrorRate = GetHealth(Provider).ErrorRate;
+		Entry.LatencySeconds += SmoothingFactor * (LatencySeconds - Entry.LatencySeconds);
+		Entry.ErrorRate += SmoothingFactor * (Failure - Entry.ErrorRate);
+	}
+	Entry.Samples++;
+	Entry.LastSampleUtc = FDateTime::UtcNow();
+	bDirty = true;
+
+	if (bSucceeded)
+	{
+		TArray<double>& Recent = RecentLatencies.FindOrAdd(Provider);
+		if (Recent.Num() >= MaxRecentLatencies)
+		{
+			Recent.RemoveAt(0);
+		}
+		Recent.Add(LatencySeconds);
+	}
+}
+
+bool FProviderRouter::GetLatencyPercentile(ETranslateProvider Provider, double Percentile, double& OutSeconds) const
+{
+	const TArray<double>* Recent = RecentLatencies.Find(Provider);
+	if (!Recent || Recent->Num() < LanguageOneProviderRouter::MinPercentileSamples)
+	{
+		return false;
+	}
+
+	TArray<double> Sorted = *Recent;
+	Sorted.Sort();
+	const int32 Index = FMath::Clamp(FMath::CeilToInt(Percentile / 100.0 * Sorted.Num()) - 1, 0, Sorted.Num() - 1);
+	OutSeconds = Sorted[Index];
+	return true;
+}
+
+FProviderHealth FProviderRouter::GetHealth(ETranslateProvider Provider) const
+{
+	using namespace LanguageOneProviderRouter;
+
+	const FProviderHealth* Entry = Health.Find(Provider);
+	if (!Entry || Entry->Samples == 0)
+	{
+		FProviderHealth Prior;
+		Prior.LatencySeconds = PriorLatencySeconds;
+		return Prior;
+	}
+
+	FProviderHealth Result = *Entry;
+	const double AgeMinutes = FMath::Max(0.0, (FDateTime::UtcNow() - Entry->LastSampleUtc).GetTotalMinutes());
+	Result.ErrorRate *= FMath::Pow(0.5, AgeMinutes / ErrorRateHalfLifeMinutes);
+	return Result;
+}
+
+bool FProviderRouter::MeetsSlo(ETranslateProvider Provider) const
+{
+	const ULanguageOneSettings* Settings = GetDefault<ULanguageOneSettings>();
+	const FProviderHealth Current = GetHealth(Provider);
+	return Current.LatencySeconds <= Settings->RoutingLatencySloSeconds && Current.ErrorRate <= Settings->RoutingMaxErrorRate;
+}
+
+double FProviderRouter::GetScore(ETranslateProvider Provider, ETranslationRequestPriority Priority) const
+{
+	const ULanguageOneSettings* Settings = GetDefault<ULanguageOneSettings>();
+	const FProviderHealth Current = GetHealth(Provider);
+	const double SuccessRate = FMath::Max(0.01, 1.0 - Current.ErrorRate);
+	const double LatencySeconds = FMath::Max(0.01, Current.LatencySeconds);
+
+	// 交互请求：预计拿到结果的时间越短越好
+	if (Priority == ETranslationRequestPriority::Interactive)
+	{
+		return -LatencySeconds / SuccessRate;
+	}
+
+	// 批量请求：每秒成功翻译的文本数，受速率限制和并发上限约束
+	const float* ConfiguredRate = Settings->ProviderRequestsPerSecond.Find(Provider);
+	const double RequestsPerSecond = FMath::Min(ConfiguredRate ? (double)*ConfiguredRate : 1.0, FMath::Max(1, Settings->MaxConcurrentRequests) / LatencySeconds);
+	return SuccessRate * FCommentTranslator::GetMaxBatchSize(Provider) * RequestsPerSecond;
+}
+
+TArray<ETranslateProvider> FProviderRouter::RankProviders(ETranslationRequestPriority Priority) const
+{
+	const ULanguageOneSettings* Settings = GetDefault<ULanguageOneSettings>();
+
+	TArray<ETranslateProvider> Healthy;
+	TArray<ETranslateProvider> Degraded;
+	TArray<ETranslateProvider> Paid;
+	for (ETranslateProvider Provider : Settings->RoutingProviders)
+	{
+		if (IsPaidProvider(Provider))
+		{
+			if (IsProviderConfigured(Provider))
+			{
+				Paid.AddUnique(Provider);
+			}
+		}
+		else if (MeetsSlo(Provider))
+		{
+			Healthy.AddUnique(Provider);
+		}
+		else
+		{
+			Degraded.AddUnique(Provider);
+		}
+	}
+
+	auto ByScore = [this, Priority](ETranslateProvider A, ETranslateProvider B)
+	{
+		return GetScore(A, Priority) > GetScore(B, Priority);
+	};
+	Healthy.StableSort(ByScore);
+	Degraded.StableSort(ByScore);
+	Paid.StableSort(ByScore);
+
+	// 有达标的免费服务时不使用付费服务；否则付费服务优先，免费服务作为备用
+	TArray<ETranslateProvider> Ranked;
+	if (Healthy.Num() > 0)
+	{
+		Ranked = MoveTemp(Healthy);
+		Ranked.Append(Degraded);
+	}
+	else
+	{
+		Ranked = MoveTemp(Paid);
+		Ranked.Append(Degraded);
+	}
+
+	if (Ranked.Num() > 0 && (!LastPreferred.IsSet() || LastPreferred.GetValue() != Ranked[0]))
+	{
+		const FProviderHealth Preferred = GetHealth(Ranked[0]);
+		UE_LOG(LogTemp, Log, TEXT("Adaptive routing now prefers %s (latency %.2fs, error rate %.0f%%, %lld samples)"),
+			*StaticEnum<ETranslateProvider>()->GetNameStringByValue((int64)Ranked[0]), Preferred.LatencySeconds, Preferred.ErrorRate * 100.0, Preferred.Samples);
+		LastPreferred = Ranked[0];
+	}
+
+	return Ranked;
+}
+
+bool FProviderRouter::IsPaidProvider(ETranslateProvider Provider)
+{
+	return Provider == ETranslateProvider::Baidu
+		|| Provider == ETranslateProvider::Google
+		|| Provider == ETranslateProvider::Custom;
+}
+
+bool FProviderRouter::IsProviderConfigured(ETranslateProvider Provider)
+{
+	const ULanguageOneSettings* Settings = GetDefault<ULanguageOneSettings>();
+	switch (Provider)
+	{
+	case ETranslateProvider::Baidu:
+		return !Settings->BaiduAppId.IsEmpty() && !Settings->BaiduSecretKey.IsEmpty();
+	case ETranslateProvider::Google:
+		return !Settings->GoogleApiKey.IsEmpty();
+	case ETranslateProvider::Custom:
+		return !Settings->CustomApiUrl.IsEmpty();
+	default:
+		return true;
+	}
+}
+
+void FProviderRouter::Load()
+{
+	const FString Path = GetStatsFilePath();
+	FString Content;
+	if (!FFileHelper::LoadFileToString(Content, *Path))
+	{
+		return;
+	}
+
+	TSharedPtr<FJsonObject> Root;
+	TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(Content);
+	if (!FJsonSerializer::Deserialize(Reader, Root) || !Root.IsValid() || Root->GetIntegerField(TEXT("version")) != LanguageOneProviderRouter::StatsVersion)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("Ignoring unreadable provider stats %s"), *Path);
+		return;
+	}
+
+	const TSharedPtr<FJsonObject>* Providers = nullptr;
+	if (!Root->TryGetObjectField(TEXT("providers"), Providers))
+	{
+		return;
+	}
+
+	for (const TPair<FString, TSharedPtr<FJsonValue>>& Pair : (*Providers)->Values)
+	{
+		const int64 ProviderValue = StaticEnum<ETranslateProvider>()->GetValueByNameString(Pair.Key);
+		const TSharedPtr<FJsonObject>* Fields = nullptr;
+		if (ProviderValue == INDEX_NONE || !Pair.Value->TryGetObject(Fields))
+		{
+			continue;
+		}
+
+		FProviderHealth Entry;
+		Entry.LatencySeconds = (*Fields)->GetNumberField(TEXT("latency_seconds"));
+		Entry.ErrorRate = FMath::Clamp((*Fields)->GetNumberField(TEXT("error_rate")), 0.0, 1.0);
+		Entry.Samples = (int64)(*Fields)->GetNumberField(TEXT("samples"));
+		FDateTime::ParseIso8601(*(*Fields)->GetStringField(TEXT("last_sample_utc")), Entry.LastSampleUtc);
+		Health.Add((ETranslateProvider)ProviderValue, Entry);
+	}
+
+	UE_LOG(LogTemp, Log, TEXT("Provider stats loaded: %d providers from %s"), Health.Num(), *Path);
+}
+
+void FProviderRouter::Save()
+{
+	if (!bDirty)
+	{
+		return;
+	}
+
+	TSharedRef<FJsonObject> Providers = MakeShared<FJsonObject>();
+	for (const TPair<ETranslateProvider, FProviderHealth>& Pair : Health)
+	{
+		TSharedRef<FJsonObject> Fields = MakeShared<FJsonObject>();
+		Fields->SetNumberField(TEXT("latency_seconds"), Pair.Value.LatencySeconds);
+		Fields->SetNumberField(TEXT("error_rate"), Pair.Value.ErrorRate);
+		Fields->SetNumberField(TEXT("samples"), (double)Pair.Value.Samples);
+		Fields->SetStringField(TEXT("last_sample_utc"), Pair.Value.LastSampleUtc.ToIso8601());
+		Providers->SetObjectField(StaticEnum<ETranslateProvider>()->GetNameStringByValue((int64)Pair.Key), Fields);
+	}
+
+	TSharedRef<FJsonObject> Root = MakeShared<FJsonObject>();
+	Root->SetNumberField(TEXT("version"), LanguageOneProviderRouter::StatsVersion);
+	Root->SetObjectField(TEXT("providers"), Providers);
+
+	FString Content;
+	TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&Content);
+	if (!FJsonSerializer::Serialize(Root, Writer))
+	{
+		return;
+	}
+
+	const FString Path = GetStatsFilePath();
+	if (!FFileHelper::SaveStringToFile(Content, *Path, FFileHelper::EEncodingOptions::ForceUTF8WithoutBOM))
+	{
+		UE_LOG(LogTemp, Warning, TEXT("Failed to write provider stats %s"), *Path);
+		return;
+	}
+	bDirty = false;
+}
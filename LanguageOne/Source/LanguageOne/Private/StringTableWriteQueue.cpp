@@ -0,0 +1,141 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "StringTableWriteQueue.h"
+#include "LanguageOneTrace.h"
+#include "Internationalization/StringTable.h"
+#include "Internationalization/StringTableCore.h"
+#include "Subsystems/AssetEditorSubsystem.h"
+#include "IStringTableEditor.h"
+#include "Editor.h"
+
+FStringTableWriteQueue& FStringTableWriteQueue::Get()
+{
+	static FStringTableWriteQueue Instance;
+	return Instance;
+}
+
+void FStringTableWriteQueue::Enqueue(UStringTable* StringTable, const FString& Key, const FString& NewText, const FName& MetaDataId, const FString& MetaDataValue)
+{
+	if (!StringTable)
+	{
+		return;
+	}
+
+	PendingWrites.FindOrAdd(StringTable).Add({ Key, NewText, MetaDataId, MetaDataValue });
+
+	// 下一帧统一写入
+	if (!TickerHandle.IsValid())
+	{
+		TickerHandle = FTSTicker::GetCoreTicker().AddTicker(
+			FTickerDelegate::CreateRaw(this, &FStringTableWriteQueue::Tick));
+	}
+}
+
+void FStringTableWriteQueue::Flush(UStringTable* StringTable)
+{
+	if (!StringTable)
+	{
+		return;
+	}
+
+	TArray<FPendingEntry> Entries;
+	if (PendingWrites.RemoveAndCopyValue(StringTable, Entries))
+	{
+		WriteEntries(StringTable, Entries);
+	}
+	else
+	{
+		RefreshStringTableEditor(StringTable);
+	}
+}
+
+void FStringTableWriteQueue::FlushAll()
+{
+	// 写入时可能触发新的写入（编辑器回调），先取出当前缓冲
+	TMap<TWeakObjectPtr<UStringTable>, TArray<FPendingEntry>> Writes = MoveTemp(PendingWrites);
+	PendingWrites.Reset();
+
+	for (TPair<TWeakObjectPtr<UStringTable>, TArray<FPendingEntry>>& Pair : Writes)
+	{
+		if (UStringTable* StringTable = Pair.Key.Get())
+		{
+			WriteEntries(StringTable, Pair.Value);
+		}
+	}
+}
+
+void FStringTableWriteQueue::Shutdown()
+{
+	if (TickerHandle.IsValid())
+	{
+		FTSTicker::GetCoreTicker().RemoveTicker(TickerHandle);
+		TickerHandle.Reset();
+	}
+
+	FlushAll();
+}
+
+bool FStringTableWriteQueue::Tick(float DeltaTime)
+{
+	// 单次定时器：写入后移除，下次有新条目时重新注册
+	TickerHandle.Reset();
+	FlushAll();
+	return false;
+}
+
+void FStringTableWriteQueue::WriteEntries(UStringTable* StringTable, const TArray<FPendingEntry>& Entries)
+{
+	if (Entries.Num() == 0)
+	{
+		return;
+	}
+
+	LANGUAGEONE_TRACE_SCOPE("LanguageOne::WriteStringTableEntries");
+
+	// 整批只调用一次 Modify（撤销快照由任务在第一次写回前记录）
+	StringTable->Modify();
+
+	FStringTableRef MutableData = StringTable->GetMutableStringTable();
+	for (const FPendingEntry& Entry : Entries)
+	{
+		const FTextKey Key(Entry.Key);
+		MutableData->SetSourceString(Key, Entry.Text);
+		MutableData->SetMetaData(Key, Entry.MetaDataId, Entry.MetaDataValue);
+	}
+
+	RefreshStringTableEditor(StringTable);
+
+	UE_LOG(LogTemp, Verbose, TEXT("Flushed %d string table entries to %s"), Entries.Num(), *StringTable->GetName());
+}
+
+void FStringTableWriteQueue::RefreshStringTableEditor(UStringTable* StringTable)
+{
+	if (!StringTable)
+	{
+		return;
+	}
+
+	// 触发 PostEditChange 通知
+	StringTable->PostEditChange();
+
+	// 尝试使用 IStringTableEditor 接口刷新编辑器
+	if (FModuleManager::Get().IsModuleLoaded("StringTableEditor") && GEditor)
+	{
+		UAssetEditorSubsystem* AssetEditorSubsystem = GEditor->GetEditorSubsystem<UAssetEditorSubsystem>();
+		if (AssetEditorSubsystem)
+		{
+			IAssetEditorInstance* EditorInstance = AssetEditorSubsystem->FindEditorForAsset(StringTable, false);
+			if (EditorInstance)
+			{
+				// 尝试转换为 IStringTableEditor 接口
+				IStringTableEditor* StringTableEditor = static_cast<IStringTableEditor*>(EditorInstance);
+				if (StringTableEditor)
+				{
+					// 使用官方 API 刷新编辑器
+					// 传入空字符串可以刷新整个表格而不改变选中项
+					StringTableEditor->RefreshStringTableEditor(FString());
+				}
+			}
+		}
+	}
+}
@@ -0,0 +1,290 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "StructTextPlan.h"
+#include "LanguageOneCompatibility.h"
+#include "UObject/UnrealType.h"
+
+namespace LanguageOneStructTextPlan
+{
+	/** 嵌套深度上限（防止自引用结构体通过容器无限展开） */
+	static const int32 MaxNestingDepth = 8;
+
+	/** FString 字段是否需要翻译：字段名包含 text、desc、content、comment、tooltip 等关键字 */
+	static bool IsTranslatableStringName(const FProperty* Property)
+	{
+		const FString PropertyName = Property->GetName().ToLower();
+		return PropertyName.Contains(TEXT("text"))
+			|| PropertyName.Contains(TEXT("desc"))
+			|| PropertyName.Contains(TEXT("content"))
+			|| PropertyName.Contains(TEXT("comment"))
+			|| PropertyName.Contains(TEXT("tooltip"));
+	}
+}
+
+TSharedRef<const FStructTextPlan> FStructTextPlan::Get(const UScriptStruct* Struct)
+{
+	static TMap<TWeakObjectPtr<const UScriptStruct>, TSharedPtr<const FStructTextPlan>> Cache;
+
+	if (!Struct)
+	{
+		static const TSharedRef<const FStructTextPlan> EmptyPlan = MakeShared<FStructTextPlan>();
+		return EmptyPlan;
+	}
+
+	// 结构体重新编译后属性链会变化，需要重建
+	if (const TSharedPtr<const FStructTextPlan>* Cached = Cache.Find(Struct))
+	{
+		if ((*Cached)->PropertyLink == Struct->PropertyLink && (*Cached)->StructureSize == Struct->GetStructureSize())
+		{
+			return Cached->ToSharedRef();
+		}
+	}
+
+	TSharedRef<FStructTextPlan> Plan = MakeShared<FStructTextPlan>();
+	Plan->PropertyLink = Struct->PropertyLink;
+	Plan->StructureSize = Struct->GetStructureSize();
+
+	TArray<const UScriptStruct*> Stack;
+	BuildStruct(Struct, 0, FString(), Plan->Root, Stack);
+
+	UE_LOG(LogTemp, Verbose, TEXT("Built text extraction plan for %s: %d top-level fields"), *Struct->GetName(), Plan->Root.Nodes.Num());
+
+	Cache.Add(Struct, Plan);
+	return Plan;
+}
+
+void FStructTextPlan::BuildStruct(const UScriptStruct* Struct, int32 BaseOffset, const FString& Prefix, FScope& OutScope, TArray<const UScriptStruct*>& Stack)
+{
+	if (!Struct || Stack.Contains(Struct) || Stack.Num() >= LanguageOneStructTextPlan::MaxNestingDepth)
+	{
+		return;
+	}
+	Stack.Push(Struct);
+
+	for (TFieldIterator<FProperty> It(Struct); It; ++It)
+	{
+		const FProperty* Property = *It;
+		const int32 ArrayDim = LanguageOnePropertyHelper::GetArrayDim(Property);
+		const int32 ElementSize = LanguageOnePropertyHelper::GetElementSize(Property);
+
+		for (int32 ArrayIndex = 0; ArrayIndex < ArrayDim; ArrayIndex++)
+		{
+			FString Name = Prefix + Property->GetName();
+			if (ArrayDim > 1)
+			{
+				Name += FString::Printf(TEXT("[%d]"), ArrayIndex);
+			}
+			BuildProperty(Property, Property, BaseOffset + Property->GetOffset_ForInternal() + ArrayIndex * ElementSize, Name, OutScope, Stack);
+		}
+	}
+
+	Stack.Pop();
+}
+
+void FStructTextPlan::BuildProperty(const FProperty* Property, const FProperty* NameProperty, int32 Offset, const FString& Name, FScope& OutScope, TArray<const UScriptStruct*>& Stack)
+{
+	if (CastField<FTextProperty>(Property))
+	{
+		FNode& Node = OutScope.Nodes.AddDefaulted_GetRef();
+		Node.Kind = ENodeKind::Text;
+		Node.Offset = Offset;
+		Node.Name = Name;
+		Node.bTranslatable = true;
+	}
+	else if (CastField<FStrProperty>(Property))
+	{
+		FNode& Node = OutScope.Nodes.AddDefaulted_GetRef();
+		Node.Kind = ENodeKind::String;
+		Node.Offset = Offset;
+		Node.Name = Name;
+		Node.bTranslatable = LanguageOneStructTextPlan::IsTranslatableStringName(NameProperty);
+	}
+	else if (const FStructProperty* StructProperty = CastField<FStructProperty>(Property))
+	{
+		// 嵌套结构体展开为偏移，不需要额外的节点
+		BuildStruct(StructProperty->Struct, Offset, Name + TEXT("."), OutScope, Stack);
+	}
+	else if (const FArrayProperty* ArrayProperty = CastField<FArrayProperty>(Property))
+	{
+		TSharedPtr<FScope> Element = MakeShared<FScope>();
+		BuildProperty(ArrayProperty->Inner, ArrayProperty, 0, FString(), *Element, Stack);
+		AddContainerNode(ENodeKind::Array, ArrayProperty, Offset, Name, Element, OutScope);
+	}
+	else if (const FMapProperty* MapProperty = CastField<FMapProperty>(Property))
+	{
+		// 只处理值：键参与哈希，修改后 Map 需要重建
+		TSharedPtr<FScope> Element = MakeShared<FScope>();
+		BuildProperty(MapProperty->ValueProp, MapProperty, 0, FString(), *Element, Stack);
+		AddContainerNode(ENodeKind::Map, MapProperty, Offset, Name, Element, OutScope);
+	}
+}
+
+void FStructTextPlan::AddContainerNode(ENodeKind Kind, const FProperty* ContainerProperty, int32 Offset, const FString& Name, TSharedPtr<FScope> Element, FScope& OutScope)
+{
+	// 元素不包含文本字段的容器不进入计划
+	if (Element->Nodes.Num() == 0)
+	{
+		return;
+	}
+
+	FNode& Node = OutScope.Nodes.AddDefaulted_GetRef();
+	Node.Kind = Kind;
+	Node.Offset = Offset;
+	Node.Name = Name;
+	Node.ContainerProperty = ContainerProperty;
+	Node.bTranslatable = Element->Nodes.ContainsByPredicate([](const FNode& Child) { return Child.bTranslatable; });
+	Node.Element = MoveTemp(Element);
+}
+
+void FStructTextPlan::ForEachField(void* StructData, bool bOnlyTranslatable, TFunctionRef<void(const FStructTextField& Field)> Visitor) const
+{
+	if (!StructData)
+	{
+		return;
+	}
+
+	TArray<int32, TInlineAllocator<8>> Steps;
+	VisitScope(Root, static_cast<uint8*>(StructData), bOnlyTranslatable, Steps, Visitor);
+}
+
+void FStructTextPlan::VisitScope(const FScope& Scope, uint8* Data, bool bOnlyTranslatable, TArray<int32, TInlineAllocator<8>>& Steps, TFunctionRef<void(const FStructTextField& Field)> Visitor) const
+{
+	for (int32 NodeIndex = 0; NodeIndex < Scope.Nodes.Num(); NodeIndex++)
+	{
+		const FNode& Node = Scope.Nodes[NodeIndex];
+		if (bOnlyTranslatable && !Node.bTranslatable)
+		{
+			continue;
+		}
+
+		uint8* NodeData = Data + Node.Offset;
+		Steps.Push(NodeIndex);
+
+		switch (Node.Kind)
+		{
+		case ENodeKind::Text:
+		case ENodeKind::String:
+			{
+				FStructTextField Field;
+				Field.Text = Node.Kind == ENodeKind::Text ? reinterpret_cast<FText*>(NodeData) : nullptr;
+				Field.String = Node.Kind == ENodeKind::String ? reinterpret_cast<FString*>(NodeData) : nullptr;
+				Field.bTranslatable = Node.bTranslatable;
+				Field.Steps = Steps;
+				Visitor(Field);
+			}
+			break;
+
+		case ENodeKind::Array:
+			{
+				FScriptArrayHelper Helper(CastFieldChecked<FArrayProperty>(Node.ContainerProperty), NodeData);
+				for (int32 ElementIndex = 0; ElementIndex < Helper.Num(); ElementIndex++)
+				{
+					Steps.Push(ElementIndex);
+					VisitScope(*Node.Element, Helper.GetRawPtr(ElementIndex), bOnlyTranslatable, Steps, Visitor);
+					Steps.Pop();
+				}
+			}
+			break;
+
+		case ENodeKind::Map:
+			{
+				FScriptMapHelper Helper(CastFieldChecked<FMapProperty>(Node.ContainerProperty), NodeData);
+				for (int32 ElementIndex = 0; ElementIndex < Helper.GetMaxIndex(); ElementIndex++)
+				{
+					if (Helper.IsValidIndex(ElementIndex))
+					{
+						Steps.Push(ElementIndex);
+						VisitScope(*Node.Element, Helper.GetValuePtr(ElementIndex), bOnlyTranslatable, Steps, Visitor);
+						Steps.Pop();
+					}
+				}
+			}
+			break;
+		}
+
+		Steps.Pop();
+	}
+}
+
+bool FStructTextPlan::Resolve(void* StructData, TConstArrayView<int32> Steps, FStructTextField& OutField) const
+{
+	const FScope* Scope = &Root;
+	uint8* Data = static_cast<uint8*>(StructData);
+
+	for (int32 StepIndex = 0; Data && StepIndex < Steps.Num(); StepIndex += 2)
+	{
+		if (!Scope->Nodes.IsValidIndex(Steps[StepIndex]))
+		{
+			return false;
+		}
+
+		const FNode& Node = Scope->Nodes[Steps[StepIndex]];
+		uint8* NodeData = Data + Node.Offset;
+
+		if (Node.Kind == ENodeKind::Text || Node.Kind == ENodeKind::String)
+		{
+			if (StepIndex != Steps.Num() - 1)
+			{
+				return false;
+			}
+
+			OutField.Text = Node.Kind == ENodeKind::Text ? reinterpret_cast<FText*>(NodeData) : nullptr;
+			OutField.String = Node.Kind == ENodeKind::String ? reinterpret_cast<FString*>(NodeData) : nullptr;
+			OutField.bTranslatable = Node.bTranslatable;
+			OutField.Steps = Steps;
+			return true;
+		}
+
+		if (StepIndex + 1 >= Steps.Num())
+		{
+			return false;
+		}
+
+		const int32 ElementIndex = Steps[StepIndex + 1];
+		if (Node.Kind == ENodeKind::Array)
+		{
+			FScriptArrayHelper Helper(CastFieldChecked<FArrayProperty>(Node.ContainerProperty), NodeData);
+			Data = Helper.IsValidIndex(ElementIndex) ? Helper.GetRawPtr(ElementIndex) : nullptr;
+		}
+		else
+		{
+			FScriptMapHelper Helper(CastFieldChecked<FMapProperty>(Node.ContainerProperty), NodeData);
+			Data = Helper.IsValidIndex(ElementIndex) ? Helper.GetValuePtr(ElementIndex) : nullptr;
+		}
+		Scope = Node.Element.Get();
+	}
+
+	return false;
+}
+
+FString FStructTextPlan::DescribePath(TConstArrayView<int32> Steps) const
+{
+	FString Path;
+	const FScope* Scope = &Root;
+
+	for (int32 StepIndex = 0; Scope && StepIndex < Steps.Num(); StepIndex += 2)
+	{
+		if (!Scope->Nodes.IsValidIndex(Steps[StepIndex]))
+		{
+			break;
+		}
+
+		const FNode& Node = Scope->Nodes[Steps[StepIndex]];
+		if (!Node.Name.IsEmpty())
+		{
+			if (!Path.IsEmpty())
+			{
+				Path += TEXT(".");
+			}
+			Path += Node.Name;
+		}
+
+		if (StepIndex + 1 < Steps.Num())
+		{
+			Path += FString::Printf(TEXT("[%d]"), Steps[StepIndex + 1]);
+		}
+		Scope = Node.Element.Get();
+	}
+
+	return Path;
+}
@@ -0,0 +1,36 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/DataTable.h"
+#include "LanguageOneBenchmarkRow.generated.h"
+
+/**
+ * 性能测试生成的数据表行 - 混合 FText、需要翻译的 FString、不需要翻译的 FString 和数组
+ */
+USTRUCT()
+struct FLanguageOneBenchmarkRow : public FTableRowBase
+{
+	GENERATED_BODY()
+
+	UPROPERTY(EditAnywhere, Category = "Benchmark")
+	FText DisplayName;
+
+	UPROPERTY(EditAnywhere, Category = "Benchmark")
+	FText Description;
+
+	/** 名称包含 tooltip，按规则翻译 */
+	UPROPERTY(EditAnywhere, Category = "Benchmark")
+	FString Tooltip;
+
+	/** 标识符，按规则不翻译 */
+	UPROPERTY(EditAnywhere, Category = "Benchmark")
+	FString AssetId;
+
+	UPROPERTY(EditAnywhere, Category = "Benchmark")
+	TArray<FText> Lines;
+
+	UPROPERTY(EditAnywhere, Category = "Benchmark")
+	int32 Value = 0;
+};
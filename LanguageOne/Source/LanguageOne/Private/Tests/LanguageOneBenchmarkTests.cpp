@@ -0,0 +1,788 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "LanguageOneBenchmarkRow.h"
+#include "AssetTranslator.h"
+#include "AssetTranslationJob.h"
+#include "BilingualText.h"
+#include "CommentTranslator.h"
+#include "MockTranslationServer.h"
+#include "LanguageOneSettings.h"
+#include "Internationalization/StringTable.h"
+#include "Internationalization/StringTableCore.h"
+#include "Engine/DataTable.h"
+#include "Engine/Blueprint.h"
+#include "Engine/BlueprintGeneratedClass.h"
+#include "EdGraph/EdGraph.h"
+#include "EdGraphNode_Comment.h"
+#include "GameFramework/Actor.h"
+#include "Kismet2/KismetEditorUtilities.h"
+#include "Kismet2/BlueprintEditorUtils.h"
+#include "Editor.h"
+#include "Dom/JsonObject.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonSerializer.h"
+#include "HAL/PlatformMemory.h"
+#include "Misc/CommandLine.h"
+#include "Misc/EngineVersion.h"
+#include "Misc/FileHelper.h"
+#include "Misc/PackageName.h"
+#include "Misc/Parse.h"
+#include "Misc/Paths.h"
+#include "UObject/Package.h"
+#include "UObject/UObjectGlobals.h"
+
+/**
+ * 资产翻译性能测试 - 生成生产规模的资产，对本地模拟翻译服务器依次执行翻译、切换显示模式、还原、清除原文，
+ * 记录每一步的耗时、游戏线程卡顿、内存峰值和请求数量，写入 Saved/LanguageOne/Benchmarks/<测试名>.json 并与基线比较；
+ * 翻译、还原、清除原文之后抽查几个文本字段的内容
+ *
+ * 命令行参数：
+ * -LanguageOneBenchmarkScale=0.1        按比例缩小生成的资产（快速检查）
+ * -LanguageOneBenchmarkBaseline=<目录>   基线目录（默认 Saved/LanguageOne/Benchmarks/Baseline）
+ * -LanguageOneBenchmarkTolerance=0.25   允许比基线慢/多的比例
+ * -LanguageOneBenchmarkUpdateBaseline   把本次结果写为新的基线
+ * -LanguageOneBenchmarkPort=18080       模拟服务器端口
+ */
+namespace LanguageOneBenchmark
+{
+	/** 生产规模 */
+	static const int32 StringTableEntries = 100000;
+	static const int32 DataTableRows = 50000;
+	static const int32 BlueprintCommentNodes = 5000;
+
+	/** 不重复原文的比例，其余为重复文本（检验去重） */
+	static const float UniqueSourceRatio = 0.7f;
+
+	/** 模拟服务器固定延迟（毫秒） */
+	static const float MockLatencyMs = 20.0f;
+
+	/** 超过该时长的帧计为卡顿（秒） */
+	static const double HitchThresholdSeconds = 0.05;
+
+	/** 单个步骤的超时时间（秒），超时后取消任务 */
+	static const double PhaseTimeoutSeconds = 1800.0;
+
+	/** 基线比较：默认容差，以及避免短步骤误报的绝对余量 */
+	static const double DefaultTolerance = 0.25;
+	static const double TimeSlackSeconds = 0.5;
+	static const double MemorySlackMB = 64.0;
+
+	/** 测试资产所在目录（编辑器的临时挂载点，不会写入磁盘） */
+	static const TCHAR* PackageRoot = TEXT("/Temp/LanguageOneBenchmark");
+
+	/** 要测试的操作 */
+	enum class EOperation : uint8
+	{
+		Translate,
+		ToggleDisplayMode,
+		Restore,
+		ClearOriginal
+	};
+
+	struct FPhase
+	{
+		const TCHAR* Name;
+		EOperation Operation;
+	};
+
+	/** 测试步骤：翻译 -> 切换到原文 -> 切换回双语 -> 还原 -> 再次翻译 -> 清除原文 */
+	static const FPhase Phases[] =
+	{
+		{ TEXT("translate"), EOperation::Translate },
+		{ TEXT("toggle_display_mode"), EOperation::ToggleDisplayMode },
+		{ TEXT("toggle_display_mode_back"), EOperation::ToggleDisplayMode },
+		{ TEXT("restore"), EOperation::Restore },
+		{ TEXT("retranslate"), EOperation::Translate },
+		{ TEXT("clear_original"), EOperation::ClearOriginal },
+	};
+
+	/** 一个步骤的测量结果 */
+	struct FPhaseResult
+	{
+		FString Name;
+		double WallSeconds = 0.0;
+		double HitchSeconds = 0.0;
+		double MaxFrameMs = 0.0;
+		double PeakMemoryMB = 0.0;
+		double PeakMemoryDeltaMB = 0.0;
+		int32 Requests = 0;
+		int32 Texts = 0;
+		int32 SucceededAssets = 0;
+		int32 FailedAssets = 0;
+		int32 AppliedUnits = 0;
+		int32 FailedUnits = 0;
+		bool bTimedOut = false;
+	};
+
+	static double ToMB(uint64 Bytes)
+	{
+		return (double)Bytes / (1024.0 * 1024.0);
+	}
+
+	static float GetScale()
+	{
+		float Scale = 1.0f;
+		FParse::Value(FCommandLine::Get(), TEXT("LanguageOneBenchmarkScale="), Scale);
+		return FMath::Max(Scale, 0.0001f);
+	}
+
+	static int32 Scaled(int32 Count)
+	{
+		return FMath::Max(1, FMath::RoundToInt(Count * GetScale()));
+	}
+
+	static FString GetResultsDirectory()
+	{
+		return FPaths::ProjectSavedDir() / TEXT("LanguageOne") / TEXT("Benchmarks");
+	}
+
+	static FString GetBaselineDirectory()
+	{
+		FString Directory;
+		if (FParse::Value(FCommandLine::Get(), TEXT("LanguageOneBenchmarkBaseline="), Directory))
+		{
+			return Directory;
+		}
+		return GetResultsDirectory() / TEXT("Baseline");
+	}
+
+	/** 生成原文：Index 超过不重复数量后循环，产生重复文本 */
+	static FString MakeSourceText(const TCHAR* Prefix, int32 Index, int32 Count)
+	{
+		const int32 UniqueCount = FMath::Max(1, FMath::RoundToInt(Count * UniqueSourceRatio));
+		return FString::Printf(TEXT("%s %d: the quick brown fox jumps over the lazy dog"), Prefix, Index % UniqueCount);
+	}
+
+	/** 抽查的文本：字段位置、生成时的原文和当前文本 */
+	struct FTextSample
+	{
+		FString Location;
+		FString Source;
+		FString Current;
+	};
+
+	/** 抽查的序号：第一个、中间和最后一个 */
+	static TArray<int32> GetSampleIndexes(int32 Count)
+	{
+		TArray<int32> Indexes;
+		Indexes.AddUnique(0);
+		Indexes.AddUnique(Count / 2);
+		Indexes.AddUnique(Count - 1);
+		return Indexes;
+	}
+
+	static UPackage* CreateBenchmarkPackage(const FString& AssetName)
+	{
+		UPackage* Package = CreatePackage(*(FString(PackageRoot) / AssetName));
+		Package->SetFlags(RF_Transient);
+		return Package;
+	}
+
+	/** 生成 String Table */
+	static UObject* CreateStringTable(int32& OutTextCount)
+	{
+		const FString AssetName = TEXT("ST_LanguageOneBenchmark");
+		UStringTable* StringTable = NewObject<UStringTable>(CreateBenchmarkPackage(AssetName), *AssetName, RF_Public | RF_Standalone | RF_Transactional);
+
+		const int32 Count = Scaled(StringTableEntries);
+		FStringTableRef Table = StringTable->GetMutableStringTable();
+		for (int32 Index = 0; Index < Count; Index++)
+		{
+			Table->SetSourceString(FString::Printf(TEXT("Key_%06d"), Index), MakeSourceText(TEXT("Dialogue"), Index, Count));
+		}
+
+		OutTextCount = Count;
+		return StringTable;
+	}
+
+	static void ReadStringTableSamples(UObject* Asset, TArray<FTextSample>& OutSamples)
+	{
+		FStringTableConstRef Table = CastChecked<UStringTable>(Asset)->GetStringTable();
+		const int32 Count = Scaled(StringTableEntries);
+		for (int32 Index : GetSampleIndexes(Count))
+		{
+			FTextSample& Sample = OutSamples.AddDefaulted_GetRef();
+			Sample.Location = FString::Printf(TEXT("Key_%06d"), Index);
+			Sample.Source = MakeSourceText(TEXT("Dialogue"), Index, Count);
+			Table->GetSourceString(Sample.Location, Sample.Current);
+		}
+	}
+
+	/** 生成 Data Table（FText、FString 和数组字段混合） */
+	static UObject* CreateDataTable(int32& OutTextCount)
+	{
+		const FString AssetName = TEXT("DT_LanguageOneBenchmark");
+		UDataTable* DataTable = NewObject<UDataTable>(CreateBenchmarkPackage(AssetName), *AssetName, RF_Public | RF_Standalone | RF_Transactional);
+		DataTable->RowStruct = FLanguageOneBenchmarkRow::StaticStruct();
+
+		const int32 Count = Scaled(DataTableRows);
+		for (int32 Index = 0; Index < Count; Index++)
+		{
+			FLanguageOneBenchmarkRow Row;
+			Row.DisplayName = FText::FromString(MakeSourceText(TEXT("Item"), Index, Count));
+			Row.Description = FText::FromString(MakeSourceText(TEXT("Description"), Index, Count));
+			Row.Tooltip = MakeSourceText(TEXT("Tooltip"), Index, Count);
+			Row.AssetId = FString::Printf(TEXT("ID_%06d"), Index);
+			Row.Lines.Add(FText::FromString(MakeSourceText(TEXT("Line A"), Index, Count)));
+			Row.Lines.Add(FText::FromString(MakeSourceText(TEXT("Line B"), Index, Count)));
+			Row.Value = Index;
+			DataTable->AddRow(*FString::Printf(TEXT("Row_%06d"), Index), Row);
+		}
+
+		// DisplayName、Description、Tooltip、两行 Lines；AssetId 不翻译
+		OutTextCount = Count * 5;
+		return DataTable;
+	}
+
+	/** 抽查 FText 字段和数组元素 */
+	static void ReadDataTableSamples(UObject* Asset, TArray<FTextSample>& OutSamples)
+	{
+		UDataTable* DataTable = CastChecked<UDataTable>(Asset);
+		const int32 Count = Scaled(DataTableRows);
+		for (int32 Index : GetSampleIndexes(Count))
+		{
+			const FString RowName = FString::Printf(TEXT("Row_%06d"), Index);
+			const FLanguageOneBenchmarkRow* Row = DataTable->FindRow<FLanguageOneBenchmarkRow>(*RowName, TEXT("LanguageOneBenchmark"));
+
+			FTextSample& DisplayName = OutSamples.AddDefaulted_GetRef();
+			DisplayName.Location = RowName + TEXT(".DisplayName");
+			DisplayName.Source = MakeSourceText(TEXT("Item"), Index, Count);
+			DisplayName.Current = Row ? Row->DisplayName.ToString() : FString();
+
+			FTextSample& Line = OutSamples.AddDefaulted_GetRef();
+			Line.Location = RowName + TEXT(".Lines[1]");
+			Line.Source = MakeSourceText(TEXT("Line B"), Index, Count);
+			Line.Current = Row && Row->Lines.IsValidIndex(1) ? Row->Lines[1].ToString() : FString();
+		}
+	}
+
+	/** 生成带注释节点的 Blueprint */
+	static UObject* CreateBlueprint(int32& OutTextCount)
+	{
+		const FString AssetName = TEXT("BP_LanguageOneBenchmark");
+		UBlueprint* Blueprint = FKismetEditorUtilities::CreateBlueprint(AActor::StaticClass(), CreateBenchmarkPackage(AssetName), *AssetName,
+			BPTYPE_Normal, UBlueprint::StaticClass(), UBlueprintGeneratedClass::StaticClass());
+
+		UEdGraph* Graph = FBlueprintEditorUtils::FindEventGraph(Blueprint);
+		const int32 Count = Scaled(BlueprintCommentNodes);
+		for (int32 Index = 0; Index < Count; Index++)
+		{
+			UEdGraphNode_Comment* Node = NewObject<UEdGraphNode_Comment>(Graph, NAME_None, RF_Transactional);
+			Node->CreateNewGuid();
+			Node->NodePosX = (Index % 50) * 420;
+			Node->NodePosY = (Index / 50) * 240;
+			Node->NodeWidth = 400;
+			Node->NodeHeight = 200;
+			Node->NodeComment = MakeSourceText(TEXT("Comment"), Index, Count);
+			Graph->AddNode(Node, false, false);
+		}
+
+		OutTextCount = Count;
+		return Blueprint;
+	}
+
+	/** 注释节点按生成顺序抽查 */
+	static void ReadBlueprintSamples(UObject* Asset, TArray<FTextSample>& OutSamples)
+	{
+		TArray<UEdGraphNode_Comment*> Comments;
+		FBlueprintEditorUtils::FindEventGraph(CastChecked<UBlueprint>(Asset))->GetNodesOfClass(Comments);
+
+		const int32 Count = Scaled(BlueprintCommentNodes);
+		for (int32 Index : GetSampleIndexes(Count))
+		{
+			FTextSample& Sample = OutSamples.AddDefaulted_GetRef();
+			Sample.Location = FString::Printf(TEXT("Comment %d"), Index);
+			Sample.Source = MakeSourceText(TEXT("Comment"), Index, Count);
+			Sample.Current = Comments.IsValidIndex(Index) ? Comments[Index]->NodeComment : FString();
+		}
+	}
+
+	/** 测试期间修改的设置，结束时恢复 */
+	struct FSettingsSnapshot
+	{
+		ETranslateProvider TranslateProvider = ETranslateProvider::MicrosoftFree;
+		ETranslateTargetLanguage TargetLanguage = ETranslateTargetLanguage::Chinese;
+		bool bEnableTranslationMemory = true;
+		bool bResumeInterruptedJobs = true;
+		bool bBoundedMemoryBatch = false;
+		bool bAdaptiveRouting = false;
+		TMap<ETranslateProvider, float> ProviderRequestsPerSecond;
+		TArray<ETranslateProvider> FailoverProviders;
+
+		void Capture(const ULanguageOneSettings* Settings)
+		{
+			TranslateProvider = Settings->TranslateProvider;
+			TargetLanguage = Settings->TargetLanguage;
+			bEnableTranslationMemory = Settings->bEnableTranslationMemory;
+			bResumeInterruptedJobs = Settings->bResumeInterruptedJobs;
+			bBoundedMemoryBatch = Settings->bBoundedMemoryBatch;
+			bAdaptiveRouting = Settings->bAdaptiveRouting;
+			ProviderRequestsPerSecond = Settings->ProviderRequestsPerSecond;
+			FailoverProviders = Settings->FailoverProviders;
+		}
+
+		void Restore(ULanguageOneSettings* Settings) const
+		{
+			Settings->TranslateProvider = TranslateProvider;
+			Settings->TargetLanguage = TargetLanguage;
+			Settings->bEnableTranslationMemory = bEnableTranslationMemory;
+			Settings->bResumeInterruptedJobs = bResumeInterruptedJobs;
+			Settings->bBoundedMemoryBatch = bBoundedMemoryBatch;
+			Settings->bAdaptiveRouting = bAdaptiveRouting;
+			Settings->ProviderRequestsPerSecond = ProviderRequestsPerSecond;
+			Settings->FailoverProviders = FailoverProviders;
+		}
+	};
+
+	/** 按名称查找基线中的步骤 */
+	static TSharedPtr<FJsonObject> FindBaselinePhase(const TSharedPtr<FJsonObject>& Baseline, const FString& Name)
+	{
+		const TArray<TSharedPtr<FJsonValue>>* BaselinePhases = nullptr;
+		if (Baseline.IsValid() && Baseline->TryGetArrayField(TEXT("phases"), BaselinePhases))
+		{
+			for (const TSharedPtr<FJsonValue>& Value : *BaselinePhases)
+			{
+				const TSharedPtr<FJsonObject>* Phase = nullptr;
+				FString PhaseName;
+				if (Value->TryGetObject(Phase) && (*Phase)->TryGetStringField(TEXT("name"), PhaseName) && PhaseName == Name)
+				{
+					return *Phase;
+				}
+			}
+		}
+		return nullptr;
+	}
+
+	/**
+	 * 运行一组性能测试步骤的潜伏命令（每帧调用一次，帧间隔即游戏线程耗时）
+	 */
+	class FRunBenchmarkCommand : public IAutomationLatentCommand
+	{
+	public:
+		using FCreateAsset = TFunction<UObject*(int32& OutTextCount)>;
+		using FReadSamples = TFunction<void(UObject* Asset, TArray<FTextSample>& OutSamples)>;
+
+		FRunBenchmarkCommand(FAutomationTestBase* InTest, const FString& InTestName, FCreateAsset InCreateAsset, FReadSamples InReadSamples)
+			: Test(InTest)
+			, TestName(InTestName)
+			, CreateAsset(MoveTemp(InCreateAsset))
+			, ReadSamples(MoveTemp(InReadSamples))
+		{
+		}
+
+		virtual bool Update() override
+		{
+			const double Now = FPlatformTime::Seconds();
+
+			if (!bSetUp)
+			{
+				bSetUp = true;
+				if (!SetUp())
+				{
+					TearDown();
+					return true;
+				}
+				LastUpdateTime = FPlatformTime::Seconds();
+				return false;
+			}
+
+			if (ActiveJob.IsValid())
+			{
+				SampleFrame(Now);
+
+				if (!ActiveJob->GetFuture().IsReady())
+				{
+					if (Now - PhaseStartTime > PhaseTimeoutSeconds && !ActiveJob->IsCancelled())
+					{
+						Results.Last().bTimedOut = true;
+						ActiveJob->Cancel();
+					}
+					return false;
+				}
+
+				FinishPhase(Now);
+			}
+
+			if (PhaseIndex < (int32)UE_ARRAY_COUNT(Phases))
+			{
+				StartPhase(Phases[PhaseIndex++]);
+				return false;
+			}
+
+			Report();
+			TearDown();
+			return true;
+		}
+
+	private:
+		bool SetUp()
+		{
+			ULanguageOneSettings* Settings = GetMutableDefault<ULanguageOneSettings>();
+			SavedSettings.Capture(Settings);
+
+			// 模拟服务器没有配额：放开速率限制，测量的是插件本身而不是限速器；关闭会影响请求数量的翻译记忆库和断点续传
+			Settings->TranslateProvider = ETranslateProvider::MicrosoftFree;
+			Settings->TargetLanguage = ETranslateTargetLanguage::Chinese;
+			Settings->bEnableTranslationMemory = false;
+			Settings->bResumeInterruptedJobs = false;
+			Settings->bBoundedMemoryBatch = false;
+			Settings->bAdaptiveRouting = false;  // 固定使用首选服务，抽查时译文可以预知
+			Settings->ProviderRequestsPerSecond.Add(ETranslateProvider::MicrosoftFree, 1000.0f);
+			Settings->FailoverProviders = { ETranslateProvider::MicrosoftFree };  // 只有首选服务本身，不切换
+
+			FMockTranslationServerConfig Config;
+			FParse::Value(FCommandLine::Get(), TEXT("LanguageOneBenchmarkPort="), Config.Port);
+			Config.LatencyMs = MockLatencyMs;
+			if (!FMockTranslationServer::Get().Start(Config))
+			{
+				Test->AddError(TEXT("Failed to start the mock translation server"));
+				return false;
+			}
+			FMockTranslationServer::Get().PointSettingsAtServer();
+
+			const double CreateStart = FPlatformTime::Seconds();
+			Asset = CreateAsset(TextCount);
+			if (!Asset.IsValid())
+			{
+				Test->AddError(FString::Printf(TEXT("Failed to create the %s benchmark asset"), *TestName));
+				return false;
+			}
+
+			Assets.Add(FAssetData(Asset.Get()));
+			Test->AddInfo(FString::Printf(TEXT("Generated %s with %d text fields in %.1fs (scale %.3f)"),
+				*Asset->GetName(), TextCount, FPlatformTime::Seconds() - CreateStart, GetScale()));
+			return true;
+		}
+
+		void StartPhase(const FPhase& Phase)
+		{
+			FPhaseResult& Result = Results.AddDefaulted_GetRef();
+			Result.Name = Phase.Name;
+			PhaseOperation = Phase.Operation;
+
+			const FMockTranslationServerStats& ServerStats = FMockTranslationServer::Get().GetStats();
+			StartRequests = ServerStats.Requests;
+			StartTexts = ServerStats.Texts;
+			StartMemoryBytes = FPlatformMemory::GetStats().UsedPhysical;
+			PeakMemoryBytes = StartMemoryBytes;
+
+			// 同步部分（资产已在内存中时可能是整个操作）计入下一帧的帧时间
+			PhaseStartTime = FPlatformTime::Seconds();
+			LastUpdateTime = PhaseStartTime;
+
+			switch (Phase.Operation)
+			{
+			case EOperation::Translate:
+				ActiveJob = FAssetTranslator::PerformTranslation(Assets);
+				break;
+
+			case EOperation::ToggleDisplayMode:
+				ActiveJob = FAssetTranslator::PerformToggleDisplayMode(Assets);
+				break;
+
+			case EOperation::Restore:
+				ActiveJob = FAssetTranslator::PerformRestore(Assets);
+				break;
+
+			case EOperation::ClearOriginal:
+				ActiveJob = FAssetTranslator::PerformClearOriginal(Assets);
+				break;
+			}
+		}
+
+		void SampleFrame(double Now)
+		{
+			FPhaseResult& Result = Results.Last();
+			const double FrameSeconds = Now - LastUpdateTime;
+			LastUpdateTime = Now;
+
+			Result.MaxFrameMs = FMath::Max(Result.MaxFrameMs, FrameSeconds * 1000.0);
+			if (FrameSeconds > HitchThresholdSeconds)
+			{
+				Result.HitchSeconds += FrameSeconds;
+			}
+
+			PeakMemoryBytes = FMath::Max(PeakMemoryBytes, FPlatformMemory::GetStats().UsedPhysical);
+		}
+
+		void FinishPhase(double Now)
+		{
+			const FAssetTranslationJobResult& JobResult = ActiveJob->GetFuture().Get();
+			const FMockTranslationServerStats& ServerStats = FMockTranslationServer::Get().GetStats();
+
+			FPhaseResult& Result = Results.Last();
+			Result.WallSeconds = Now - PhaseStartTime;
+			Result.PeakMemoryMB = ToMB(PeakMemoryBytes);
+			Result.PeakMemoryDeltaMB = ToMB(PeakMemoryBytes - FMath::Min(PeakMemoryBytes, StartMemoryBytes));
+			Result.Requests = ServerStats.Requests - StartRequests;
+			Result.Texts = ServerStats.Texts - StartTexts;
+			Result.SucceededAssets = JobResult.SucceededAssets;
+			Result.FailedAssets = JobResult.FailedAssets;
+			Result.AppliedUnits = JobResult.Stats.AppliedUnits;
+			Result.FailedUnits = JobResult.Stats.FailedUnits;
+			ActiveJob.Reset();
+
+			Test->AddInfo(FString::Printf(TEXT("%s: %.2fs wall, %.2fs hitch (max frame %.0f ms), peak +%.0f MB, %d requests, %d/%d units applied"),
+				*Result.Name, Result.WallSeconds, Result.HitchSeconds, Result.MaxFrameMs, Result.PeakMemoryDeltaMB,
+				Result.Requests, Result.AppliedUnits, Result.AppliedUnits + Result.FailedUnits));
+
+			if (Result.bTimedOut)
+			{
+				Test->AddError(FString::Printf(TEXT("%s timed out after %.0fs"), *Result.Name, PhaseTimeoutSeconds));
+			}
+			if (Result.FailedAssets > 0 || Result.FailedUnits > 0)
+			{
+				Test->AddError(FString::Printf(TEXT("%s: %d assets and %d text units failed"), *Result.Name, Result.FailedAssets, Result.FailedUnits));
+			}
+			if (Result.Name.EndsWith(TEXT("translate")) && Result.AppliedUnits == 0)
+			{
+				Test->AddError(FString::Printf(TEXT("%s applied no text units"), *Result.Name));
+			}
+			if (!Result.bTimedOut)
+			{
+				CheckSamples(Result);
+			}
+		}
+
+		/** 抽查文本内容：翻译后为双语文本，还原后为原文，清除原文后只剩译文；切换显示模式不检查 */
+		void CheckSamples(const FPhaseResult& Result)
+		{
+			if (PhaseOperation == EOperation::ToggleDisplayMode || !Asset.IsValid())
+			{
+				return;
+			}
+
+			TArray<FTextSample> Samples;
+			ReadSamples(Asset.Get(), Samples);
+
+			const FString TargetLang = FCommentTranslator::GetLanguageCode(ETranslateProvider::MicrosoftFree);
+			for (const FTextSample& Sample : Samples)
+			{
+				const FString Translation = FMockTranslationServer::MakeTranslation(Sample.Source, TargetLang);
+				FString Expected;
+				switch (PhaseOperation)
+				{
+				case EOperation::Translate:
+					Expected = FBilingualText::Format(Translation, Sample.Source);
+					break;
+
+				case EOperation::Restore:
+					Expected = Sample.Source;
+					break;
+
+				case EOperation::ClearOriginal:
+					Expected = Translation;
+					break;
+
+				default:
+					break;
+				}
+
+				if (Sample.Current != Expected)
+				{
+					Test->AddError(FString::Printf(TEXT("%s: %s is \"%s\", expected \"%s\""),
+						*Result.Name, *Sample.Location, *Sample.Current.ReplaceCharWithEscapedChar(), *Expected.ReplaceCharWithEscapedChar()));
+				}
+			}
+		}
+
+		TSharedRef<FJsonObject> MakeReport() const
+		{
+			TSharedRef<FJsonObject> Root = MakeShared<FJsonObject>();
+			Root->SetStringField(TEXT("test"), TestName);
+			Root->SetStringField(TEXT("engineVersion"), FEngineVersion::Current().ToString());
+			Root->SetStringField(TEXT("timestamp"), FDateTime::UtcNow().ToIso8601());
+			Root->SetNumberField(TEXT("scale"), GetScale());
+			Root->SetNumberField(TEXT("textFields"), TextCount);
+			Root->SetNumberField(TEXT("mockLatencyMs"), MockLatencyMs);
+
+			TArray<TSharedPtr<FJsonValue>> PhaseValues;
+			for (const FPhaseResult& Result : Results)
+			{
+				TSharedRef<FJsonObject> Phase = MakeShared<FJsonObject>();
+				Phase->SetStringField(TEXT("name"), Result.Name);
+				Phase->SetNumberField(TEXT("wallSeconds"), Result.WallSeconds);
+				Phase->SetNumberField(TEXT("hitchSeconds"), Result.HitchSeconds);
+				Phase->SetNumberField(TEXT("maxFrameMs"), Result.MaxFrameMs);
+				Phase->SetNumberField(TEXT("peakMemoryMB"), Result.PeakMemoryMB);
+				Phase->SetNumberField(TEXT("peakMemoryDeltaMB"), Result.PeakMemoryDeltaMB);
+				Phase->SetNumberField(TEXT("requests"), Result.Requests);
+				Phase->SetNumberField(TEXT("texts"), Result.Texts);
+				Phase->SetNumberField(TEXT("succeededAssets"), Result.SucceededAssets);
+				Phase->SetNumberField(TEXT("failedAssets"), Result.FailedAssets);
+				Phase->SetNumberField(TEXT("appliedUnits"), Result.AppliedUnits);
+				Phase->SetNumberField(TEXT("failedUnits"), Result.FailedUnits);
+				PhaseValues.Add(MakeShared<FJsonValueObject>(Phase));
+			}
+			Root->SetArrayField(TEXT("phases"), PhaseValues);
+			return Root;
+		}
+
+		/** 写入结果并与基线比较：耗时、卡顿和请求数量超出容差时报错，内存超出时警告 */
+		void Report()
+		{
+			FString Json;
+			TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&Json);
+			FJsonSerializer::Serialize(MakeReport(), Writer);
+
+			const FString FileName = FString::Printf(TEXT("%s.json"), *TestName);
+			const FString ResultPath = GetResultsDirectory() / FileName;
+			if (FFileHelper::SaveStringToFile(Json, *ResultPath, FFileHelper::EEncodingOptions::ForceUTF8WithoutBOM))
+			{
+				Test->AddInfo(FString::Printf(TEXT("Benchmark results written to %s"), *FPaths::ConvertRelativePathToFull(ResultPath)));
+			}
+			else
+			{
+				Test->AddWarning(FString::Printf(TEXT("Failed to write benchmark results to %s"), *ResultPath));
+			}
+
+			const FString BaselinePath = GetBaselineDirectory() / FileName;
+			if (FParse::Param(FCommandLine::Get(), TEXT("LanguageOneBenchmarkUpdateBaseline")))
+			{
+				FFileHelper::SaveStringToFile(Json, *BaselinePath, FFileHelper::EEncodingOptions::ForceUTF8WithoutBOM);
+				Test->AddInfo(FString::Printf(TEXT("Baseline updated: %s"), *BaselinePath));
+				return;
+			}
+
+			FString BaselineJson;
+			TSharedPtr<FJsonObject> Baseline;
+			if (!FFileHelper::LoadFileToString(BaselineJson, *BaselinePath)
+				|| !FJsonSerializer::Deserialize(TJsonReaderFactory<>::Create(BaselineJson), Baseline) || !Baseline.IsValid())
+			{
+				Test->AddInfo(FString::Printf(TEXT("No baseline at %s, skipping comparison (run with -LanguageOneBenchmarkUpdateBaseline to create it)"), *BaselinePath));
+				return;
+			}
+
+			double BaselineScale = 0.0;
+			Baseline->TryGetNumberField(TEXT("scale"), BaselineScale);
+			if (!FMath::IsNearlyEqual(BaselineScale, (double)GetScale()))
+			{
+				Test->AddWarning(FString::Printf(TEXT("Baseline scale %.3f differs from current scale %.3f, skipping comparison"), BaselineScale, GetScale()));
+				return;
+			}
+
+			double Tolerance = DefaultTolerance;
+			FParse::Value(FCommandLine::Get(), TEXT("LanguageOneBenchmarkTolerance="), Tolerance);
+
+			for (const FPhaseResult& Result : Results)
+			{
+				const TSharedPtr<FJsonObject> BaselinePhase = FindBaselinePhase(Baseline, Result.Name);
+				if (!BaselinePhase.IsValid())
+				{
+					continue;
+				}
+
+				const double BaseWall = BaselinePhase->GetNumberField(TEXT("wallSeconds"));
+				const double BaseHitch = BaselinePhase->GetNumberField(TEXT("hitchSeconds"));
+				const double BaseMemory = BaselinePhase->GetNumberField(TEXT("peakMemoryDeltaMB"));
+				const int32 BaseRequests = (int32)BaselinePhase->GetNumberField(TEXT("requests"));
+
+				if (Result.WallSeconds > BaseWall * (1.0 + Tolerance) + TimeSlackSeconds)
+				{
+					Test->AddError(FString::Printf(TEXT("%s wall time regressed: %.2fs (baseline %.2fs)"), *Result.Name, Result.WallSeconds, BaseWall));
+				}
+				if (Result.HitchSeconds > BaseHitch * (1.0 + Tolerance) + TimeSlackSeconds)
+				{
+					Test->AddError(FString::Printf(TEXT("%s game thread hitch time regressed: %.2fs (baseline %.2fs)"), *Result.Name, Result.HitchSeconds, BaseHitch));
+				}
+				if (Result.Requests > BaseRequests)
+				{
+					Test->AddError(FString::Printf(TEXT("%s issued more requests: %d (baseline %d)"), *Result.Name, Result.Requests, BaseRequests));
+				}
+				if (Result.PeakMemoryDeltaMB > BaseMemory * (1.0 + Tolerance) + MemorySlackMB)
+				{
+					Test->AddWarning(FString::Printf(TEXT("%s peak memory grew: +%.0f MB (baseline +%.0f MB)"), *Result.Name, Result.PeakMemoryDeltaMB, BaseMemory));
+				}
+			}
+		}
+
+		/** 停止模拟服务器、恢复设置、销毁生成的资产 */
+		void TearDown()
+		{
+			if (ActiveJob.IsValid() && !ActiveJob->IsFinished())
+			{
+				ActiveJob->Cancel();
+			}
+			ActiveJob.Reset();
+
+			FMockTranslationServer::Get().Stop();
+			SavedSettings.Restore(GetMutableDefault<ULanguageOneSettings>());
+
+			if (UObject* Object = Asset.Get())
+			{
+				UPackage* Package = Object->GetOutermost();
+				Object->ClearFlags(RF_Public | RF_Standalone);
+				Object->MarkAsGarbage();
+				Package->SetDirtyFlag(false);
+				Package->MarkAsGarbage();
+			}
+			Assets.Empty();
+
+			// 撤销缓冲引用了生成的对象
+			if (GEditor)
+			{
+				GEditor->ResetTransaction(NSLOCTEXT("LanguageOne", "BenchmarkFinished", "LanguageOne benchmark finished"));
+			}
+			CollectGarbage(GARBAGE_COLLECTION_KEEPFLAGS);
+		}
+
+	private:
+		FAutomationTestBase* Test;
+		FString TestName;
+		FCreateAsset CreateAsset;
+		FReadSamples ReadSamples;
+
+		bool bSetUp = false;
+		int32 PhaseIndex = 0;
+		FSettingsSnapshot SavedSettings;
+
+		TWeakObjectPtr<UObject> Asset;
+		TArray<FAssetData> Assets;
+		int32 TextCount = 0;
+
+		TSharedPtr<FAssetTranslationJob> ActiveJob;
+		TArray<FPhaseResult> Results;
+		EOperation PhaseOperation = EOperation::Translate;
+
+		double PhaseStartTime = 0.0;
+		double LastUpdateTime = 0.0;
+		int32 StartRequests = 0;
+		int32 StartTexts = 0;
+		uint64 StartMemoryBytes = 0;
+		uint64 PeakMemoryBytes = 0;
+	};
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FLanguageOneStringTableBenchmark, "LanguageOne.Benchmark.StringTable",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::StressFilter)
+
+bool FLanguageOneStringTableBenchmark::RunTest(const FString& Parameters)
+{
+	ADD_LATENT_AUTOMATION_COMMAND(LanguageOneBenchmark::FRunBenchmarkCommand(this, TEXT("StringTable"), &LanguageOneBenchmark::CreateStringTable, &LanguageOneBenchmark::ReadStringTableSamples));
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FLanguageOneDataTableBenchmark, "LanguageOne.Benchmark.DataTable",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::StressFilter)
+
+bool FLanguageOneDataTableBenchmark::RunTest(const FString& Parameters)
+{
+	ADD_LATENT_AUTOMATION_COMMAND(LanguageOneBenchmark::FRunBenchmarkCommand(this, TEXT("DataTable"), &LanguageOneBenchmark::CreateDataTable, &LanguageOneBenchmark::ReadDataTableSamples));
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FLanguageOneBlueprintBenchmark, "LanguageOne.Benchmark.Blueprint",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::StressFilter)
+
+bool FLanguageOneBlueprintBenchmark::RunTest(const FString& Parameters)
+{
+	ADD_LATENT_AUTOMATION_COMMAND(LanguageOneBenchmark::FRunBenchmarkCommand(this, TEXT("Blueprint"), &LanguageOneBenchmark::CreateBlueprint, &LanguageOneBenchmark::ReadBlueprintSamples));
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
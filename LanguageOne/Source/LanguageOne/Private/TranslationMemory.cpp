@@ -0,0 +1,456 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "TranslationMemory.h"
+#include "Async/Async.h"
+#include "Hash/CityHash.h"
+#include "HAL/CriticalSection.h"
+#include "HAL/FileManager.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Guid.h"
+#include "Misc/Paths.h"
+#include "Misc/ScopeLock.h"
+
+namespace LanguageOneTranslationMemory
+{
+	/** 文件头：魔数\t版本\t代号（文件被压缩重写时代号会变化） */
+	static const TCHAR* HeaderMagic = TEXT("#LanguageOneTM");
+	static const int32 FormatVersion = 1;
+
+	/** 定时写盘间隔（秒） */
+	static const float FlushIntervalSeconds = 5.0f;
+
+	/** 待写入条目达到该数量时立即写盘 */
+	static const int32 FlushThreshold = 500;
+
+	/** 文件行数超过条目数的倍数时压缩 */
+	static const int32 CompactMinLines = 1000;
+	static const int32 CompactRatio = 2;
+
+	/** 读取文件中 [Offset, Offset + Length) 范围的 UTF-8 文本 */
+	static FString ReadFileRange(const FString& Path, int64 Offset, int64 Length)
+	{
+		if (Length <= 0)
+		{
+			return FString();
+		}
+
+		TUniquePtr<FArchive> Reader(IFileManager::Get().CreateFileReader(*Path, FILEREAD_AllowWrite));
+		if (!Reader)
+		{
+			return FString();
+		}
+
+		TArray<uint8> Bytes;
+		Bytes.SetNumUninitialized(Length);
+		Reader->Seek(Offset);
+		Reader->Serialize(Bytes.GetData(), Length);
+		Reader->Close();
+
+		FUTF8ToTCHAR Converter(reinterpret_cast<const ANSICHAR*>(Bytes.GetData()), Bytes.Num());
+		return FString(Converter.Length(), Converter.Get());
+	}
+
+	/** 读取文件头中的代号 */
+	static FString ReadGeneration(const FString& Path)
+	{
+		FString Head = ReadFileRange(Path, 0, FMath::Min<int64>(IFileManager::Get().FileSize(*Path), 128));
+		int32 LineEnd = INDEX_NONE;
+		if (!Head.FindChar(TEXT('\n'), LineEnd))
+		{
+			return FString();
+		}
+
+		TArray<FString> Fields;
+		Head.Left(LineEnd).ParseIntoArray(Fields, TEXT("\t"), false);
+		return (Fields.Num() == 3 && Fields[0] == HeaderMagic) ? Fields[2] : FString();
+	}
+
+	static FString MakeHeader(const FString& Generation)
+	{
+		return FString::Printf(TEXT("%s\t%d\t%s\n"), HeaderMagic, FormatVersion, *Generation);
+	}
+
+	static FString MakeGeneration()
+	{
+		return FGuid::NewGuid().ToString(EGuidFormats::Digits);
+	}
+
+	/** 跨进程互斥锁名称（按项目区分） */
+	static FString GetSystemLockName()
+	{
+		const FString FullPath = FPaths::ConvertRelativePathToFull(FTranslationMemory::GetMemoryFilePath());
+		return FString::Printf(TEXT("LanguageOneTM_%08x"), GetTypeHash(FullPath));
+	}
+}
+
+FTranslationMemory& FTranslationMemory::Get()
+{
+	static FTranslationMemory Instance;
+	return Instance;
+}
+
+FString FTranslationMemory::EscapeField(const FString& Text)
+{
+	FString Result;
+	Result.Reserve(Text.Len() + 8);
+	for (TCHAR Char : Text)
+	{
+		switch (Char)
+		{
+		case TEXT('\\'): Result += TEXT("\\\\"); break;
+		case TEXT('\t'): Result += TEXT("\\t"); break;
+		case TEXT('\n'): Result += TEXT("\\n"); break;
+		case TEXT('\r'): Result += TEXT("\\r"); break;
+		default: Result.AppendChar(Char); break;
+		}
+	}
+	return Result;
+}
+
+FString FTranslationMemory::UnescapeField(const FString& Text)
+{
+	FString Result;
+	Result.Reserve(Text.Len());
+	for (int32 i = 0; i < Text.Len(); i++)
+	{
+		TCHAR Char = Text[i];
+		if (Char == TEXT('\\') && i + 1 < Text.Len())
+		{
+			TCHAR Next = Text[++i];
+			switch (Next)
+			{
+			case TEXT('t'): Result.AppendChar(TEXT('\t')); break;
+			case TEXT('n'): Result.AppendChar(TEXT('\n')); break;
+			case TEXT('r'): Result.AppendChar(TEXT('\r')); break;
+			default: Result.AppendChar(Next); break;
+			}
+		}
+		else
+		{
+			Result.AppendChar(Char);
+		}
+	}
+	return Result;
+}
+
+FString FTranslationMemory::GetMemoryFilePath()
+{
+	return FPaths::ProjectSavedDir() / TEXT("LanguageOne") / TEXT("TranslationMemory.tsv");
+}
+
+FString FTranslationMemory::NormalizeSourceText(const FString& SourceText)
+{
+	return SourceText.Replace(TEXT("\r\n"), TEXT("\n")).TrimStartAndEnd();
+}
+
+FTranslationMemory::FMemoryKey FTranslationMemory::MakeKey(ETranslateProvider Provider, const FString& SourceLang, const FString& TargetLang, const FString& NormalizedSource)
+{
+	FMemoryKey Key;
+	Key.Provider = static_cast<uint8>(Provider);
+	Key.SourceLang = SourceLang;
+	Key.TargetLang = TargetLang;
+	Key.SourceHash = CityHash64(reinterpret_cast<const char*>(*NormalizedSource), NormalizedSource.Len() * sizeof(TCHAR));
+	return Key;
+}
+
+FString FTranslationMemory::SerializeLine(uint8 Provider, const FString& SourceLang, const FString& TargetLang, const FString& Source, const FString& Translation)
+{
+	using namespace LanguageOneTranslationMemory;
+	return FString::Printf(TEXT("%d\t%s\t%s\t%s\t%s\n"), Provider, *SourceLang, *TargetLang, *EscapeField(Source), *EscapeField(Translation));
+}
+
+void FTranslationMemory::Initialize()
+{
+	using namespace LanguageOneTranslationMemory;
+
+	if (bInitialized)
+	{
+		return;
+	}
+	bInitialized = true;
+
+	const FString Path = GetMemoryFilePath();
+	{
+		FSystemWideCriticalSection SystemLock(GetSystemLockName(), FTimespan::FromSeconds(10.0));
+		if (IFileManager::Get().FileExists(*Path))
+		{
+			FString Content;
+			if (FFileHelper::LoadFileToString(Content, *Path))
+			{
+				FScopeLock Lock(&MemoryLock);
+				ParseLines(Content);
+				KnownFileSize = IFileManager::Get().FileSize(*Path);
+				KnownGeneration = ReadGeneration(Path);
+			}
+		}
+	}
+
+	CompactIfNeeded();
+
+	TickerHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateRaw(this, &FTranslationMemory::Tick), FlushIntervalSeconds);
+
+	UE_LOG(LogTemp, Log, TEXT("Translation memory loaded: %d entries from %s"), Num(), *Path);
+}
+
+void FTranslationMemory::Shutdown()
+{
+	if (!bInitialized)
+	{
+		return;
+	}
+
+	FTSTicker::GetCoreTicker().RemoveTicker(TickerHandle);
+	TickerHandle.Reset();
+
+	Flush(true);
+	bInitialized = false;
+
+	UE_LOG(LogTemp, Log, TEXT("Translation memory saved: %d entries, %d hits, %d misses this session"), Num(), HitCount, MissCount);
+}
+
+bool FTranslationMemory::Find(ETranslateProvider Provider, const FString& SourceLang, const FString& TargetLang, const FString& SourceText, FString& OutTranslation)
+{
+	const FString Normalized = NormalizeSourceText(SourceText);
+	const FMemoryKey Key = MakeKey(Provider, SourceLang, TargetLang, Normalized);
+
+	FScopeLock Lock(&MemoryLock);
+	const FMemoryEntry* Entry = Entries.Find(Key);
+	if (Entry && Entry->Source == Normalized)
+	{
+		OutTranslation = Entry->Translation;
+		HitCount++;
+		return true;
+	}
+
+	MissCount++;
+	return false;
+}
+
+void FTranslationMemory::Add(ETranslateProvider Provider, const FString& SourceLang, const FString& TargetLang, const FString& SourceText, const FString& Translation)
+{
+	if (Translation.IsEmpty())
+	{
+		return;
+	}
+
+	const FString Normalized = NormalizeSourceText(SourceText);
+	if (Normalized.IsEmpty())
+	{
+		return;
+	}
+
+	const FMemoryKey Key = MakeKey(Provider, SourceLang, TargetLang, Normalized);
+	bool bShouldFlush = false;
+	{
+		FScopeLock Lock(&MemoryLock);
+		FMemoryEntry& Entry = Entries.FindOrAdd(Key);
+		if (Entry.Source == Normalized && Entry.Translation == Translation)
+		{
+			return;
+		}
+
+		Entry.Source = Normalized;
+		Entry.Translation = Translation;
+		PendingLines += SerializeLine(Key.Provider, SourceLang, TargetLang, Normalized, Translation);
+		PendingCount++;
+		bShouldFlush = PendingCount >= LanguageOneTranslationMemory::FlushThreshold;
+	}
+
+	if (bShouldFlush)
+	{
+		Flush(false);
+	}
+}
+
+void FTranslationMemory::Flush(bool bWait)
+{
+	// 上一次写盘还没结束：非阻塞调用直接跳过，等下一次定时器
+	if (FlushTask.IsValid() && !FlushTask.IsReady())
+	{
+		if (!bWait)
+		{
+			return;
+		}
+		FlushTask.Wait();
+	}
+
+	FString PendingText;
+	{
+		FScopeLock Lock(&MemoryLock);
+		PendingText = MoveTemp(PendingLines);
+		PendingLines.Reset();
+		PendingCount = 0;
+	}
+
+	if (PendingText.IsEmpty())
+	{
+		return;
+	}
+
+	FlushTask = Async(EAsyncExecution::ThreadPool, [this, PendingText = MoveTemp(PendingText)]() mutable
+	{
+		WriteBehind(MoveTemp(PendingText));
+	});
+
+	if (bWait)
+	{
+		FlushTask.Wait();
+	}
+}
+
+int32 FTranslationMemory::Num() const
+{
+	FScopeLock Lock(&MemoryLock);
+	return Entries.Num();
+}
+
+void FTranslationMemory::ParseLines(const FString& Content)
+{
+	using namespace LanguageOneTranslationMemory;
+
+	TArray<FString> Lines;
+	Content.ParseIntoArrayLines(Lines, true);
+
+	TArray<FString> Fields;
+	for (const FString& Line : Lines)
+	{
+		if (Line.StartsWith(TEXT("#")))
+		{
+			continue;
+		}
+
+		Fields.Reset();
+		Line.ParseIntoArray(Fields, TEXT("\t"), false);
+		if (Fields.Num() != 5)
+		{
+			continue;
+		}
+
+		const int32 ProviderValue = FCString::Atoi(*Fields[0]);
+		const FString Source = UnescapeField(Fields[3]);
+		const FMemoryKey Key = MakeKey(static_cast<ETranslateProvider>(ProviderValue), Fields[1], Fields[2], Source);
+
+		FMemoryEntry& Entry = Entries.FindOrAdd(Key);
+		Entry.Source = Source;
+		Entry.Translation = UnescapeField(Fields[4]);
+		FileLineCount++;
+	}
+}
+
+void FTranslationMemory::WriteBehind(FString PendingText)
+{
+	using namespace LanguageOneTranslationMemory;
+
+	const FString Path = GetMemoryFilePath();
+	FSystemWideCriticalSection SystemLock(GetSystemLockName(), FTimespan::FromSeconds(10.0));
+	if (!SystemLock.IsValid())
+	{
+		// 拿不到锁：放回待写入队列，下次再试
+		UE_LOG(LogTemp, Warning, TEXT("Translation memory: failed to acquire file lock, will retry"));
+		RequeuePendingText(PendingText);
+		return;
+	}
+
+	IFileManager& FileManager = IFileManager::Get();
+	int64 FileSize = FileManager.FileSize(*Path);
+
+	// 合并其他会话写入的内容；文件被其他会话压缩重写过则重新读取整个文件
+	if (FileSize > 0)
+	{
+		const FString Generation = ReadGeneration(Path);
+		const bool bRewritten = Generation != KnownGeneration || FileSize < KnownFileSize;
+		const int64 ReadOffset = bRewritten ? 0 : KnownFileSize;
+		if (FileSize > ReadOffset)
+		{
+			const FString NewContent = ReadFileRange(Path, ReadOffset, FileSize - ReadOffset);
+			FScopeLock Lock(&MemoryLock);
+			ParseLines(NewContent);
+		}
+		KnownGeneration = Generation;
+	}
+	else
+	{
+		KnownGeneration = MakeGeneration();
+		FFileHelper::SaveStringToFile(MakeHeader(KnownGeneration), *Path, FFileHelper::EEncodingOptions::ForceUTF8WithoutBOM);
+	}
+
+	if (!FFileHelper::SaveStringToFile(PendingText, *Path, FFileHelper::EEncodingOptions::ForceUTF8WithoutBOM, &FileManager, FILEWRITE_Append))
+	{
+		UE_LOG(LogTemp, Warning, TEXT("Translation memory: failed to write %s, will retry"), *Path);
+		RequeuePendingText(PendingText);
+		return;
+	}
+
+	KnownFileSize = FileManager.FileSize(*Path);
+}
+
+void FTranslationMemory::RequeuePendingText(const FString& PendingText)
+{
+	// 每条记录占一行
+	int32 LineCount = 0;
+	for (const TCHAR Char : PendingText)
+	{
+		LineCount += Char == TEXT('\n') ? 1 : 0;
+	}
+
+	FScopeLock Lock(&MemoryLock);
+	PendingLines = PendingText + PendingLines;
+	PendingCount += LineCount;
+}
+
+void FTranslationMemory::CompactIfNeeded()
+{
+	using namespace LanguageOneTranslationMemory;
+
+	FString Content;
+	int32 EntryCount = 0;
+	const FString Generation = MakeGeneration();
+	{
+		FScopeLock Lock(&MemoryLock);
+		EntryCount = Entries.Num();
+		if (FileLineCount < CompactMinLines || FileLineCount < EntryCount * CompactRatio)
+		{
+			return;
+		}
+
+		Content = MakeHeader(Generation);
+		for (const TPair<FMemoryKey, FMemoryEntry>& Pair : Entries)
+		{
+			Content += SerializeLine(Pair.Key.Provider, Pair.Key.SourceLang, Pair.Key.TargetLang, Pair.Value.Source, Pair.Value.Translation);
+		}
+	}
+
+	const FString Path = GetMemoryFilePath();
+	const FString TempPath = Path + TEXT(".tmp");
+
+	FSystemWideCriticalSection SystemLock(GetSystemLockName(), FTimespan::FromSeconds(10.0));
+	if (!SystemLock.IsValid())
+	{
+		return;
+	}
+
+	// 压缩期间其他会话可能已经追加了内容，先合并进来
+	const int64 FileSize = IFileManager::Get().FileSize(*Path);
+	if (FileSize > KnownFileSize)
+	{
+		const FString NewContent = ReadFileRange(Path, KnownFileSize, FileSize - KnownFileSize);
+		FScopeLock Lock(&MemoryLock);
+		ParseLines(NewContent);
+		Content += NewContent;
+	}
+
+	if (FFileHelper::SaveStringToFile(Content, *TempPath, FFileHelper::EEncodingOptions::ForceUTF8WithoutBOM)
+		&& IFileManager::Get().Move(*Path, *TempPath, true))
+	{
+		KnownFileSize = IFileManager::Get().FileSize(*Path);
+		KnownGeneration = Generation;
+		FileLineCount = EntryCount;
+		UE_LOG(LogTemp, Log, TEXT("Translation memory compacted to %d entries"), EntryCount);
+	}
+}
+
+bool FTranslationMemory::Tick(float DeltaTime)
+{
+	Flush(false);
+	return true;
+}
@@ -0,0 +1,721 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "TranslationRequestScheduler.h"
+#include "LanguageOneTrace.h"
+#include "ProviderRouter.h"
+#include "Interfaces/IHttpResponse.h"
+#include "HttpModule.h"
+#include "HAL/PlatformTime.h"
+
+namespace LanguageOneRequestScheduler
+{
+	/** 调度定时器间隔（秒） */
+	static const float TickIntervalSeconds = 0.05f;
+
+	/** 429 未带 Retry-After 时的默认暂停时间（秒） */
+	static const double DefaultThrottleSeconds = 5.0;
+
+	/** Retry-After 最长等待时间（秒），防止异常值卡住队列 */
+	static const double MaxRetryAfterSeconds = 120.0;
+
+	/** 未配置速率的服务使用的默认速率（每秒请求数） */
+	static const float DefaultRequestsPerSecond = 5.0f;
+
+	/** 重试退避的最长时间（秒） */
+	static const double MaxBackoffSeconds = 30.0;
+
+	/** 已取消的请求组在最后一个请求结束后保留取消状态的时间（秒） */
+	static const double CancelledGroupGraceSeconds = 10.0;
+
+	/** 复制请求（URL、方法、请求头、请求体），用于重试 */
+	static TSharedRef<IHttpRequest, ESPMode::ThreadSafe> CloneRequest(const FHttpRequestPtr& Source)
+	{
+		TSharedRef<IHttpRequest, ESPMode::ThreadSafe> Clone = FHttpModule::Get().CreateRequest();
+		Clone->SetURL(Source->GetURL());
+		Clone->SetVerb(Source->GetVerb());
+
+		// GetAllHeaders 返回 "Name: Value" 格式
+		for (const FString& Header : Source->GetAllHeaders())
+		{
+			FString Name;
+			FString Value;
+			if (Header.Split(TEXT(":"), &Name, &Value))
+			{
+				Clone->SetHeader(Name.TrimStartAndEnd(), Value.TrimStartAndEnd());
+			}
+		}
+
+		Clone->SetContent(Source->GetContent());
+		return Clone;
+	}
+}
+
+FTranslationRequestScheduler& FTranslationRequestScheduler::Get()
+{
+	static FTranslationRequestScheduler Instance;
+	return Instance;
+}
+
+void FTranslationRequestScheduler::Initialize()
+{
+	// 预先创建所有通道，发送过程中不会因为新增通道而重新分配
+	for (uint8 ProviderIndex = 0; ProviderIndex <= (uint8)ETranslateProvider::Custom; ProviderIndex++)
+	{
+		Lanes.FindOrAdd((ETranslateProvider)ProviderIndex);
+	}
+
+	if (!TickerHandle.IsValid())
+	{
+		TickerHandle = FTSTicker::GetCoreTicker().AddTicker(
+			FTickerDelegate::CreateRaw(this, &FTranslationRequestScheduler::Tick),
+			LanguageOneRequestScheduler::TickIntervalSeconds);
+	}
+}
+
+void FTranslationRequestScheduler::Shutdown()
+{
+	bShuttingDown = true;
+
+	if (TickerHandle.IsValid())
+	{
+		FTSTicker::GetCoreTicker().RemoveTicker(TickerHandle);
+		TickerHandle.Reset();
+	}
+
+	// 丢弃排队和等待重试的请求：结果队列随后也会关闭，发送出去只会造成突发请求并拖慢编辑器退出
+	int32 DroppedCount = 0;
+	for (TPair<ETranslateProvider, FProviderLane>& Pair : Lanes)
+	{
+		FProviderLane& Lane = Pair.Value;
+		DroppedCount += Lane.NumQueued();
+		Lane.Queue.Empty();
+		Lane.QueueHead = 0;
+		Lane.InteractiveQueue.Empty();
+		Lane.RetryQueue.Empty();
+	}
+
+	// 中止进行中的请求（完成回调不再转发给调用方）
+	TArray<TSharedPtr<IHttpRequest, ESPMode::ThreadSafe>> InFlightRequests;
+	InFlightGroups.GetKeys(InFlightRequests);
+	for (const TSharedPtr<IHttpRequest, ESPMode::ThreadSafe>& Request : InFlightRequests)
+	{
+		Request->CancelRequest();
+	}
+
+	if (DroppedCount > 0 || InFlightRequests.Num() > 0)
+	{
+		UE_LOG(LogTemp, Log, TEXT("Translation scheduler shut down: %d queued requests dropped, %d in-flight requests cancelled"), DroppedCount, InFlightRequests.Num());
+	}
+}
+
+void FTranslationRequestScheduler::Enqueue(ETranslateProvider Provider, TSharedRef<IHttpRequest, ESPMode::ThreadSafe> Request)
+{
+	// 已关闭时直接丢弃
+	if (bShuttingDown)
+	{
+		return;
+	}
+
+	// 请求组已取消：不再发送，立即以失败回调，调用方的等待状态总能结束
+	if (IsGroupCancelled(CurrentGroup))
+	{
+		Request->OnProcessRequestComplete().ExecuteIfBound(Request, nullptr, false);
+		return;
+	}
+
+	FProviderLane& Lane = Lanes.FindOrAdd(Provider);
+	TArray<FQueuedRequest>& TargetQueue = CurrentPriority == ETranslationRequestPriority::Interactive ? Lane.InteractiveQueue : Lane.Queue;
+	FQueuedRequest& Queued = TargetQueue.Add_GetRef({ Request, FPlatformTime::Seconds() });
+	Queued.OnComplete = Request->OnProcessRequestComplete();
+	Queued.Group = CurrentGroup;
+	Queued.Priority = CurrentPriority;
+	Queued.TraceRequestId = FLanguageOneTrace::AllocateRequestId();
+	Queued.TraceBatch = FLanguageOneTrace::GetCurrentBatch();
+	FLanguageOneTrace::TraceRequestPhase(Queued.TraceRequestId, Queued.Group, Queued.TraceBatch, Provider, ELanguageOneRequestPhase::Queued, Queued.Attempt);
+	if (CurrentGroup != 0)
+	{
+		GroupOutstanding.FindOrAdd(CurrentGroup)++;
+	}
+
+	// 有空闲名额时立即发送，不必等到下一次 Tick
+	Pump();
+}
+
+void FTranslationRequestScheduler::Pump()
+{
+	// 请求失败可能同步触发完成回调，回调中再次调用 Pump 时交给外层循环处理
+	if (bIsPumping)
+	{
+		return;
+	}
+	TGuardValue<bool> PumpGuard(bIsPumping, true);
+	LANGUAGEONE_TRACE_SCOPE("LanguageOne::PumpRequests");
+
+	const ULanguageOneSettings* Settings = GetDefault<ULanguageOneSettings>();
+	const int32 MaxConcurrent = FMath::Max(1, Settings->MaxConcurrentRequests);
+	const int32 ReservedInteractive = FMath::Clamp(Settings->InteractiveReservedRequests, 0, MaxConcurrent - 1);
+	const double Now = FPlatformTime::Seconds();
+
+	// 交互请求先发送，可以使用所有名额；批量请求不占用为交互请求保留的名额
+	PumpPriority(ETranslationRequestPriority::Interactive, MaxConcurrent, MaxConcurrent, Now);
+	PumpPriority(ETranslationRequestPriority::Bulk, MaxConcurrent, MaxConcurrent - ReservedInteractive, Now);
+}
+
+void FTranslationRequestScheduler::PumpPriority(ETranslationRequestPriority Priority, int32 MaxConcurrent, int32 MaxPriorityInFlight, double Now)
+{
+	const FPriorityCounters& Counters = PriorityCounters[(int32)Priority];
+
+	// 轮流从各个服务取请求，避免某个服务的长队列饿死其他服务
+	bool bDispatched = true;
+	while (bDispatched && TotalInFlight < MaxConcurrent && Counters.InFlight < MaxPriorityInFlight)
+	{
+		bDispatched = false;
+		for (TPair<ETranslateProvider, FProviderLane>& Pair : Lanes)
+		{
+			FProviderLane& Lane = Pair.Value;
+			if (Lane.NumQueued() == 0 || Now < Lane.BlockedUntil || TotalInFlight >= MaxConcurrent || Counters.InFlight >= MaxPriorityInFlight)
+			{
+				continue;
+			}
+
+			RefillTokens(Lane, Pair.Key, Now);
+			if (Lane.Tokens < 1.0)
+			{
+				continue;
+			}
+
+			FQueuedRequest Queued;
+			if (!PopNextRequest(Lane, Priority, Now, Queued))
+			{
+				continue;
+			}
+
+			Lane.Tokens -= 1.0;
+			Dispatch(Pair.Key, Lane, Queued, Now);
+			bDispatched = true;
+		}
+	}
+}
+
+void FTranslationRequestScheduler::RefillTokens(FProviderLane& Lane, ETranslateProvider Provider, double Now)
+{
+	const ULanguageOneSettings* Settings = GetDefault<ULanguageOneSettings>();
+	const float* ConfiguredRate = Settings->ProviderRequestsPerSecond.Find(Provider);
+	const double Rate = FMath::Max(0.1, (double)(ConfiguredRate ? *ConfiguredRate : LanguageOneRequestScheduler::DefaultRequestsPerSecond));
+
+	// 桶容量为一秒的请求数（至少 1），允许小幅突发
+	const double Capacity = FMath::Max(1.0, Rate);
+
+	if (!Lane.bTokensInitialized)
+	{
+		Lane.Tokens = Capacity;
+		Lane.LastRefillTime = Now;
+		Lane.bTokensInitialized = true;
+		return;
+	}
+
+	Lane.Tokens = FMath::Min(Capacity, Lane.Tokens + (Now - Lane.LastRefillTime) * Rate);
+	Lane.LastRefillTime = Now;
+}
+
+void FTranslationRequestScheduler::Dispatch(ETranslateProvider Provider, FProviderLane& Lane, const FQueuedRequest& Queued, double Now)
+{
+	const double WaitSeconds = Now - Queued.EnqueueTime;
+	Lane.TotalWaitSeconds += WaitSeconds;
+	Lane.MaxWaitSeconds = FMath::Max(Lane.MaxWaitSeconds, WaitSeconds);
+	Lane.Sent++;
+	Lane.InFlight++;
+	TotalInFlight++;
+
+	FPriorityCounters& Counters = PriorityCounters[(int32)Queued.Priority];
+	Counters.TotalWaitSeconds += WaitSeconds;
+	Counters.MaxWaitSeconds = FMath::Max(Counters.MaxWaitSeconds, WaitSeconds);
+	Counters.Sent++;
+	Counters.InFlight++;
+
+	if (FTranslationProviderRunStats* RunStats = FindGroupProviderStats(Queued.Group, Provider))
+	{
+		RunStats->Requests++;
+	}
+
+	// 接管完成回调：先释放名额，可重试的失败重新排队，否则执行调用方的回调
+	TSharedRef<IHttpRequest, ESPMode::ThreadSafe> Request = Queued.Request.ToSharedRef();
+	InFlightGroups.Add(Queued.Request, Queued.Group);
+
+	FLanguageOneTrace::TraceRequestPhase(Queued.TraceRequestId, Queued.Group, Queued.TraceBatch, Provider, ELanguageOneRequestPhase::Sent, Queued.Attempt);
+	if (Queued.TraceRequestId != 0)
+	{
+		// 第一次收到响应数据时记录首字节时间
+		TSharedRef<bool> bFirstByteTraced = MakeShared<bool>(false);
+		const uint32 TraceRequestId = Queued.TraceRequestId;
+		const uint32 Group = Queued.Group;
+		const uint32 TraceBatch = Queued.TraceBatch;
+		const int32 Attempt = Queued.Attempt;
+#if (ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION >= 4)
+		Request->OnRequestProgress64().BindLambda([Provider, TraceRequestId, Group, TraceBatch, Attempt, bFirstByteTraced](FHttpRequestPtr InRequest, uint64 BytesSent, uint64 BytesReceived)
+#else
+		Request->OnRequestProgress().BindLambda([Provider, TraceRequestId, Group, TraceBatch, Attempt, bFirstByteTraced](FHttpRequestPtr InRequest, int32 BytesSent, int32 BytesReceived)
+#endif
+		{
+			if (BytesReceived > 0 && !*bFirstByteTraced)
+			{
+				*bFirstByteTraced = true;
+				FLanguageOneTrace::TraceRequestPhase(TraceRequestId, Group, TraceBatch, Provider, ELanguageOneRequestPhase::FirstByte, Attempt);
+			}
+		});
+	}
+
+	Request->OnProcessRequestComplete().BindLambda([this, Provider, Queued, SentTime = Now](FHttpRequestPtr InRequest, FHttpResponsePtr Response, bool bSuccess)
+	{
+		FLanguageOneTrace::TraceRequestPhase(Queued.TraceRequestId, Queued.Group, Queued.TraceBatch, Provider, ELanguageOneRequestPhase::Completed,
+			Queued.Attempt, Response.IsValid() ? Response->GetResponseCode() : 0);
+
+		InFlightGroups.Remove(Queued.Request);
+
+		// 交互请求和批量请求的耗时分开统计
+		const double LatencySeconds = FPlatformTime::Seconds() - SentTime;
+		FPriorityCounters& Counters = PriorityCounters[(int32)Queued.Priority];
+		Counters.InFlight = FMath::Max(0, Counters.InFlight - 1);
+		Counters.Completed++;
+		Counters.TotalLatencySeconds += LatencySeconds;
+		Counters.MaxLatencySeconds = FMath::Max(Counters.MaxLatencySeconds, LatencySeconds);
+		if (FProviderLane* Lane = Lanes.Find(Provider))
+		{
+			Lane->Completed++;
+			Lane->TotalLatencySeconds += LatencySeconds;
+			Lane->MaxLatencySeconds = FMath::Max(Lane->MaxLatencySeconds, LatencySeconds);
+		}
+
+		const double RetryAfterSeconds = OnRequestFinished(Provider, Response);
+
+		// 模块关闭：不再执行任何回调
+		if (bShuttingDown)
+		{
+			return;
+		}
+
+		// 请求组已取消：不记录统计、不重试，以失败回调
+		if (IsGroupCancelled(Queued.Group))
+		{
+			FailDroppedRequest(Queued);
+			ReleaseGroupRequest(Queued.Group);
+			return;
+		}
+
+		const bool bRequestSucceeded = bSuccess && Response.IsValid() && EHttpResponseCodes::IsOk(Response->GetResponseCode());
+		FProviderRouter::Get().RecordResult(Provider, LatencySeconds, bRequestSucceeded);
+
+		FTranslationProviderRunStats* RunStats = FindGroupProviderStats(Queued.Group, Provider);
+		if (RunStats)
+		{
+			RunStats->LatencySeconds.Add(LatencySeconds);
+		}
+
+		const int32 MaxRetries = GetDefault<ULanguageOneSettings>()->MaxRetryAttempts;
+		if (Queued.Attempt < MaxRetries && InRequest.IsValid() && IsRetryableFailure(Response, bSuccess))
+		{
+			if (RunStats)
+			{
+				RunStats->Retries++;
+			}
+			ScheduleRetry(Provider, Queued, InRequest, RetryAfterSeconds);
+			return;
+		}
+
+		if (RunStats && !bRequestSucceeded)
+		{
+			RunStats->Failures++;
+			RunStats->FailuresByReason.FindOrAdd(GetFailureReason(Response, bSuccess))++;
+		}
+
+		{
+			FScopedRequestGroup GroupScope(Queued.Group);
+			FScopedRequestPriority PriorityScope(Queued.Priority);
+			FLanguageOneTrace::FScopedBatch BatchScope(Queued.TraceBatch);
+			Queued.OnComplete.ExecuteIfBound(InRequest, Response, bSuccess);
+		}
+		ReleaseGroupRequest(Queued.Group);
+	});
+
+	if (!Request->ProcessRequest())
+	{
+		UE_LOG(LogTemp, Warning, TEXT("Failed to start translation request: %s"), *Request->GetURL());
+	}
+}
+
+uint32 FTranslationRequestScheduler::AllocateRequestGroup()
+{
+	return NextGroup++;
+}
+
+void FTranslationRequestScheduler::TrackRequestGroup(uint32 Group)
+{
+	if (Group != 0)
+	{
+		GroupStats.FindOrAdd(Group);
+	}
+}
+
+FTranslationGroupStats FTranslationRequestScheduler::TakeRequestGroupStats(uint32 Group)
+{
+	FTranslationGroupStats Stats;
+	GroupStats.RemoveAndCopyValue(Group, Stats);
+	return Stats;
+}
+
+void FTranslationRequestScheduler::RecordCharactersSent(ETranslateProvider Provider, int32 Characters)
+{
+	if (FTranslationProviderRunStats* RunStats = FindGroupProviderStats(CurrentGroup, Provider))
+	{
+		RunStats->CharactersSent += Characters;
+	}
+}
+
+void FTranslationRequestScheduler::RecordCacheHits(int32 Count)
+{
+	if (FTranslationGroupStats* Stats = GroupStats.Find(CurrentGroup))
+	{
+		Stats->CacheHits += Count;
+	}
+}
+
+FTranslationProviderRunStats* FTranslationRequestScheduler::FindGroupProviderStats(uint32 Group, ETranslateProvider Provider)
+{
+	FTranslationGroupStats* Stats = Group != 0 ? GroupStats.Find(Group) : nullptr;
+	return Stats ? &Stats->Providers.FindOrAdd(Provider) : nullptr;
+}
+
+FString FTranslationRequestScheduler::GetFailureReason(FHttpResponsePtr Response, bool bSuccess)
+{
+	if (!bSuccess || !Response.IsValid())
+	{
+		return TEXT("connection_failed");
+	}
+	return FString::Printf(TEXT("http_%d"), Response->GetResponseCode());
+}
+
+int32 FTranslationRequestScheduler::CancelRequestGroup(uint32 Group)
+{
+	if (Group == 0)
+	{
+		return 0;
+	}
+
+	CancelledGroups.Add(Group);
+
+	// 没有未完成的请求：只需要短时间记录取消状态，让迟到的请求立即失败
+	if (!GroupOutstanding.Contains(Group))
+	{
+		ExpiringCancelledGroups.Add(Group, FPlatformTime::Seconds() + LanguageOneRequestScheduler::CancelledGroupGraceSeconds);
+		return 0;
+	}
+
+	// 丢弃排队请求
+	TArray<FQueuedRequest> Dropped;
+	for (TPair<ETranslateProvider, FProviderLane>& Pair : Lanes)
+	{
+		FProviderLane& Lane = Pair.Value;
+		const auto IsInGroup = [Group](const FQueuedRequest& Queued) { return Queued.Group == Group; };
+
+		for (TArray<FQueuedRequest>* Queue : { &Lane.RetryQueue, &Lane.InteractiveQueue })
+		{
+			Dropped.Append(Queue->FilterByPredicate(IsInGroup));
+			Queue->RemoveAll(IsInGroup);
+		}
+
+		TArray<FQueuedRequest> Remaining;
+		for (int32 i = Lane.QueueHead; i < Lane.Queue.Num(); i++)
+		{
+			if (IsInGroup(Lane.Queue[i]))
+			{
+				Dropped.Add(MoveTemp(Lane.Queue[i]));
+			}
+			else
+			{
+				Remaining.Add(MoveTemp(Lane.Queue[i]));
+			}
+		}
+		Lane.Queue = MoveTemp(Remaining);
+		Lane.QueueHead = 0;
+	}
+
+	// 中止进行中的请求（完成回调释放并发名额，以失败转发给调用方）
+	TArray<TSharedPtr<IHttpRequest, ESPMode::ThreadSafe>> InFlightRequests;
+	for (const TPair<TSharedPtr<IHttpRequest, ESPMode::ThreadSafe>, uint32>& Pair : InFlightGroups)
+	{
+		if (Pair.Value == Group)
+		{
+			InFlightRequests.Add(Pair.Key);
+		}
+	}
+	const int32 CancelledCount = Dropped.Num() + InFlightRequests.Num();
+
+	// 被丢弃的排队请求以失败回调（回调中再次排队的请求会立即失败）
+	for (const FQueuedRequest& Queued : Dropped)
+	{
+		FailDroppedRequest(Queued);
+		ReleaseGroupRequest(Group);
+	}
+
+	for (const TSharedPtr<IHttpRequest, ESPMode::ThreadSafe>& Request : InFlightRequests)
+	{
+		Request->CancelRequest();
+	}
+
+	if (CancelledCount > 0)
+	{
+		UE_LOG(LogTemp, Log, TEXT("Cancelled translation request group %u: %d requests dropped"), Group, CancelledCount);
+	}
+	return CancelledCount;
+}
+
+void FTranslationRequestScheduler::ReleaseGroupRequest(uint32 Group)
+{
+	int32* Outstanding = Group != 0 ? GroupOutstanding.Find(Group) : nullptr;
+	if (Outstanding && --(*Outstanding) <= 0)
+	{
+		GroupOutstanding.Remove(Group);
+		if (CancelledGroups.Contains(Group))
+		{
+			ExpiringCancelledGroups.Add(Group, FPlatformTime::Seconds() + LanguageOneRequestScheduler::CancelledGroupGraceSeconds);
+		}
+	}
+}
+
+void FTranslationRequestScheduler::FailDroppedRequest(const FQueuedRequest& Queued)
+{
+	FScopedRequestGroup GroupScope(Queued.Group);
+	FScopedRequestPriority PriorityScope(Queued.Priority);
+	FLanguageOneTrace::FScopedBatch BatchScope(Queued.TraceBatch);
+	Queued.OnComplete.ExecuteIfBound(Queued.Request, nullptr, false);
+}
+
+bool FTranslationRequestScheduler::PopNextRequest(FProviderLane& Lane, ETranslationRequestPriority Priority, double Now, FQueuedRequest& OutRequest)
+{
+	// 到期的重试优先发送
+	for (int32 i = 0; i < Lane.RetryQueue.Num(); i++)
+	{
+		if (Lane.RetryQueue[i].Priority == Priority && Lane.RetryQueue[i].NotBefore <= Now)
+		{
+			OutRequest = Lane.RetryQueue[i];
+			Lane.RetryQueue.RemoveAt(i);
+			return true;
+		}
+	}
+
+	if (Priority == ETranslationRequestPriority::Interactive)
+	{
+		if (Lane.InteractiveQueue.Num() == 0)
+		{
+			return false;
+		}
+		OutRequest = Lane.InteractiveQueue[0];
+		Lane.InteractiveQueue.RemoveAt(0);
+		return true;
+	}
+
+	if (Lane.QueueHead >= Lane.Queue.Num())
+	{
+		return false;
+	}
+
+	OutRequest = Lane.Queue[Lane.QueueHead++];
+
+	// 队列清空时回收数组
+	if (Lane.QueueHead >= Lane.Queue.Num())
+	{
+		Lane.Queue.Reset();
+		Lane.QueueHead = 0;
+	}
+	return true;
+}
+
+void FTranslationRequestScheduler::ScheduleRetry(ETranslateProvider Provider, const FQueuedRequest& Failed, FHttpRequestPtr FailedRequest, double MinDelaySeconds)
+{
+	FProviderLane& Lane = Lanes.FindOrAdd(Provider);
+	const double Now = FPlatformTime::Seconds();
+
+	// 带抖动的指数退避：Base * 2^Attempt 的一半固定，另一半随机
+	const double BaseDelay = FMath::Max(0.1, (double)GetDefault<ULanguageOneSettings>()->RetryBaseDelaySeconds);
+	const double Backoff = FMath::Min(LanguageOneRequestScheduler::MaxBackoffSeconds, BaseDelay * FMath::Pow(2.0, (double)Failed.Attempt));
+	const double Delay = FMath::Max(MinDelaySeconds, Backoff * 0.5 + FMath::FRand() * Backoff * 0.5);
+
+	FQueuedRequest& Retry = Lane.RetryQueue.Add_GetRef({ LanguageOneRequestScheduler::CloneRequest(FailedRequest), Now });
+	Retry.OnComplete = Failed.OnComplete;
+	Retry.Attempt = Failed.Attempt + 1;
+	Retry.NotBefore = Now + Delay;
+	Retry.Group = Failed.Group;
+	Retry.Priority = Failed.Priority;
+	Retry.TraceRequestId = Failed.TraceRequestId;
+	Retry.TraceBatch = Failed.TraceBatch;
+	Lane.Retried++;
+	PriorityCounters[(int32)Retry.Priority].Retried++;
+	FLanguageOneTrace::TraceRequestPhase(Retry.TraceRequestId, Retry.Group, Retry.TraceBatch, Provider, ELanguageOneRequestPhase::Queued, Retry.Attempt);
+
+	UE_LOG(LogTemp, Log, TEXT("Retrying translation request to provider %d in %.2fs (attempt %d)"), (int32)Provider, Delay, Retry.Attempt);
+}
+
+bool FTranslationRequestScheduler::IsRetryableFailure(FHttpResponsePtr Response, bool bSuccess)
+{
+	// 连接失败、超时
+	if (!bSuccess || !Response.IsValid())
+	{
+		return true;
+	}
+
+	const int32 ResponseCode = Response->GetResponseCode();
+	return ResponseCode == EHttpResponseCodes::RequestTimeout
+		|| ResponseCode == EHttpResponseCodes::TooManyRequests
+		|| ResponseCode >= EHttpResponseCodes::ServerError;
+}
+
+double FTranslationRequestScheduler::OnRequestFinished(ETranslateProvider Provider, FHttpResponsePtr Response)
+{
+	TotalInFlight = FMath::Max(0, TotalInFlight - 1);
+
+	FProviderLane* Lane = Lanes.Find(Provider);
+	if (!Lane)
+	{
+		return 0.0;
+	}
+
+	Lane->InFlight = FMath::Max(0, Lane->InFlight - 1);
+
+	double PauseSeconds = 0.0;
+	if (Response.IsValid())
+	{
+		const int32 ResponseCode = Response->GetResponseCode();
+		const FString RetryAfterHeader = Response->GetHeader(TEXT("Retry-After"));
+
+		if (!RetryAfterHeader.IsEmpty() && ParseRetryAfter(RetryAfterHeader, PauseSeconds))
+		{
+			PauseSeconds = FMath::Min(PauseSeconds, LanguageOneRequestScheduler::MaxRetryAfterSeconds);
+		}
+		else if (ResponseCode == EHttpResponseCodes::TooManyRequests)
+		{
+			PauseSeconds = LanguageOneRequestScheduler::DefaultThrottleSeconds;
+		}
+
+		if (PauseSeconds > 0.0)
+		{
+			Lane->Throttled++;
+			Lane->BlockedUntil = FMath::Max(Lane->BlockedUntil, FPlatformTime::Seconds() + PauseSeconds);
+			// 暂停结束后从空桶开始，避免立即再次突发
+			Lane->Tokens = 0.0;
+			UE_LOG(LogTemp, Warning, TEXT("Translation provider %d throttled (HTTP %d), pausing for %.1fs with %d requests queued"),
+				(int32)Provider, ResponseCode, PauseSeconds, Lane->NumQueued());
+		}
+	}
+
+	Pump();
+	return PauseSeconds;
+}
+
+bool FTranslationRequestScheduler::Tick(float DeltaTime)
+{
+	Pump();
+
+	// 移除到期的取消记录（期间又有请求排队的组保留到这些请求结束）
+	const double Now = FPlatformTime::Seconds();
+	for (auto It = ExpiringCancelledGroups.CreateIterator(); It; ++It)
+	{
+		if (It.Value() <= Now)
+		{
+			if (!GroupOutstanding.Contains(It.Key()))
+			{
+				CancelledGroups.Remove(It.Key());
+			}
+			It.RemoveCurrent();
+		}
+	}
+	return true;
+}
+
+bool FTranslationRequestScheduler::ParseRetryAfter(const FString& HeaderValue, double& OutSeconds)
+{
+	const FString Value = HeaderValue.TrimStartAndEnd();
+
+	// 秒数格式：Retry-After: 120
+	if (Value.IsNumeric())
+	{
+		OutSeconds = FMath::Max(0.0, FCString::Atod(*Value));
+		return true;
+	}
+
+	// HTTP 日期格式：Retry-After: Fri, 31 Dec 1999 23:59:59 GMT
+	FDateTime RetryTime;
+	if (FDateTime::ParseHttpDate(Value, RetryTime))
+	{
+		OutSeconds = FMath::Max(0.0, (RetryTime - FDateTime::UtcNow()).GetTotalSeconds());
+		return true;
+	}
+
+	return false;
+}
+
+FTranslationSchedulerStats FTranslationRequestScheduler::MakeStats(const FProviderLane& Lane)
+{
+	FTranslationSchedulerStats Stats;
+	Stats.QueuedRequests = Lane.NumQueued();
+	Stats.InFlightRequests = Lane.InFlight;
+	Stats.SentRequests = Lane.Sent;
+	Stats.ThrottledResponses = Lane.Throttled;
+	Stats.RetriedRequests = Lane.Retried;
+	Stats.AverageWaitSeconds = Lane.Sent > 0 ? Lane.TotalWaitSeconds / Lane.Sent : 0.0;
+	Stats.MaxWaitSeconds = Lane.MaxWaitSeconds;
+	Stats.AverageLatencySeconds = Lane.Completed > 0 ? Lane.TotalLatencySeconds / Lane.Completed : 0.0;
+	Stats.MaxLatencySeconds = Lane.MaxLatencySeconds;
+	return Stats;
+}
+
+FTranslationSchedulerStats FTranslationRequestScheduler::GetPriorityStats(ETranslationRequestPriority Priority) const
+{
+	const FPriorityCounters& Counters = PriorityCounters[(int32)Priority];
+
+	FTranslationSchedulerStats Stats;
+	for (const TPair<ETranslateProvider, FProviderLane>& Pair : Lanes)
+	{
+		const FProviderLane& Lane = Pair.Value;
+		Stats.QueuedRequests += Priority == ETranslationRequestPriority::Interactive ? Lane.InteractiveQueue.Num() : Lane.Queue.Num() - Lane.QueueHead;
+		Stats.QueuedRequests += Lane.RetryQueue.FilterByPredicate([Priority](const FQueuedRequest& Queued) { return Queued.Priority == Priority; }).Num();
+	}
+	Stats.InFlightRequests = Counters.InFlight;
+	Stats.SentRequests = Counters.Sent;
+	Stats.RetriedRequests = Counters.Retried;
+	Stats.AverageWaitSeconds = Counters.Sent > 0 ? Counters.TotalWaitSeconds / Counters.Sent : 0.0;
+	Stats.MaxWaitSeconds = Counters.MaxWaitSeconds;
+	Stats.AverageLatencySeconds = Counters.Completed > 0 ? Counters.TotalLatencySeconds / Counters.Completed : 0.0;
+	Stats.MaxLatencySeconds = Counters.MaxLatencySeconds;
+	return Stats;
+}
+
+FTranslationSchedulerStats FTranslationRequestScheduler::GetProviderStats(ETranslateProvider Provider) const
+{
+	const FProviderLane* Lane = Lanes.Find(Provider);
+	return Lane ? MakeStats(*Lane) : FTranslationSchedulerStats();
+}
+
+FTranslationSchedulerStats FTranslationRequestScheduler::GetStats() const
+{
+	FTranslationSchedulerStats Total;
+	double TotalWait = 0.0;
+	double TotalLatency = 0.0;
+	int32 Completed = 0;
+	for (const TPair<ETranslateProvider, FProviderLane>& Pair : Lanes)
+	{
+		const FProviderLane& Lane = Pair.Value;
+		Total.QueuedRequests += Lane.NumQueued();
+		Total.InFlightRequests += Lane.InFlight;
+		Total.SentRequests += Lane.Sent;
+		Total.ThrottledResponses += Lane.Throttled;
+		Total.RetriedRequests += Lane.Retried;
+		Total.MaxWaitSeconds = FMath::Max(Total.MaxWaitSeconds, Lane.MaxWaitSeconds);
+		Total.MaxLatencySeconds = FMath::Max(Total.MaxLatencySeconds, Lane.MaxLatencySeconds);
+		TotalWait += Lane.TotalWaitSeconds;
+		TotalLatency += Lane.TotalLatencySeconds;
+		Completed += Lane.Completed;
+	}
+	Total.AverageWaitSeconds = Total.SentRequests > 0 ? TotalWait / Total.SentRequests : 0.0;
+	Total.AverageLatencySeconds = Completed > 0 ? TotalLatency / Completed : 0.0;
+	return Total;
+}
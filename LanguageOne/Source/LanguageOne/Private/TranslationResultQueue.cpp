@@ -0,0 +1,136 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "TranslationResultQueue.h"
+#include "LanguageOneTrace.h"
+#include "LanguageOneSettings.h"
+#include "Async/Async.h"
+#include "HAL/PlatformProcess.h"
+#include "HAL/PlatformTime.h"
+
+FTranslationResultQueue& FTranslationResultQueue::Get()
+{
+	static FTranslationResultQueue Instance;
+	return Instance;
+}
+
+void FTranslationResultQueue::Initialize()
+{
+	bShuttingDown.store(false, std::memory_order_release);
+	if (!TickerHandle.IsValid())
+	{
+		TickerHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateRaw(this, &FTranslationResultQueue::Tick));
+	}
+}
+
+void FTranslationResultQueue::Shutdown()
+{
+	// 顺序一致：与 Post 中先计数再检查标志配对，标志可见之后开始的 Post 不会入队，之前开始的都计入 RunningTasks
+	bShuttingDown.store(true, std::memory_order_seq_cst);
+
+	if (TickerHandle.IsValid())
+	{
+		FTSTicker::GetCoreTicker().RemoveTicker(TickerHandle);
+		TickerHandle.Reset();
+	}
+
+	// 解析很短，等待进行中的解析和投递结束，之后清空队列时不会再有回调入队
+	while (RunningTasks.load(std::memory_order_seq_cst) > 0)
+	{
+		FPlatformProcess::Sleep(0.0f);
+	}
+
+	const int32 DroppedCount = PendingCount.load();
+	for (TQueue<FPendingResult, EQueueMode::Mpsc>& Queue : Results)
+	{
+		Queue.Empty();
+	}
+	PendingCount = 0;
+	if (DroppedCount > 0)
+	{
+		UE_LOG(LogTemp, Log, TEXT("Dropped %d translation results on shutdown"), DroppedCount);
+	}
+}
+
+void FTranslationResultQueue::Launch(TUniqueFunction<void()> Work)
+{
+	// 关闭后直接在当前线程执行（Post 的结果会被丢弃）
+	if (bShuttingDown.load(std::memory_order_acquire))
+	{
+		Work();
+		return;
+	}
+
+	RunningTasks++;
+	AsyncTask(ENamedThreads::AnyBackgroundThreadNormalTask, [this, Work = MoveTemp(Work)]()
+	{
+		Work();
+		RunningTasks--;
+	});
+}
+
+void FTranslationResultQueue::Post(uint32 Group, ETranslationRequestPriority Priority, uint32 TraceBatch, TUniqueFunction<void()> Callback)
+{
+	// 投递期间计入 RunningTasks，Shutdown 等待投递结束后才清空队列
+	RunningTasks.fetch_add(1, std::memory_order_seq_cst);
+	if (bShuttingDown.load(std::memory_order_seq_cst))
+	{
+		RunningTasks.fetch_sub(1, std::memory_order_release);
+		return;
+	}
+
+	FPendingResult Pending;
+	Pending.Group = Group;
+	Pending.Priority = Priority;
+	Pending.TraceBatch = TraceBatch;
+	Pending.Callback = MoveTemp(Callback);
+
+	PendingCount++;
+	Results[(int32)Priority].Enqueue(MoveTemp(Pending));
+	RunningTasks.fetch_sub(1, std::memory_order_release);
+}
+
+bool FTranslationResultQueue::Tick(float DeltaTime)
+{
+	if (PendingCount.load() == 0)
+	{
+		return true;
+	}
+
+	LANGUAGEONE_TRACE_SCOPE("LanguageOne::DrainResults");
+
+	// 至少执行一个回调，超过预算后留到下一帧
+	const double BudgetSeconds = FMath::Max(0.0f, GetDefault<ULanguageOneSettings>()->ResultApplyBudgetMs) / 1000.0;
+	const double StartTime = FPlatformTime::Seconds();
+	int32 ExecutedCount = 0;
+
+	// 先执行交互结果，再执行批量结果
+	FPendingResult Pending;
+	bool bOverBudget = false;
+	for (int32 PriorityIndex = (int32)ETranslationRequestPriority::Count - 1; PriorityIndex >= 0 && !bOverBudget; PriorityIndex--)
+	{
+		while (Results[PriorityIndex].Dequeue(Pending))
+		{
+			PendingCount--;
+			{
+				FTranslationRequestScheduler::FScopedRequestGroup GroupScope(Pending.Group);
+				FTranslationRequestScheduler::FScopedRequestPriority PriorityScope(Pending.Priority);
+				FLanguageOneTrace::FScopedBatch BatchScope(Pending.TraceBatch);
+				Pending.Callback();
+			}
+			Pending.Callback.Reset();
+			ExecutedCount++;
+
+			if (FPlatformTime::Seconds() - StartTime >= BudgetSeconds)
+			{
+				bOverBudget = true;
+				break;
+			}
+		}
+	}
+
+	if (bOverBudget && PendingCount.load() > 0)
+	{
+		UE_LOG(LogTemp, VeryVerbose, TEXT("Applied %d translation results this frame, %d deferred to the next frame"), ExecutedCount, PendingCount.load());
+	}
+	return true;
+}
@@ -0,0 +1,126 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "AssetRegistry/AssetData.h"
+
+struct FStreamableHandle;
+struct FStreamableManager;
+class FAssetStreamLoader;
+
+/**
+ * 分窗口处理设置 - 每个窗口的资产全部回调后暂停加载，调用方写回完成后释放窗口再继续
+ */
+struct FAssetStreamWindow
+{
+	/** 每个窗口的资产数量（0 表示不分窗口） */
+	int32 WindowSize = 0;
+
+	/** 内存上限（字节）：已用物理内存超过上限时提前结束当前窗口（0 表示不限制） */
+	uint64 MemoryCeilingBytes = 0;
+
+	/** 窗口内资产全部回调后调用（包括最后一个窗口）；调用方处理完成后调用 ReleaseWindowAndContinue */
+	TFunction<void(FAssetStreamLoader& Loader)> OnWindowDelivered;
+
+	bool IsEnabled() const { return WindowSize > 0; }
+
+	/** 按设置创建（未启用低内存批处理时不分窗口） */
+	static FAssetStreamWindow FromSettings(TFunction<void(FAssetStreamLoader& Loader)> InOnWindowDelivered);
+};
+
+/**
+ * 资产流式加载器 - 批量操作时通过 FStreamableManager 异步加载资产
+ *
+ * - 同时最多加载 LookAhead 个资产（默认取设置 AssetLoadLookAhead），加载完成一个再发起下一个
+ * - 每个资产加载完成后立即在游戏线程回调，处理与后续资产的加载、网络请求并行进行
+ * - 已在内存中的资产不经过 FStreamableManager，直接回调
+ * - 回调收到加载句柄：持有句柄可以让资产保持加载，释放后资产可以被 GC 回收
+ * - 分窗口模式：每个窗口释放时保存本次修改的包，卸载本次加载的包并执行垃圾回收，内存峰值只取决于窗口大小
+ *   （开始处理前已有未保存修改的包不保存、不卸载，留给用户自己确认）
+ */
+class LANGUAGEONE_API FAssetStreamLoader : public TSharedFromThis<FAssetStreamLoader>
+{
+public:
+	/** 资产加载完成（加载失败时 Asset 为空） */
+	using FOnAssetLoaded = TFunction<void(const FAssetData& AssetData, UObject* Asset, TSharedPtr<FStreamableHandle> Handle)>;
+
+	/** 创建加载器并开始加载；所有资产都回调（分窗口时最后一个窗口释放）后调用 OnFinished，取消后不再调用 */
+	static TSharedRef<FAssetStreamLoader> Start(const TArray<FAssetData>& InAssets, FOnAssetLoaded InOnAssetLoaded, TFunction<void()> InOnFinished, FAssetStreamWindow InWindow = FAssetStreamWindow(), int32 InLookAhead = 0);
+
+	/** 停止加载：取消尚未完成的加载请求，之后不再回调 */
+	void Cancel();
+
+	/** 释放当前窗口（下一帧执行）：保存本次修改的包，卸载本次加载的包，垃圾回收，然后加载下一个窗口 */
+	void ReleaseWindowAndContinue();
+
+	bool IsFinished() const { return bFinished; }
+
+	/** 已回调的资产数量 */
+	int32 GetProcessedCount() const { return ProcessedCount; }
+
+	/** 插件共用的 FStreamableManager */
+	static FStreamableManager& GetStreamableManager();
+
+private:
+	FAssetStreamLoader(const TArray<FAssetData>& InAssets, FOnAssetLoaded InOnAssetLoaded, TFunction<void()> InOnFinished, FAssetStreamWindow InWindow, int32 InLookAhead);
+
+	/** 发起加载，直到达到预加载数量 */
+	void IssueLoads();
+
+	/** 资产加载完成（可能在 RequestAsyncLoad 内同步触发） */
+	void OnLoaded(int32 AssetIndex);
+
+	/** 回调一个资产 */
+	void ProcessAsset(int32 AssetIndex, UObject* Asset, TSharedPtr<FStreamableHandle> Handle);
+
+	/** 当前窗口是否已满（资产数量或内存达到上限） */
+	bool IsWindowFull() const;
+
+	/** 保存、卸载并回收当前窗口 */
+	void ReleaseWindow();
+
+	/** 所有资产都已回调时结束 */
+	void TryFinish();
+
+private:
+	TArray<FAssetData> Assets;
+	FOnAssetLoaded OnAssetLoaded;
+	TFunction<void()> OnFinished;
+	FAssetStreamWindow Window;
+	int32 LookAhead = 1;
+
+	/** 下一个要发起加载的资产 */
+	int32 NextToIssue = 0;
+
+	/** 正在加载的资产 */
+	TMap<int32, TSharedPtr<FStreamableHandle>> LoadingHandles;
+
+	/** 已加载完成、等待回调的资产（按完成顺序） */
+	TArray<int32> CompletedIndices;
+
+	/** 当前窗口已发起的资产数量 */
+	int32 WindowIssued = 0;
+
+	/** 当前窗口已全部回调，等待调用方释放 */
+	bool bWindowPaused = false;
+
+	/** 当前窗口回调过的资产 */
+	struct FWindowAsset
+	{
+		TWeakObjectPtr<UObject> Asset;
+
+		/** 由加载器加载（开始前未在内存中），释放窗口时可以卸载 */
+		bool bLoadedByLoader = false;
+
+		/** 回调前包已有未保存的修改（用户自己的修改），释放窗口时不保存 */
+		bool bWasDirty = false;
+	};
+	TArray<FWindowAsset> WindowAssets;
+
+	int32 ProcessedCount = 0;
+	int32 WindowCount = 0;
+	bool bIsIssuing = false;
+	bool bCancelled = false;
+	bool bFinished = false;
+};
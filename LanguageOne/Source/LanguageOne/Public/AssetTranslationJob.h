@@ -0,0 +1,185 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Async/Future.h"
+#include "Containers/Ticker.h"
+#include "AssetTranslator.h"
+#include "TranslationRequestScheduler.h"
+
+class STranslationProgressWindow;
+class FAssetStreamLoader;
+
+/**
+ * 资产任务结果
+ */
+struct FAssetTranslationJobResult
+{
+	/** 任务中的资产数量 */
+	int32 TotalAssets = 0;
+
+	/** 所有文本单元都成功写回的资产数量 */
+	int32 SucceededAssets = 0;
+
+	/** 加载失败或有文本单元翻译失败的资产数量 */
+	int32 FailedAssets = 0;
+
+	/** 取消时尚未完成的资产数量 */
+	int32 CancelledAssets = 0;
+
+	/** 是否被取消 */
+	bool bCancelled = false;
+
+	/** 撤销事务中保存的对象快照数量 */
+	int32 UndoSnapshots = 0;
+
+	/** 任务期间撤销缓冲增长的字节数 */
+	uint64 UndoBufferBytes = 0;
+
+	/** 任务开始和结束时编辑器已用的物理内存（字节） */
+	uint64 StartMemoryBytes = 0;
+	uint64 EndMemoryBytes = 0;
+
+	/** 任务期间编辑器已用物理内存的峰值（字节，每帧采样） */
+	uint64 PeakMemoryBytes = 0;
+
+	/** 任务耗时（秒） */
+	double ElapsedSeconds = 0.0;
+
+	/** 文本单元统计 */
+	FTranslationBatchStats Stats;
+
+	/** 任务请求组的请求统计 */
+	FTranslationGroupStats RequestStats;
+
+	/** 任务报告文件路径（未写入时为空） */
+	FString ReportPath;
+};
+
+/**
+ * 资产翻译任务 - 跟踪一次批量操作中所有未完成的文本单元
+ *
+ * - 资产的所有文本单元都完成（写回或失败）后才计入成功/失败
+ * - 所有资产完成或任务被取消时结束：兑现 Future、更新进度组件、恢复处理状态
+ * - 任务的翻译请求归入调度器的请求组，取消任务会丢弃排队请求并中止进行中的请求
+ * - 任务持有资产加载器，取消任务会停止尚未完成的加载
+ * - 每个资产第一次写回前在一个撤销事务中为涉及的对象各保存一次快照，结束时汇报内存（任务期间每帧采样峰值）和撤销缓冲占用
+ * - 结束时把文本统计、请求组的请求统计和耗时写入 JSON 报告（bWriteRunReports）
+ * - 同一时间只运行一个任务；所有方法都在游戏线程调用
+ */
+class LANGUAGEONE_API FAssetTranslationJob : public TSharedFromThis<FAssetTranslationJob>
+{
+public:
+	/** 创建并启动任务，设置为当前任务；InOperationId 是报告中使用的操作标识（translate、restore 等） */
+	static TSharedRef<FAssetTranslationJob> Start(const FString& InOperationName, const FString& InOperationId, int32 InTotalAssets, TSharedPtr<STranslationProgressWindow> InProgressWidget);
+
+	/** 当前正在运行的任务（没有则为空） */
+	static TSharedPtr<FAssetTranslationJob> GetActive();
+
+	/** 取消当前任务；没有正在运行的任务时返回 false */
+	static bool CancelActive();
+
+	/** 登记资产的待完成文本单元 */
+	void AddPendingUnits(const TWeakObjectPtr<UObject>& Asset, int32 Count);
+
+	/** 资产是否还有未完成的文本单元 */
+	bool HasPendingUnits(const TWeakObjectPtr<UObject>& Asset) const;
+
+	/** 文本单元完成；资产的最后一个单元完成时先调用 FinalizeAsset 再计入结果，返回该资产是否已全部完成 */
+	bool CompleteUnit(const TWeakObjectPtr<UObject>& Asset, bool bSucceeded, TFunctionRef<void(UObject*)> FinalizeAsset);
+
+	/** 不需要翻译文本单元的资产直接完成（加载失败、只有还原操作等） */
+	void CompleteAsset(const FString& AssetName, bool bSucceeded);
+
+	/** 资产第一次写回前调用：在一个撤销事务中为资产和 Objects 中的对象各保存一次快照（每个资产只记录一次，未启用撤销记录时忽略） */
+	void RecordUndo(UObject* Asset, const TArray<UObject*>& Objects);
+
+	/** 设置任务的资产加载器：任务持有加载器直到结束，取消任务时停止加载（任务已结束时忽略） */
+	void SetAssetLoader(TSharedPtr<FAssetStreamLoader> InAssetLoader);
+
+	/** 所有请求都已发出；之后没有未完成资产时任务结束 */
+	void Seal();
+
+	/** 取消任务：之后到达的结果不再写回 */
+	void Cancel();
+
+	bool IsCancelled() const { return bCancelled; }
+	bool IsFinished() const { return bFinished; }
+
+	/** 调度器请求组，发出翻译请求时用 FTranslationRequestScheduler::FScopedRequestGroup 包裹 */
+	uint32 GetRequestGroup() const { return RequestGroup; }
+
+	/** 文本单元统计（由调用方填写） */
+	FTranslationBatchStats& GetStats() { return Result.Stats; }
+
+	/** 任务结束时兑现 */
+	TSharedFuture<FAssetTranslationJobResult> GetFuture() const { return Future; }
+
+	/** 任务结束时在游戏线程调用（在 Future 兑现之前） */
+	void SetOnFinished(TFunction<void(const FAssetTranslationJobResult&)> InOnFinished) { OnFinished = MoveTemp(InOnFinished); }
+
+private:
+	FAssetTranslationJob(const FString& InOperationName, const FString& InOperationId, int32 InTotalAssets, TSharedPtr<STranslationProgressWindow> InProgressWidget);
+
+	/** 资产完成，更新计数和进度 */
+	void OnAssetFinished(const FString& AssetName, bool bSucceeded);
+
+	/** 检查是否所有资产都已完成 */
+	void TryFinish();
+
+	/** 结束任务 */
+	void Finish();
+
+	/** 采样已用物理内存，更新任务期间的峰值 */
+	void SampleMemory();
+
+	/** 每帧采样内存的定时器回调 */
+	bool TickMemorySample(float DeltaTime);
+
+	/** 把任务结果写入 Saved/LanguageOne/Reports/ 下的 JSON 报告，返回文件路径（失败时为空） */
+	FString WriteReport() const;
+
+private:
+	FString OperationName;
+	FString OperationId;
+	TSharedPtr<STranslationProgressWindow> ProgressWidget;
+	TSharedPtr<FAssetStreamLoader> AssetLoader;
+
+	/** 每个资产尚未完成的文本单元数量，以及是否有失败的单元 */
+	struct FPendingAsset
+	{
+		int32 PendingUnits = 0;
+		bool bAnyFailed = false;
+	};
+	TMap<TWeakObjectPtr<UObject>, FPendingAsset> PendingAssets;
+
+	/** 已记录撤销快照的资产 */
+	TSet<TWeakObjectPtr<UObject>> UndoRecordedAssets;
+
+	/** 是否记录撤销（设置开启，且不是低内存批处理或命令行运行） */
+	bool bRecordUndo = false;
+
+	/** 任务开始时撤销缓冲的大小 */
+	uint64 UndoSizeAtStart = 0;
+
+	/** 每帧采样内存的定时器 */
+	FTSTicker::FDelegateHandle MemorySampleHandle;
+
+	/** 任务开始时间 */
+	double StartTime = 0.0;
+	FDateTime StartTimeUtc;
+
+	int32 CompletedAssets = 0;
+	uint32 RequestGroup = 0;
+	bool bSealed = false;
+	bool bCancelled = false;
+	bool bFinished = false;
+
+	FAssetTranslationJobResult Result;
+	TPromise<FAssetTranslationJobResult> Promise;
+	TSharedFuture<FAssetTranslationJobResult> Future;
+	TFunction<void(const FAssetTranslationJobResult&)> OnFinished;
+
+	static TSharedPtr<FAssetTranslationJob> ActiveJob;
+};
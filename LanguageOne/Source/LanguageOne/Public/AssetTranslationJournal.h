@@ -0,0 +1,87 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/Ticker.h"
+#include "AssetRegistry/AssetData.h"
+
+/**
+ * 批量翻译日志 - 把任务进度记录在 Saved/LanguageOne/Jobs/ 下，编辑器崩溃或关闭后可以从中断处继续
+ *
+ * - 日志按任务内容命名：相同的资产集合、翻译服务和目标语言对应同一个日志文件
+ * - 记录已完成的原文译文，以及已写回的资产（带写回时间）
+ * - 新记录先缓冲，攒满一小批或经过几秒后追加到文件
+ * - 再次翻译同一批资产时读取日志：已有译文的原文不再发送请求；写回后包文件已保存的资产直接跳过
+ * - 任务全部成功后删除日志；取消或有失败时保留，下次继续
+ *
+ * 所有方法都在游戏线程调用
+ */
+class LANGUAGEONE_API FAssetTranslationJournal : public TSharedFromThis<FAssetTranslationJournal>
+{
+public:
+	/** 打开资产集合对应的日志，读取上次中断时的记录；未启用断点续传时返回空 */
+	static TSharedPtr<FAssetTranslationJournal> Open(const TArray<FAssetData>& Assets);
+
+	/** 删除超过保留天数的旧日志（模块启动时调用） */
+	static void CleanupStaleJournals();
+
+	/** 日志目录 */
+	static FString GetJournalDirectory();
+
+	~FAssetTranslationJournal();
+
+	/** 是否读取到了上次中断的记录 */
+	bool IsResumed() const { return Translations.Num() > 0 || AppliedAssets.Num() > 0; }
+
+	/** 查找上次已完成的译文 */
+	const FString* FindTranslation(const FString& SourceText) const { return Translations.Find(SourceText); }
+
+	/** 资产上次已写回，且之后包文件已保存（可以跳过） */
+	bool IsAssetCompleted(const FAssetData& AssetData) const;
+
+	/** 记录原文的译文 */
+	void RecordTranslation(const FString& SourceText, const FString& Translation);
+
+	/** 记录资产已写回 */
+	void RecordAppliedAsset(const UObject* Asset);
+
+	/** 把缓冲的记录追加到文件 */
+	void Flush();
+
+	/** 任务结束：bSucceeded 为 true 时删除日志，否则写入剩余记录并保留 */
+	void Close(bool bSucceeded);
+
+	/** 日志文件路径 */
+	const FString& GetFilePath() const { return FilePath; }
+
+private:
+	FAssetTranslationJournal(const FString& InFilePath, const FString& InHeaderLine);
+
+	/** 读取已有日志 */
+	void Load();
+
+	/** 追加一行，缓冲满时立即写入，否则稍后写入 */
+	void AppendLine(const FString& Line);
+
+	bool OnFlushTimer(float DeltaTime);
+
+private:
+	FString FilePath;
+
+	/** 新建文件时写入的文件头 */
+	FString HeaderLine;
+
+	/** 上次及本次已完成的译文（原文 -> 译文） */
+	TMap<FString, FString> Translations;
+
+	/** 已写回的资产及写回时间（UTC） */
+	TMap<FString, FDateTime> AppliedAssets;
+
+	/** 尚未写入文件的行 */
+	FString PendingLines;
+	int32 PendingCount = 0;
+
+	FTSTicker::FDelegateHandle FlushTickerHandle;
+	bool bClosed = false;
+};
@@ -0,0 +1,80 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "AssetRegistry/AssetData.h"
+#include "ContentBrowserFrontEndFilterExtension.h"
+#include "AssetTranslationTags.generated.h"
+
+/**
+ * 资产翻译状态
+ */
+struct FAssetTranslationState
+{
+	/** 文本单元数量 */
+	int32 TotalUnits = 0;
+
+	/** 已包含译文的文本单元数量 */
+	int32 TranslatedUnits = 0;
+
+	/** 保存时设置的目标语言 */
+	FString TargetLanguage;
+
+	/** 所有原文的哈希（原文变化后与上次保存时不同） */
+	FString SourceHash;
+
+	bool HasTranslation() const { return TranslatedUnits > 0; }
+	bool IsFullyTranslated() const { return TotalUnits > 0 && TranslatedUnits >= TotalUnits; }
+	bool NeedsTranslation() const { return TranslatedUnits < TotalUnits; }
+};
+
+/**
+ * 资产翻译状态标签 - 保存资产时写入资产注册表，之后只读取 FAssetData 就能知道翻译状态
+ *
+ * - 保存 String Table、Data Table、蓝图时统计文本单元：已翻译数/总数、目标语言、原文哈希
+ * - 标签显示在内容浏览器的列视图和提示中，并提供“已翻译 / 未完成翻译”过滤器
+ * - 读取状态不加载资产；标签只在保存时更新，未保存的修改不会反映在标签中
+ */
+class LANGUAGEONE_API FAssetTranslationTags
+{
+public:
+	/** 标签名称 */
+	static const FName StatusTag;
+	static const FName TranslatedUnitsTag;
+	static const FName TotalUnitsTag;
+	static const FName TargetLanguageTag;
+	static const FName SourceHashTag;
+
+	/** 注册资产注册表标签回调（模块启动时调用） */
+	static void Initialize();
+
+	/** 注销回调（模块关闭时调用） */
+	static void Shutdown();
+
+	/** 从 FAssetData 的标签读取状态（不加载资产）；资产没有标签时返回 false */
+	static bool TryGetState(const FAssetData& AssetData, FAssetTranslationState& OutState);
+
+	/** 统计已加载资产的翻译状态 */
+	static FAssetTranslationState ComputeState(UObject* Asset);
+
+	/** 为对象添加翻译状态标签（类默认对象添加空标签，使内容浏览器显示对应的列） */
+	static void AppendTags(const UObject* Object, TArray<UObject::FAssetRegistryTag>& OutTags);
+
+private:
+	static FDelegateHandle TagsDelegateHandle;
+	static FDelegateHandle PreSaveDelegateHandle;
+	static FDelegateHandle PackageSavedDelegateHandle;
+};
+
+/**
+ * 内容浏览器过滤器扩展 - 按翻译状态标签过滤资产
+ */
+UCLASS()
+class ULanguageOneFrontEndFilterExtension : public UContentBrowserFrontEndFilterExtension
+{
+	GENERATED_BODY()
+
+public:
+	virtual void AddFrontEndFilterExtensions(TSharedPtr<class FFrontendFilterCategory> DefaultCategory, TArray<TSharedRef<class FFrontendFilter>>& InOutFilterList) const override;
+};
@@ -5,6 +5,66 @@
 #include "CoreMinimal.h"
 #include "CommentTranslator.h"
 
+class UStringTable;
+class UDataTable;
+class UBlueprint;
+class FAssetTranslationJob;
+
+/**
+ * 可翻译文本单元 - 资产中的一处文本
+ * 批量翻译先收集所有资产的文本单元，去重后只翻译唯一的原文，再把结果写回每一处
+ */
+struct FTranslationTextUnit
+{
+	/** 所属资产 */
+	TWeakObjectPtr<UObject> Asset;
+
+	/** 当前文本（可能已包含译文） */
+	FString CurrentText;
+
+	/** 位置描述（用于日志），如 行名.字段名 */
+	FString Location;
+
+	/** 写回时修改的对象（为空表示所属资产本身），写回前为它保存撤销快照 */
+	TWeakObjectPtr<UObject> Target;
+
+	/** 写回文本：NewText 为新文本，OriginalText 为需要额外保存的原文（还原时为空） */
+	TFunction<void(const FString& NewText, const FString& OriginalText)> Apply;
+};
+
+/**
+ * 批量翻译统计
+ */
+struct FTranslationBatchStats
+{
+	/** 处理的资产数量 */
+	int32 AssetCount = 0;
+
+	/** 收集到的需要翻译的文本单元数量 */
+	int32 TranslatableUnits = 0;
+
+	/** 去重后实际需要翻译的原文数量 */
+	int32 UniqueUnits = 0;
+
+	/** 直接还原的文本单元数量（编辑器内切换） */
+	int32 RestoredUnits = 0;
+
+	/** 已写回译文的文本单元数量 */
+	int32 AppliedUnits = 0;
+
+	/** 翻译失败的文本单元数量 */
+	int32 FailedUnits = 0;
+
+	/** 游戏线程写回结果的耗时（秒） */
+	double ApplySeconds = 0.0;
+
+	/** 去重率：省掉的请求占比 */
+	float GetDedupeRatio() const
+	{
+		return TranslatableUnits > 0 ? 1.0f - (float)UniqueUnits / (float)TranslatableUnits : 0.0f;
+	}
+};
+
 /**
  * 资产翻译器类 - 支持翻译各种 UE 资产中的文本内容
  * 
@@ -39,43 +99,34 @@ public:
 	/** 获取资产可翻译文本数量 */
 	static int32 GetTranslatableTextCount(const FAssetData& AssetData);
 	
-	/** 执行翻译逻辑（公开给工具窗口使用） */
-	static void PerformTranslation(const TArray<FAssetData>& TranslatableAssets, bool bSilent = false);
+	/** 执行翻译逻辑（公开给工具窗口和命令行使用），返回启动的任务 */
+	static TSharedRef<FAssetTranslationJob> PerformTranslation(const TArray<FAssetData>& TranslatableAssets, bool bSilent = false);
 	
-	/** 执行还原逻辑（公开给工具窗口使用） */
-	static void PerformRestore(const TArray<FAssetData>& TranslatableAssets);
+	/** 执行还原逻辑（公开给工具窗口使用），返回启动的任务 */
+	static TSharedRef<FAssetTranslationJob> PerformRestore(const TArray<FAssetData>& TranslatableAssets);
+
+	/** 执行清除原文逻辑（不弹确认对话框，公开给自动化测试使用），返回启动的任务 */
+	static TSharedRef<FAssetTranslationJob> PerformClearOriginal(const TArray<FAssetData>& TranslatableAssets);
+
+	/** 执行切换显示模式逻辑（公开给自动化测试使用），返回启动的任务 */
+	static TSharedRef<FAssetTranslationJob> PerformToggleDisplayMode(const TArray<FAssetData>& TranslatableAssets);
+
+	/** 收集资产中的所有文本单元 */
+	static void ExtractTextUnits(UObject* Asset, const FAssetData& AssetData, TArray<FTranslationTextUnit>& OutUnits);
 
 private:
-	/** String Table 翻译 */
-	static void TranslateStringTable(UObject* Asset, bool bSilent = false);
-	
-	/** String Table 翻译（支持选择特定条目） */
-	static void TranslateStringTableEntries(UObject* Asset, const TArray<FString>& SelectedKeys, bool bSilent = false);
-	
-	/** Data Table 翻译 */
-	static void TranslateDataTable(UObject* Asset, bool bSilent = false);
-	
-	/** Widget Blueprint 翻译 */
-	static void TranslateWidgetBlueprint(UObject* Asset, bool bSilent = false);
+	/** 收集 String Table 条目 */
+	static void ExtractStringTableUnits(UStringTable* StringTable, TArray<FTranslationTextUnit>& OutUnits);
 	
-	/** Blueprint 翻译 (变量描述、注释等) */
-	static void TranslateBlueprint(UObject* Asset, bool bSilent = false);
+	/** 收集 Data Table 中的文本字段 */
+	static void ExtractDataTableUnits(UDataTable* DataTable, TArray<FTranslationTextUnit>& OutUnits);
 	
-	/** 通用资产元数据翻译 (描述、工具提示等) */
-	static void TranslateAssetMetadata(UObject* Asset, bool bSilent = false);
-	
-	/** 执行清除原文逻辑 */
-	static void PerformClearOriginal(const TArray<FAssetData>& TranslatableAssets);
-	
-	/** 执行切换显示模式逻辑 */
-	static void PerformToggleDisplayMode(const TArray<FAssetData>& TranslatableAssets);
-
-	/** 辅助函数: 翻译单个文本并应用格式 */
-	static void TranslateSingleText(const FString& SourceText, TFunction<void(const FString&)> OnSuccess, TFunction<void()> OnError);
+	/** 收集 Widget Blueprint 中控件的文本属性 */
+	static void ExtractWidgetBlueprintUnits(UBlueprint* Blueprint, TArray<FTranslationTextUnit>& OutUnits);
 	
-	/** 显示翻译进度通知 */
-	static void ShowTranslationProgress(int32 Current, int32 Total, const FString& AssetName);
+	/** 收集 Blueprint 中的变量描述、注释等 */
+	static void ExtractBlueprintUnits(UBlueprint* Blueprint, TArray<FTranslationTextUnit>& OutUnits);
 	
-	/** 显示翻译完成通知 */
-	static void ShowTranslationComplete(int32 SuccessCount, int32 TotalCount);
+	/** 资产的所有文本单元写回完成后调用（刷新编辑器、标记修改） */
+	static void FinalizeAsset(UObject* Asset);
 };
@@ -54,6 +54,9 @@ private:
 	/** 获取状态文本 */
 	FText GetStatusText() const;
 	
+	/** 获取请求队列文本（排队数量、等待时间） */
+	FText GetQueueText() const;
+	
 	/** 获取进度条颜色 */
 	FSlateColor GetProgressColor() const;
 	
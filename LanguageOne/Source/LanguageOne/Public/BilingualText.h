@@ -0,0 +1,89 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * 双语文本布局
+ */
+enum class EBilingualLayout : uint8
+{
+	/** 没有翻译标记 */
+	None,
+
+	/** 新格式，译文在下方（默认）：标记开始原文标记结束\n---\n译文 */
+	TranslationBelow,
+
+	/** 新格式，译文在上方：译文\n---\n标记开始原文标记结束 */
+	TranslationAbove,
+
+	/** 有隐藏标记但没有分隔符：标记开始原文标记结束译文 或 译文标记开始原文标记结束 */
+	MarkersOnly,
+
+	/** 旧格式，只有分隔符：原文\n---\n译文 或 译文\n---\n原文 */
+	Legacy
+};
+
+/**
+ * 双语文本解析结果 - 原文和译文都是输入文本上的视图，不分配内存
+ *
+ * 视图只在输入文本有效且未修改期间有效
+ */
+struct FBilingualTextView
+{
+	/** 原文（没有翻译标记时为整个输入文本） */
+	FStringView Original;
+
+	/** 译文（没有翻译标记时为整个输入文本） */
+	FStringView Translation;
+
+	EBilingualLayout Layout = EBilingualLayout::None;
+
+	/** 有可见分隔符，或隐藏标记按顺序成对出现 */
+	bool bHasTranslation = false;
+
+	/** 有可见分隔符（正在显示双语） */
+	bool bIsBilingual = false;
+};
+
+/**
+ * 双语文本编解码 - 插件写入资产和节点注释的双语格式
+ *
+ * - 原文包在零宽字符标记中：U+200B U+200C 开始，U+200B U+200D 结束
+ * - 原文和译文之间用可见分隔符 "\n---\n" 隔开
+ * - 解析只扫描一遍文本，同时定位开始标记、结束标记和分隔符
+ * - 兼容没有隐藏标记的旧格式，按 bTranslationAboveOriginal 设置判断哪边是原文
+ */
+class LANGUAGEONE_API FBilingualText
+{
+public:
+	/** 隐藏标记和分隔符 */
+	static constexpr TCHAR HiddenStart[] = { 0x200B, 0x200C, 0 }; // ZWSP + ZWNJ
+	static constexpr TCHAR HiddenEnd[] = { 0x200B, 0x200D, 0 };   // ZWSP + ZWJ
+	static constexpr TCHAR Separator[] = TEXT("\n---\n");
+
+	/** 解析文本；bLegacyTranslationAbove 指定旧格式（没有隐藏标记）中译文是否在分隔符上方 */
+	static FBilingualTextView Parse(FStringView Text, bool bLegacyTranslationAbove);
+
+	/** 按当前设置解析文本 */
+	static FBilingualTextView Parse(FStringView Text);
+
+	/** 生成双语文本（一次分配） */
+	static FString Format(FStringView TranslatedText, FStringView OriginalText, bool bTranslationAbove);
+
+	/** 按当前设置生成双语文本 */
+	static FString Format(FStringView TranslatedText, FStringView OriginalText);
+
+	/** 提取原文（没有翻译标记时返回原文本） */
+	static FString GetOriginal(const FString& Text);
+
+	/** 提取译文（没有翻译标记时返回原文本） */
+	static FString GetTranslation(const FString& Text);
+
+	/** 文本是否已经包含翻译 */
+	static bool HasTranslation(FStringView Text);
+
+	/** 文本是否处于双语模式（有可见分隔符） */
+	static bool IsBilingual(FStringView Text);
+};
@@ -6,9 +6,11 @@
 #include "HttpModule.h"
 #include "Interfaces/IHttpRequest.h"
 #include "Interfaces/IHttpResponse.h"
+#include "LanguageOneSettings.h"
 
 DECLARE_DELEGATE_OneParam(FOnTranslationComplete, const FString&);
 DECLARE_DELEGATE_OneParam(FOnTranslationError, const FString&);
+DECLARE_DELEGATE_OneParam(FOnBatchTranslationComplete, const TArray<FString>&);
 
 /**
  * 注释翻译器类
@@ -16,10 +18,42 @@ DECLARE_DELEGATE_OneParam(FOnTranslationError, const FString&);
 class LANGUAGEONE_API FCommentTranslator
 {
 public:
-	/** 翻译文本 */
+	/**
+	 * 翻译文本
+	 * 在交互优先级下（Alt+E）按设置使用对冲请求和截止时间，见 TranslateHedged
+	 * 相同的原文（规范化后）、服务和目标语言已有翻译进行中时不再发送请求，所有调用方收到同一个结果或同一个错误
+	 */
 	static void TranslateText(const FString& SourceText, FOnTranslationComplete OnComplete, FOnTranslationError OnError);
 
+	/**
+	 * 批量翻译文本
+	 * 支持批量的服务（微软、Google API、百度、开启批量的自定义 API）把多条文本合并到同一个请求，其余服务逐条翻译
+	 * 结果按索引与 SourceTexts 对应，翻译失败的条目为空字符串；全部失败时调用 OnError
+	 */
+	static void TranslateTexts(const TArray<FString>& SourceTexts, FOnBatchTranslationComplete OnComplete, FOnTranslationError OnError);
+
+	/** 单个请求最多包含的文本数量（不支持批量的服务返回 1） */
+	static int32 GetMaxBatchSize(ETranslateProvider Provider);
+
+	/** 应用服务地址覆盖：设置了覆盖地址时把 DefaultUrl 的协议和主机替换为覆盖地址，路径和参数不变 */
+	static FString ResolveProviderUrl(ETranslateProvider Provider, const FString& DefaultUrl);
+
 private:
+	/** 自适应路由排序的服务（启用时）+ 首选服务 + 备用服务列表 */
+	static TArray<ETranslateProvider> GetProviderChain();
+
+	/** 依次尝试 Chain[ChainIndex] 及之后的服务，直到成功或全部失败 */
+	static void TranslateWithFailover(const TArray<ETranslateProvider>& Chain, int32 ChainIndex, const FString& SourceText, FOnTranslationComplete OnComplete, FOnTranslationError OnError);
+
+	/**
+	 * 交互翻译：首选服务超过延迟分位数仍未返回时，把同一文本发给路由顺序中的下一个服务，先返回的结果生效，另一个请求被取消
+	 * 超过截止时间仍没有结果时取消所有请求并返回超时错误
+	 */
+	static void TranslateHedged(const TArray<ETranslateProvider>& Chain, const FString& SourceText, FOnTranslationComplete OnComplete, FOnTranslationError OnError);
+
+	/** 使用指定服务翻译单条文本 */
+	static void TranslateWithProvider(ETranslateProvider Provider, const FString& SourceText, const FString& TargetLang, FOnTranslationComplete OnComplete, FOnTranslationError OnError);
+
 	/** 使用 Google 翻译免费接口 */
 	static void TranslateWithGoogleFree(const FString& SourceText, const FString& TargetLang, FOnTranslationComplete OnComplete, FOnTranslationError OnError);
 	
@@ -38,8 +72,29 @@ private:
 	/** 使用自定义翻译 API */
 	static void TranslateWithCustom(const FString& SourceText, const FString& TargetLang, FOnTranslationComplete OnComplete, FOnTranslationError OnError);
 	
-	/** 获取语言代码 */
-	static FString GetLanguageCode(bool bIsBaidu = true);
+	/** 微软翻译批量请求（JSON 数组） */
+	static void TranslateBatchWithMicrosoftFree(const TArray<FString>& SourceTexts, const FString& TargetLang, FOnBatchTranslationComplete OnComplete, FOnTranslationError OnError);
+	
+	/** 使用已获取的 Token 发送微软翻译请求；bRetryOnUnauthorized 为 true 时遇到 401 刷新 Token 重试一次 */
+	static void SendMicrosoftTranslateRequest(const TArray<FString>& SourceTexts, const FString& TargetLang, const FString& Token, bool bRetryOnUnauthorized, FOnBatchTranslationComplete OnComplete, FOnTranslationError OnError);
+	
+	/** 百度翻译批量请求（换行拼接） */
+	static void TranslateBatchWithBaidu(const TArray<FString>& SourceTexts, const FString& TargetLang, FOnBatchTranslationComplete OnComplete, FOnTranslationError OnError);
+	
+	/** Google 翻译 API 批量请求（重复的 q 参数） */
+	static void TranslateBatchWithGoogle(const TArray<FString>& SourceTexts, const FString& TargetLang, FOnBatchTranslationComplete OnComplete, FOnTranslationError OnError);
+	
+	/** 自定义 API 批量请求（texts 数组） */
+	static void TranslateBatchWithCustom(const TArray<FString>& SourceTexts, const FString& TargetLang, FOnBatchTranslationComplete OnComplete, FOnTranslationError OnError);
+	
+	/** 获取服务的批量限制：每个请求的最大文本数量和总字符数 */
+	static void GetBatchLimits(ETranslateProvider Provider, int32& OutMaxTexts, int32& OutMaxChars);
+	
+	/** 按服务限制把文本分组，输出每组的文本索引 */
+	static void SplitIntoBatches(ETranslateProvider Provider, const TArray<FString>& SourceTexts, TArray<TArray<int32>>& OutBatches);
+	
+	/** 获取翻译服务对应的目标语言代码 */
+	static FString GetLanguageCode(ETranslateProvider Provider);
 	
 	/** 生成 MD5 签名（用于百度翻译） */
 	static FString GenerateMD5(const FString& Text);
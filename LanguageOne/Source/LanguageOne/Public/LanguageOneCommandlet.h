@@ -0,0 +1,47 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commandlets/Commandlet.h"
+#include "LanguageOneCommandlet.generated.h"
+
+/**
+ * 资产翻译命令行 - 不打开编辑器界面，在构建机上运行与资产翻译工具相同的流程
+ *
+ * UnrealEditor-Cmd <Project>.uproject -run=LanguageOne [参数]
+ *
+ * - -paths=/Game/UI,/Game/Data     要翻译的目录（递归，默认 /Game）
+ * - -classes=StringTable,DataTable  只处理类名包含这些关键字的资产（默认所有支持的资产）
+ * - -provider=Google                翻译服务（ETranslateProvider 名称，默认取设置）
+ * - -target=Chinese                 目标语言（ETranslateTargetLanguage 名称，默认取设置）
+ * - -concurrency=8                  最大并发请求数（默认取设置）
+ * - -timeout=3600                   超时秒数，超时后取消任务（默认不限制）
+ * - -dryrun                         只收集文本并统计，不发送请求、不修改资产
+ * - -save                           保存修改过的包；不加时不保存（也不使用会保存的低内存批处理模式）
+ *
+ * 参数只覆盖本次运行，不写入配置文件。有资产或文本失败、任务被取消时返回非零退出码
+ */
+UCLASS()
+class ULanguageOneCommandlet : public UCommandlet
+{
+	GENERATED_BODY()
+
+public:
+	ULanguageOneCommandlet();
+
+	virtual int32 Main(const FString& Params) override;
+
+private:
+	/** 按参数从资产注册表收集要处理的资产（不加载） */
+	static TArray<FAssetData> GatherAssets(const TMap<FString, FString>& ParamVals);
+
+	/** 用参数覆盖本次运行的设置；参数无效时返回 false */
+	static bool ApplySettingOverrides(const TMap<FString, FString>& ParamVals, bool bSave);
+
+	/** 只收集文本单元并统计，返回退出码 */
+	static int32 RunDryRun(const TArray<FAssetData>& Assets);
+
+	/** 运行翻译任务直到结束，返回退出码 */
+	static int32 RunTranslation(const TArray<FAssetData>& Assets, bool bSave, double TimeoutSeconds);
+};
@@ -210,4 +210,28 @@ namespace LanguageOneBlueprintMetadataHelper
 	{
 		Metadata.SetMetaData(Key, Value);
 	}
-}
\ No newline at end of file
+}
+// ========== FProperty 兼容 ==========
+#include "UObject/UnrealType.h"
+
+namespace LanguageOnePropertyHelper
+{
+	// UE 5.5+ 使用 GetElementSize() / GetArrayDim()，旧版本直接访问成员
+	inline int32 GetElementSize(const FProperty* Property)
+	{
+#if (ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION >= 5)
+		return Property->GetElementSize();
+#else
+		return Property->ElementSize;
+#endif
+	}
+
+	inline int32 GetArrayDim(const FProperty* Property)
+	{
+#if (ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION >= 5)
+		return Property->GetArrayDim();
+#else
+		return Property->ArrayDim;
+#endif
+	}
+}
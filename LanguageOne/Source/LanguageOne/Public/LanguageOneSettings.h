@@ -95,6 +95,10 @@ public:
 	UPROPERTY(Config, EditAnywhere, Category = "翻译设置 | Translation Settings", meta = (DisplayName = "API 密钥 | API Key", EditCondition = "TranslateProvider == ETranslateProvider::Custom", PasswordField = true))
 	FString CustomApiKey;
 
+	/** 自定义 API 是否支持批量请求 */
+	UPROPERTY(Config, EditAnywhere, Category = "翻译设置 | Translation Settings", meta = (DisplayName = "批量请求 | Batch Requests", EditCondition = "TranslateProvider == ETranslateProvider::Custom", Tooltip = "接口支持 texts 数组批量格式时勾选（见文档），多条文本合并为一个请求 | Check if the API accepts the texts array batch schema (see docs), so many texts share one request"))
+	bool bCustomApiSupportsBatch;
+
 	/** 翻译目标语言 */
 	UPROPERTY(Config, EditAnywhere, Category = "翻译设置 | Translation Settings", meta = (DisplayName = "翻译成 | Translate To"))
 	ETranslateTargetLanguage TargetLanguage;
@@ -108,6 +112,104 @@ public:
 	UPROPERTY(Config, EditAnywhere, Category = "翻译设置 | Translation Settings", meta = (DisplayName = "翻译前确认 | Confirm Before Translation", Tooltip = "批量翻译资产前显示确认对话框 | Show confirmation dialog before batch translation"))
 	bool bConfirmBeforeAssetTranslation;
 
+	/** 启用翻译记忆库 */
+	UPROPERTY(Config, EditAnywhere, Category = "翻译设置 | Translation Settings", meta = (DisplayName = "翻译记忆库 | Translation Memory", Tooltip = "缓存已翻译的文本（保存在 Saved/LanguageOne），相同原文不再重复请求 | Cache translated text under Saved/LanguageOne so identical sources are never requested twice"))
+	bool bEnableTranslationMemory;
+
+	// ========== 请求调度设置 ==========
+	/** 同时进行的翻译请求上限 */
+	UPROPERTY(Config, EditAnywhere, Category = "请求调度 | Request Scheduling", meta = (DisplayName = "最大并发请求 | Max Concurrent Requests", ClampMin = "1", ClampMax = "64", Tooltip = "同时进行的翻译请求数量上限，其余请求排队等待 | Maximum translation requests in flight; the rest wait in a queue"))
+	int32 MaxConcurrentRequests;
+
+	/** 为交互翻译保留的并发名额 */
+	UPROPERTY(Config, EditAnywhere, Category = "请求调度 | Request Scheduling", meta = (DisplayName = "交互保留名额 | Interactive Reserved Requests", ClampMin = "0", ClampMax = "63", Tooltip = "批量资产翻译不会占用的并发名额，Alt+E 等交互翻译总是先于排队的批量请求发送 | Concurrency slots bulk asset jobs never use; interactive translations (Alt+E) are always sent ahead of queued bulk requests"))
+	int32 InteractiveReservedRequests;
+
+	/** 交互翻译使用对冲请求 */
+	UPROPERTY(Config, EditAnywhere, Category = "请求调度 | Request Scheduling", meta = (DisplayName = "对冲请求 | Hedged Requests", Tooltip = "Alt+E 翻译时，首选服务超过延迟分位数仍未返回，就把同一文本发给下一个服务，先返回的结果生效，另一个请求被取消 | For Alt+E, when the first service has not answered within the latency percentile, send the same text to the next service, use whichever answers first and cancel the other"))
+	bool bHedgeInteractiveRequests;
+
+	/** 对冲延迟使用的耗时分位数 */
+	UPROPERTY(Config, EditAnywhere, Category = "请求调度 | Request Scheduling", meta = (DisplayName = "对冲分位数 | Hedge Percentile", EditCondition = "bHedgeInteractiveRequests", ClampMin = "50.0", ClampMax = "99.9", Tooltip = "首选服务最近成功请求耗时的该分位数作为对冲延迟（95 表示约 5% 的请求会被对冲） | Hedge once the first service exceeds this percentile of its recent successful latencies (95 hedges about 5% of requests)"))
+	float HedgeLatencyPercentile;
+
+	/** 样本不足时的对冲延迟（秒） */
+	UPROPERTY(Config, EditAnywhere, Category = "请求调度 | Request Scheduling", meta = (DisplayName = "默认对冲延迟(秒) | Default Hedge Delay (s)", EditCondition = "bHedgeInteractiveRequests", ClampMin = "0.1", ClampMax = "30.0", Tooltip = "首选服务的耗时样本不足以计算分位数时使用的对冲延迟 | Hedge delay used until the first service has enough latency samples for the percentile"))
+	float HedgeFallbackDelaySeconds;
+
+	/** 交互翻译的截止时间（秒） */
+	UPROPERTY(Config, EditAnywhere, Category = "请求调度 | Request Scheduling", meta = (DisplayName = "交互截止时间(秒) | Interactive Deadline (s)", ClampMin = "0.0", ClampMax = "300.0", Tooltip = "Alt+E 翻译超过该时间仍没有结果时取消请求并提示超时；0 表示不限制 | Cancel an Alt+E translation and report a timeout when no result arrives within this time; 0 disables the deadline"))
+	float InteractiveDeadlineSeconds;
+
+	/** 每个翻译服务的请求速率 */
+	UPROPERTY(Config, EditAnywhere, Category = "请求调度 | Request Scheduling", meta = (DisplayName = "每秒请求数 | Requests Per Second", Tooltip = "每个翻译服务每秒最多发送的请求数（令牌桶），服务返回 Retry-After 时自动暂停 | Token-bucket rate per translation service; sending pauses automatically when the service returns Retry-After"))
+	TMap<ETranslateProvider, float> ProviderRequestsPerSecond;
+
+	/** 可重试失败的最大重试次数 */
+	UPROPERTY(Config, EditAnywhere, Category = "请求调度 | Request Scheduling", meta = (DisplayName = "最大重试次数 | Max Retries", ClampMin = "0", ClampMax = "10", Tooltip = "超时、429、5xx 等临时错误的重试次数，按指数退避（带随机抖动）等待 | Retries for transient errors (timeouts, 429, 5xx) with jittered exponential backoff"))
+	int32 MaxRetryAttempts;
+
+	/** 重试退避的基础等待时间 */
+	UPROPERTY(Config, EditAnywhere, Category = "请求调度 | Request Scheduling", meta = (DisplayName = "重试基础间隔(秒) | Retry Base Delay (s)", ClampMin = "0.1", ClampMax = "10.0", Tooltip = "第 N 次重试约等待 基础间隔 × 2^N 秒 | Retry N waits about base delay × 2^N seconds"))
+	float RetryBaseDelaySeconds;
+
+	/** 备用翻译服务 */
+	UPROPERTY(Config, EditAnywhere, Category = "请求调度 | Request Scheduling", meta = (DisplayName = "备用翻译服务 | Failover Providers", Tooltip = "首选服务重试后仍失败时，按顺序尝试这些服务。留空时：首选免费服务会在免费服务之间切换；首选付费或自定义服务不切换，文本不会发送到未选择的公共服务 | Tried in order when the selected service still fails after retries. When empty, a free selection fails over among the free services, while a paid or custom selection never fails over, so text never reaches a public service you did not choose"))
+	TArray<ETranslateProvider> FailoverProviders;
+
+	/** 翻译服务地址覆盖：替换服务默认地址的协议和主机部分（用于本地模拟服务器、代理或私有部署） */
+	UPROPERTY(Config, EditAnywhere, AdvancedDisplay, Category = "请求调度 | Request Scheduling", meta = (DisplayName = "服务地址覆盖 | Provider Base URL Overrides", Tooltip = "为翻译服务指定新的基础地址（如 http://127.0.0.1:18080），请求路径和参数不变；微软翻译的授权请求也使用该地址。留空使用官方地址 | Replace a provider's scheme and host (e.g. http://127.0.0.1:18080) while keeping request paths and parameters; Microsoft auth requests use it too. Leave empty for the official endpoints"))
+	TMap<ETranslateProvider, FString> ProviderBaseUrlOverrides;
+
+	/** 自适应路由：按各服务最近的耗时和失败率选择服务 */
+	UPROPERTY(Config, EditAnywhere, Category = "请求调度 | Request Scheduling", meta = (DisplayName = "自适应路由 | Adaptive Routing", Tooltip = "记录每个服务的平均耗时和失败率（保存在 Saved/LanguageOne/ProviderStats.json），每次翻译或每批请求发送到预计最快的路由服务；首选服务和备用服务仍作为后备 | Track each service's moving-average latency and error rate (saved to Saved/LanguageOne/ProviderStats.json) and send each translation or batch to the routing service expected to be fastest; the selected and failover services remain as fallbacks"))
+	bool bAdaptiveRouting;
+
+	/** 参与自适应路由的服务 */
+	UPROPERTY(Config, EditAnywhere, Category = "请求调度 | Request Scheduling", meta = (DisplayName = "路由服务 | Routing Providers", EditCondition = "bAdaptiveRouting", Tooltip = "可以选择的服务；付费服务（百度、Google API、自定义 API）只在免费服务都达不到 SLO 时使用，且需要已配置密钥 | Services routing may choose from; paid services (Baidu, Google API, Custom API) are only used when every free service misses the SLO, and must have keys configured"))
+	TArray<ETranslateProvider> RoutingProviders;
+
+	/** 路由 SLO：平均耗时上限（秒） */
+	UPROPERTY(Config, EditAnywhere, Category = "请求调度 | Request Scheduling", meta = (DisplayName = "SLO 耗时(秒) | SLO Latency (s)", EditCondition = "bAdaptiveRouting", ClampMin = "0.1", ClampMax = "60.0", Tooltip = "免费服务平均请求耗时超过该值视为未达标 | A free service whose average request latency exceeds this misses the SLO"))
+	float RoutingLatencySloSeconds;
+
+	/** 路由 SLO：失败率上限 */
+	UPROPERTY(Config, EditAnywhere, Category = "请求调度 | Request Scheduling", meta = (DisplayName = "SLO 失败率 | SLO Error Rate", EditCondition = "bAdaptiveRouting", ClampMin = "0.0", ClampMax = "1.0", Tooltip = "免费服务平均失败率（0-1）超过该值视为未达标 | A free service whose average error rate (0-1) exceeds this misses the SLO"))
+	float RoutingMaxErrorRate;
+
+	// ========== 资产处理设置 ==========
+	/** 批量操作时同时异步加载的资产数量 */
+	UPROPERTY(Config, EditAnywhere, Category = "资产处理 | Asset Processing", meta = (DisplayName = "预加载资产数 | Load Look-Ahead", ClampMin = "1", ClampMax = "256", Tooltip = "批量操作时同时异步加载的资产数量，已加载的资产立即开始处理，加载与翻译请求并行进行 | Assets streamed in ahead of processing during batch operations; each asset is processed as soon as it is resident, overlapping loading with translation requests"))
+	int32 AssetLoadLookAhead;
+
+	/** 每帧写回翻译结果的时间预算（毫秒） */
+	UPROPERTY(Config, EditAnywhere, Category = "资产处理 | Asset Processing", meta = (DisplayName = "每帧写回预算(ms) | Apply Budget Per Frame (ms)", ClampMin = "0.5", ClampMax = "100.0", Tooltip = "翻译响应在后台线程解析，结果在游戏线程按帧写回；每帧写回超过该时间后剩余结果留到下一帧，大批量翻译时编辑器保持流畅 | Responses are parsed on background threads and results are applied on the game thread frame by frame; once a frame spends this long applying, the rest waits for the next frame so the editor stays responsive during large batches"))
+	float ResultApplyBudgetMs;
+
+	/** 低内存批处理：按窗口处理资产，每个窗口完成后保存、卸载并回收内存 */
+	UPROPERTY(Config, EditAnywhere, Category = "资产处理 | Asset Processing", meta = (DisplayName = "低内存批处理 | Bounded-Memory Batch", Tooltip = "按窗口处理资产：每个窗口写回后自动保存修改的资产，卸载本次加载的包并执行垃圾回收，适合一次处理整个项目（会自动保存资产） | Process assets in windows: after each window is applied, modified assets are saved automatically, packages loaded by the run are unloaded and garbage is collected, so whole projects fit in one session (saves assets automatically)"))
+	bool bBoundedMemoryBatch;
+
+	/** 每个窗口的资产数量 */
+	UPROPERTY(Config, EditAnywhere, Category = "资产处理 | Asset Processing", meta = (DisplayName = "窗口资产数 | Window Size", EditCondition = "bBoundedMemoryBatch", ClampMin = "1", ClampMax = "10000", Tooltip = "每个窗口最多处理的资产数量 | Maximum assets processed per window"))
+	int32 BatchWindowSize;
+
+	/** 内存上限（MB） */
+	UPROPERTY(Config, EditAnywhere, Category = "资产处理 | Asset Processing", meta = (DisplayName = "内存上限(MB) | Memory Ceiling (MB)", EditCondition = "bBoundedMemoryBatch", ClampMin = "0", Tooltip = "编辑器已用物理内存超过上限时提前结束当前窗口并回收内存；0 表示不限制 | End the current window early and reclaim memory when the editor's used physical memory exceeds this; 0 disables the ceiling"))
+	int32 BatchMemoryCeilingMB;
+
+	/** 记录撤销：每个资产写回前在一个撤销事务中保存一次快照 */
+	UPROPERTY(Config, EditAnywhere, Category = "资产处理 | Asset Processing", meta = (DisplayName = "记录撤销 | Record Undo", Tooltip = "每个资产只记录一个撤销事务（每个对象一次快照），可以用 Ctrl+Z 撤销整个资产的翻译；无人值守批量运行时可以关闭以节省内存。低内存批处理和命令行运行时不记录 | Record one undo transaction per asset (one snapshot per object) so a whole asset's translation can be undone with Ctrl+Z; turn off for unattended batch runs to save memory. Never recorded in bounded-memory batches or commandlet runs"))
+	bool bRecordUndoTransactions;
+
+	/** 断点续传：批量翻译进度记录到 Saved/LanguageOne/Jobs/，中断后再次翻译同一批资产时从中断处继续 */
+	UPROPERTY(Config, EditAnywhere, Category = "资产处理 | Asset Processing", meta = (DisplayName = "断点续传 | Resume Interrupted Jobs", Tooltip = "把批量翻译已完成的译文和已写回的资产记录到 Saved/LanguageOne/Jobs/；编辑器崩溃或关闭后再次翻译同一批资产时，已完成的译文不再请求，已保存的资产直接跳过 | Journal completed translations and applied assets to Saved/LanguageOne/Jobs/; when the same assets are translated again after a crash or close, finished translations are not requested again and saved assets are skipped"))
+	bool bResumeInterruptedJobs;
+
+	/** 任务报告：每次资产操作结束时把吞吐量、请求和延迟统计写入 Saved/LanguageOne/Reports/ */
+	UPROPERTY(Config, EditAnywhere, Category = "资产处理 | Asset Processing", meta = (DisplayName = "写入任务报告 | Write Run Reports", Tooltip = "每次翻译、还原、清除原文或切换显示模式结束时，把资产和文本数量、缓存命中、每个服务的请求数、字符数、延迟分位数、重试和失败原因以及写回耗时写入 Saved/LanguageOne/Reports/ 下的 JSON 文件 | At the end of every translate, restore, clear or toggle operation, write asset and text counts, cache hits, per-provider requests, characters, latency percentiles, retries, failure reasons and apply time to a JSON file under Saved/LanguageOne/Reports/"))
+	bool bWriteRunReports;
+
 	/** 显示详细翻译日志 */
 	UPROPERTY(Config, EditAnywhere, Category = "翻译设置 | Translation Settings", meta = (DisplayName = "详细日志 | Verbose Logging", Tooltip = "在输出日志显示详细的翻译信息 | Show detailed translation info in output log"))
 	bool bVerboseAssetTranslationLog;
@@ -0,0 +1,77 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Trace/Trace.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
+#include "LanguageOneSettings.h"
+
+/** Unreal Insights 中的 LanguageOne 通道（-trace=cpu,LanguageOne 或在 Insights 中开启） */
+UE_TRACE_CHANNEL_EXTERN(LanguageOneChannel, LANGUAGEONE_API)
+
+/** CPU 事件作用域，只在 LanguageOne 通道开启时记录 */
+#define LANGUAGEONE_TRACE_SCOPE(Name) TRACE_CPUPROFILER_EVENT_SCOPE_ON_CHANNEL_STR(Name, LanguageOneChannel)
+
+/**
+ * 翻译请求的时间点
+ */
+enum class ELanguageOneRequestPhase : uint8
+{
+	/** 进入调度器队列（重试时再次排队） */
+	Queued,
+
+	/** 调度器发出请求 */
+	Sent,
+
+	/** 收到第一个响应字节 */
+	FirstByte,
+
+	/** 请求完成（成功或失败） */
+	Completed
+};
+
+/**
+ * 翻译流水线的 Insights 追踪
+ *
+ * - LanguageOne.UnitBatch 事件：任务（请求组）发送的一批文本单元（去重后的原文序号）及其批次编号
+ * - LanguageOne.RequestTiming 事件：每个 HTTP 请求的排队、发送、首字节、完成时间点，带请求编号、任务编号、批次编号和服务
+ * - 请求从发送到完成同时记录为 Timing Region，在 Insights 的时间线上直接可见（UE 5.2+）
+ * - 批次编号通过 FScopedBatch 传给作用域内发出的请求，调度器在完成回调中恢复（故障转移等后续请求沿用同一批次）
+ *
+ * 通道关闭时所有接口都立即返回；所有方法都在游戏线程调用
+ */
+class LANGUAGEONE_API FLanguageOneTrace
+{
+public:
+	/** LanguageOne 通道是否开启 */
+	static bool IsEnabled();
+
+	/** 记录任务发送的一批文本单元，返回批次编号（通道关闭时返回 0） */
+	static uint32 TraceUnitBatch(uint32 JobId, TConstArrayView<int32> UnitIds);
+
+	/** 分配请求编号（通道关闭时返回 0，之后该请求不记录） */
+	static uint32 AllocateRequestId();
+
+	/** 记录请求时间点；RequestId 为 0 时忽略 */
+	static void TraceRequestPhase(uint32 RequestId, uint32 JobId, uint32 BatchId, ETranslateProvider Provider, ELanguageOneRequestPhase Phase, int32 Attempt, int32 ResponseCode = 0);
+
+	/** 当前作用域的批次编号 */
+	static uint32 GetCurrentBatch() { return CurrentBatch; }
+
+	/** 批次作用域 - 作用域内排队的请求归入指定批次 */
+	struct FScopedBatch
+	{
+		explicit FScopedBatch(uint32 InBatch)
+			: BatchGuard(CurrentBatch, InBatch)
+		{}
+
+	private:
+		TGuardValue<uint32> BatchGuard;
+	};
+
+private:
+	static uint32 CurrentBatch;
+	static uint32 NextBatch;
+	static uint32 NextRequestId;
+};
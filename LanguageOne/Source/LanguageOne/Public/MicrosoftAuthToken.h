@@ -0,0 +1,54 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "CommentTranslator.h"
+
+DECLARE_DELEGATE_OneParam(FOnMicrosoftAuthTokenReady, const FString&);
+
+/**
+ * 微软 Edge 翻译授权 Token 管理器
+ *
+ * - 解析 Token（JWT）中的过期时间，在过期前一段时间内复用同一个 Token
+ * - 多个请求同时需要刷新时，只发送一个授权请求，其余请求等待同一结果
+ * - 翻译接口返回 401 时调用 Invalidate，下一次 RequestToken 会重新获取
+ *
+ * HTTP 回调都在游戏线程执行，因此不需要加锁
+ */
+class LANGUAGEONE_API FMicrosoftAuthTokenManager
+{
+public:
+	static FMicrosoftAuthTokenManager& Get();
+
+	/** 获取有效 Token：缓存有效时立即回调，否则发起（或加入正在进行的）刷新 */
+	void RequestToken(FOnMicrosoftAuthTokenReady OnReady, FOnTranslationError OnError);
+
+	/** 使指定 Token 失效（收到 401 时调用）；Token 已被刷新过时忽略 */
+	void Invalidate(const FString& RejectedToken);
+
+	/** 解析 JWT 中的 exp 字段（UTC） */
+	static bool DecodeTokenExpiry(const FString& Token, FDateTime& OutExpiryUtc);
+
+private:
+	FMicrosoftAuthTokenManager() = default;
+
+	/** 缓存的 Token 是否仍可使用 */
+	bool IsTokenValid() const;
+
+	/** 发送授权请求 */
+	void StartRefresh();
+
+	/** 授权请求完成，通知所有等待者 */
+	void FinishRefresh(const FString& NewToken, const FString& ErrorMessage);
+
+private:
+	FString CachedToken;
+	FDateTime ExpiryUtc;
+
+	/** 是否有授权请求正在进行 */
+	bool bRefreshInFlight = false;
+
+	/** 等待刷新结果的请求 */
+	TArray<TPair<FOnMicrosoftAuthTokenReady, FOnTranslationError>> Waiters;
+};
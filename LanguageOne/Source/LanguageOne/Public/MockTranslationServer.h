@@ -0,0 +1,158 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HttpRouteHandle.h"
+#include "LanguageOneSettings.h"
+
+class IHttpRouter;
+struct FHttpServerRequest;
+
+/**
+ * 模拟服务器延迟分布
+ */
+enum class EMockLatencyDistribution : uint8
+{
+	/** 固定为 LatencyMs */
+	Constant,
+
+	/** 在 [LatencyMs - LatencySpreadMs, LatencyMs + LatencySpreadMs] 内均匀分布 */
+	Uniform,
+
+	/** 对数正态分布：中位数为 LatencyMs，约 84% 的请求不超过 LatencyMs + LatencySpreadMs（长尾） */
+	LogNormal
+};
+
+/**
+ * 模拟服务器配置
+ */
+struct FMockTranslationServerConfig
+{
+	/** 监听端口（绑定地址由 HTTPServer 的 [HTTPServer.Listeners] 配置决定，仅用于本机测试） */
+	uint32 Port = 18080;
+
+	/** 响应延迟 */
+	EMockLatencyDistribution LatencyDistribution = EMockLatencyDistribution::Constant;
+	float LatencyMs = 50.0f;
+	float LatencySpreadMs = 0.0f;
+
+	/** 返回 500 错误的概率（0-1） */
+	float ErrorRate = 0.0f;
+
+	/** 返回 429 限流的概率（0-1），响应带 Retry-After */
+	float RateLimitRate = 0.0f;
+	int32 RetryAfterSeconds = 1;
+
+	/** 每个请求最多接受的文本数量，超过时按服务的格式返回错误；0 表示使用各服务的真实限制 */
+	int32 MaxBatchTexts = 0;
+
+	/** 随机种子，相同配置和请求顺序得到相同的结果 */
+	int32 Seed = 0;
+};
+
+/**
+ * 模拟服务器统计
+ */
+struct FMockTranslationServerStats
+{
+	/** 收到的请求数量（含授权请求） */
+	int32 Requests = 0;
+
+	/** 翻译的文本数量 */
+	int32 Texts = 0;
+
+	/** 注入的 500 错误 / 429 限流数量 */
+	int32 InjectedErrors = 0;
+	int32 InjectedRateLimits = 0;
+
+	/** 超过批量限制被拒绝的请求数量 */
+	int32 RejectedBatches = 0;
+
+	/** 按服务统计的请求数量 */
+	TMap<ETranslateProvider, int32> RequestsByProvider;
+};
+
+/**
+ * 本地模拟翻译服务器 - 在本机回环地址上按各翻译服务的真实请求/响应格式返回确定的译文，
+ * 用于没有外网时的吞吐测试和回归测试
+ *
+ * - 支持谷歌(Web版)、微软(含授权接口)、MyMemory、百度、Google API、自定义 API（单条和批量）
+ * - 译文为 "[目标语言] 原文"，同样的输入总是得到同样的输出
+ * - 可配置延迟分布、错误率、429 注入和批量限制
+ * - PointSettingsAtServer 把所有服务的地址覆盖指向本服务器（并填入占位密钥），Stop 时恢复
+ *
+ * 使用 HTTPServer 模块，请求在游戏线程处理；所有方法都在游戏线程调用
+ */
+class LANGUAGEONE_API FMockTranslationServer
+{
+public:
+	static FMockTranslationServer& Get();
+
+	/** 启动服务器；已经启动时先停止 */
+	bool Start(const FMockTranslationServerConfig& InConfig);
+
+	/** 停止服务器，恢复 PointSettingsAtServer 修改的设置 */
+	void Stop();
+
+	bool IsRunning() const { return Router.IsValid(); }
+
+	/** 服务器基础地址，如 http://127.0.0.1:18080 */
+	FString GetBaseUrl() const;
+
+	/** 让插件的所有翻译服务使用本服务器（只修改内存中的设置） */
+	void PointSettingsAtServer();
+
+	const FMockTranslationServerStats& GetStats() const { return Stats; }
+	void ResetStats() { Stats = FMockTranslationServerStats(); }
+
+	const FMockTranslationServerConfig& GetConfig() const { return Config; }
+
+	/** 生成确定的译文（测试据此检查写回的文本） */
+	static FString MakeTranslation(const FString& SourceText, const FString& TargetLang);
+
+private:
+	FMockTranslationServer() = default;
+
+	/** 一个待发送的响应 */
+	struct FMockResponse
+	{
+		int32 Code = 200;
+		FString Body;
+		FString ContentType = TEXT("application/json");
+
+		/** 429 响应的 Retry-After（秒） */
+		FString RetryAfter;
+	};
+
+	/** 处理一个翻译服务的请求：注入错误、检查批量限制、生成响应 */
+	using FTranslateFunc = TFunction<FMockResponse(const FHttpServerRequest& Request, int32& OutTextCount)>;
+	void BindProviderRoute(ETranslateProvider Provider, const FString& Path, bool bPost, FTranslateFunc TranslateFunc);
+
+	/** 按概率注入错误；注入时返回 true */
+	bool TryInjectFailure(FMockResponse& OutResponse);
+
+	/** 超过批量限制时返回 true（并计入统计） */
+	bool ExceedsBatchLimit(ETranslateProvider Provider, int32 TextCount);
+
+	/** 按延迟分布抽样（秒） */
+	float SampleLatencySeconds();
+
+	/** 生成带过期时间的 JWT 格式 Token（微软授权接口） */
+	static FString MakeAuthToken();
+
+private:
+	FMockTranslationServerConfig Config;
+	FMockTranslationServerStats Stats;
+	FRandomStream Random;
+
+	TSharedPtr<IHttpRouter> Router;
+	TArray<FHttpRouteHandle> RouteHandles;
+
+	/** PointSettingsAtServer 之前的设置，Stop 时恢复 */
+	TOptional<TMap<ETranslateProvider, FString>> SavedUrlOverrides;
+	FString SavedCustomApiUrl;
+	FString SavedBaiduAppId;
+	FString SavedBaiduSecretKey;
+	FString SavedGoogleApiKey;
+};
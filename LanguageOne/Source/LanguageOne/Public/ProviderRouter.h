@@ -0,0 +1,102 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/Ticker.h"
+#include "LanguageOneSettings.h"
+#include "TranslationRequestScheduler.h"
+
+/**
+ * 翻译服务的运行状况（指数移动平均）
+ */
+struct FProviderHealth
+{
+	/** 平均请求耗时（秒） */
+	double LatencySeconds = 0.0;
+
+	/** 平均失败率（0-1） */
+	double ErrorRate = 0.0;
+
+	/** 累计样本数 */
+	int64 Samples = 0;
+
+	/** 最近一次样本的时间（UTC） */
+	FDateTime LastSampleUtc;
+};
+
+/**
+ * 自适应服务路由 - 按各翻译服务最近的耗时和失败率选择服务
+ *
+ * - 调度器在每个请求完成时记录耗时和成败，按指数移动平均更新（每次尝试都计入，包括重试）
+ * - 交互请求选择预计最快拿到结果的服务（耗时 / 成功率），批量请求选择预计吞吐量最高的服务（成功率 × 每请求文本数 × 每秒请求数）
+ * - 付费服务（百度、Google API、自定义 API）只在所有免费服务都达不到 SLO（耗时或失败率超标）时使用，且必须已配置密钥或地址
+ * - 失败率随时间衰减，之前失败的服务过一段时间后会重新尝试；没有样本的服务按乐观估计参与排序
+ * - 统计保存在 Saved/LanguageOne/ProviderStats.json，下次启动时直接使用
+ * - 另外保留每个服务最近成功请求的耗时（只在内存中），用于计算对冲请求的延迟分位数
+ *
+ * 所有方法都在游戏线程调用
+ */
+class LANGUAGEONE_API FProviderRouter
+{
+public:
+	static FProviderRouter& Get();
+
+	/** 加载保存的统计并启动定时保存（模块启动时调用） */
+	void Initialize();
+
+	/** 保存统计并停止定时器（模块关闭时调用） */
+	void Shutdown();
+
+	/** 记录一次请求结果 */
+	void RecordResult(ETranslateProvider Provider, double LatencySeconds, bool bSucceeded);
+
+	/**
+	 * 按预计表现排列候选服务（设置中的路由服务列表）
+	 * 达到 SLO 的免费服务在前；没有免费服务达标时，已配置的付费服务排在免费服务之前
+	 */
+	TArray<ETranslateProvider> RankProviders(ETranslationRequestPriority Priority) const;
+
+	/** 指定服务的运行状况（失败率已按时间衰减） */
+	FProviderHealth GetHealth(ETranslateProvider Provider) const;
+
+	/** 最近成功请求耗时的分位数（Percentile 为 0-100）；样本不足时返回 false */
+	bool GetLatencyPercentile(ETranslateProvider Provider, double Percentile, double& OutSeconds) const;
+
+	/** 服务是否达到 SLO */
+	bool MeetsSlo(ETranslateProvider Provider) const;
+
+	/** 是否为付费服务 */
+	static bool IsPaidProvider(ETranslateProvider Provider);
+
+	/** 服务是否已配置（付费服务需要密钥或地址） */
+	static bool IsProviderConfigured(ETranslateProvider Provider);
+
+	/** 统计文件路径 */
+	static FString GetStatsFilePath();
+
+private:
+	FProviderRouter() = default;
+
+	/** 排序分数，越大越好 */
+	double GetScore(ETranslateProvider Provider, ETranslationRequestPriority Priority) const;
+
+	void Load();
+	void Save();
+
+	/** 定时保存回调 */
+	bool Tick(float DeltaTime);
+
+private:
+	TMap<ETranslateProvider, FProviderHealth> Health;
+
+	/** 最近成功请求的耗时（按时间顺序，最多保留 MaxRecentLatencies 个） */
+	TMap<ETranslateProvider, TArray<double>> RecentLatencies;
+
+	/** 上一次排在首位的服务，变化时输出日志 */
+	mutable TOptional<ETranslateProvider> LastPreferred;
+
+	FTSTicker::FDelegateHandle TickerHandle;
+	bool bDirty = false;
+	bool bInitialized = false;
+};
@@ -0,0 +1,59 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/Ticker.h"
+
+class UStringTable;
+
+/**
+ * String Table 写入队列 - 合并翻译结果的写入，每帧最多写入一次
+ *
+ * - 翻译结果先进入缓冲，下一帧统一写入：每个表只调用一次 Modify，批量写入所有条目，只刷新一次编辑器
+ * - 避免大表逐条写入时每条都 PostEditChange 和重建编辑器列表
+ * - 资产收尾时调用 Flush 立即写入，保证保存前所有结果都已写入
+ *
+ * 所有方法都在游戏线程调用
+ */
+class LANGUAGEONE_API FStringTableWriteQueue
+{
+public:
+	static FStringTableWriteQueue& Get();
+
+	/** 缓冲一条写入：条目文本设为 NewText，同时把 MetaDataValue 写入条目元数据 MetaDataId */
+	void Enqueue(UStringTable* StringTable, const FString& Key, const FString& NewText, const FName& MetaDataId, const FString& MetaDataValue);
+
+	/** 立即写入指定表的缓冲条目并刷新编辑器（没有缓冲条目时只刷新编辑器） */
+	void Flush(UStringTable* StringTable);
+
+	/** 立即写入所有缓冲条目 */
+	void FlushAll();
+
+	/** 写入剩余条目并停止定时器（模块关闭时调用） */
+	void Shutdown();
+
+	/** 安全地刷新 String Table 编辑器：不传入 Key，避免改变编辑器的选中项 */
+	static void RefreshStringTableEditor(UStringTable* StringTable);
+
+private:
+	struct FPendingEntry
+	{
+		FString Key;
+		FString Text;
+		FName MetaDataId;
+		FString MetaDataValue;
+	};
+
+	/** 每帧写入一次 */
+	bool Tick(float DeltaTime);
+
+	/** 写入一个表的缓冲条目：一次 Modify，批量写入，刷新一次编辑器 */
+	static void WriteEntries(UStringTable* StringTable, const TArray<FPendingEntry>& Entries);
+
+private:
+	/** 每个表等待写入的条目（按写入顺序，同一条目后写入的覆盖先写入的） */
+	TMap<TWeakObjectPtr<UStringTable>, TArray<FPendingEntry>> PendingWrites;
+
+	FTSTicker::FDelegateHandle TickerHandle;
+};
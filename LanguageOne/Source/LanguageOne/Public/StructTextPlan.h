@@ -0,0 +1,122 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * 结构体中的一个文本字段（遍历时传给访问函数）
+ */
+struct FStructTextField
+{
+	/** FText 字段时有效 */
+	FText* Text = nullptr;
+
+	/** FString 字段时有效 */
+	FString* String = nullptr;
+
+	/** 是否需要翻译（FText 总是需要；FString 只有字段名包含 text/desc/content/comment/tooltip 时需要） */
+	bool bTranslatable = false;
+
+	/** 字段位置，可以用 FStructTextPlan::Resolve 重新定位（容器内存可能在写回前重新分配） */
+	TConstArrayView<int32> Steps;
+
+	/** 当前文本 */
+	const FString& GetString() const { return Text ? Text->ToString() : *String; }
+
+	/** 写入文本 */
+	void SetString(const FString& NewText) const
+	{
+		if (Text)
+		{
+			*Text = FText::FromString(NewText);
+		}
+		else
+		{
+			*String = NewText;
+		}
+	}
+};
+
+/**
+ * 结构体文本提取计划 - 每个 UScriptStruct 只通过反射构建一次，之后对每一行直接按偏移读取
+ *
+ * - 列出所有 FText / FString 字段的偏移，嵌套结构体展开为偏移
+ * - 递归进入 TArray 和 TMap 的值（Map 的键参与哈希，不修改），以及固定长度数组
+ * - 不包含任何文本字段的属性和容器不进入计划，遍历时直接跳过
+ * - 计划按结构体缓存，结构体重新编译（属性变化）后自动重建
+ *
+ * 所有方法都在游戏线程调用
+ */
+class LANGUAGEONE_API FStructTextPlan
+{
+public:
+	/** 获取结构体的提取计划（首次调用时构建） */
+	static TSharedRef<const FStructTextPlan> Get(const UScriptStruct* Struct);
+
+	/** 遍历 StructData 中的所有文本字段；bOnlyTranslatable 为 true 时跳过不需要翻译的 FString 字段 */
+	void ForEachField(void* StructData, bool bOnlyTranslatable, TFunctionRef<void(const FStructTextField& Field)> Visitor) const;
+
+	/** 按位置重新定位字段；位置已失效（容器元素被删除等）时返回 false */
+	bool Resolve(void* StructData, TConstArrayView<int32> Steps, FStructTextField& OutField) const;
+
+	/** 位置描述（用于日志），如 Items[2].Name */
+	FString DescribePath(TConstArrayView<int32> Steps) const;
+
+	/** 是否包含文本字段 */
+	bool IsEmpty() const { return Root.Nodes.Num() == 0; }
+
+private:
+	enum class ENodeKind : uint8
+	{
+		Text,
+		String,
+		Array,
+		Map
+	};
+
+	struct FScope;
+
+	/** 计划节点：文本字段或包含文本字段的容器 */
+	struct FNode
+	{
+		ENodeKind Kind = ENodeKind::Text;
+
+		/** 相对所在作用域起点的偏移 */
+		int32 Offset = 0;
+
+		/** 字段路径（嵌套结构体展开后为 Outer.Inner） */
+		FString Name;
+
+		bool bTranslatable = false;
+
+		/** 容器属性（Array / Map） */
+		const FProperty* ContainerProperty = nullptr;
+
+		/** 容器元素（Map 为值）的计划，偏移相对元素起点 */
+		TSharedPtr<FScope> Element;
+	};
+
+	struct FScope
+	{
+		TArray<FNode> Nodes;
+	};
+
+	/** 把结构体的文本字段加入作用域（嵌套结构体展开） */
+	static void BuildStruct(const UScriptStruct* Struct, int32 BaseOffset, const FString& Prefix, FScope& OutScope, TArray<const UScriptStruct*>& Stack);
+
+	/** 把一个属性（的一个元素）加入作用域；NameProperty 用于判断 FString 是否需要翻译（容器元素取容器属性） */
+	static void BuildProperty(const FProperty* Property, const FProperty* NameProperty, int32 Offset, const FString& Name, FScope& OutScope, TArray<const UScriptStruct*>& Stack);
+
+	/** 元素包含文本字段时加入容器节点 */
+	static void AddContainerNode(ENodeKind Kind, const FProperty* ContainerProperty, int32 Offset, const FString& Name, TSharedPtr<FScope> Element, FScope& OutScope);
+
+	void VisitScope(const FScope& Scope, uint8* Data, bool bOnlyTranslatable, TArray<int32, TInlineAllocator<8>>& Steps, TFunctionRef<void(const FStructTextField& Field)> Visitor) const;
+
+private:
+	FScope Root;
+
+	/** 构建时的结构体布局，用于检测重新编译 */
+	const FProperty* PropertyLink = nullptr;
+	int32 StructureSize = 0;
+};
@@ -0,0 +1,126 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Async/Future.h"
+#include "Containers/Ticker.h"
+#include "LanguageOneSettings.h"
+
+/**
+ * 翻译记忆库 - 缓存已经翻译过的文本，避免重复发送网络请求
+ *
+ * 键：(翻译服务, 源语言, 目标语言, 规范化原文哈希)
+ * - 内存命中直接返回
+ * - 新条目延迟批量追加到 Saved/LanguageOne/TranslationMemory.tsv（后台线程写盘）
+ * - 写盘时持有系统级互斥锁，并合并其他编辑器会话追加的条目，多个会话可同时写入
+ */
+class LANGUAGEONE_API FTranslationMemory
+{
+public:
+	static FTranslationMemory& Get();
+
+	/** 加载磁盘数据并启动定时写盘（模块启动时调用） */
+	void Initialize();
+
+	/** 写入所有待保存条目并停止定时器（模块关闭时调用） */
+	void Shutdown();
+
+	/** 查找缓存的译文 */
+	bool Find(ETranslateProvider Provider, const FString& SourceLang, const FString& TargetLang, const FString& SourceText, FString& OutTranslation);
+
+	/** 记录译文（延迟写盘） */
+	void Add(ETranslateProvider Provider, const FString& SourceLang, const FString& TargetLang, const FString& SourceText, const FString& Translation);
+
+	/** 把待写入条目刷到磁盘；bWait 为 true 时阻塞到写盘完成 */
+	void Flush(bool bWait = false);
+
+	/** 当前条目数量 */
+	int32 Num() const;
+
+	/** 本次会话的命中/未命中次数 */
+	int32 GetHitCount() const { return HitCount; }
+	int32 GetMissCount() const { return MissCount; }
+
+	/** 规范化原文（去除首尾空白，统一换行符），作为缓存键的一部分 */
+	static FString NormalizeSourceText(const FString& SourceText);
+
+	/** TSV 字段转义（反斜杠、制表符、换行），批量翻译日志使用同样的格式 */
+	static FString EscapeField(const FString& Text);
+	static FString UnescapeField(const FString& Text);
+
+	/** 记忆库文件路径 */
+	static FString GetMemoryFilePath();
+
+private:
+	FTranslationMemory() = default;
+
+	struct FMemoryKey
+	{
+		uint8 Provider = 0;
+		FString SourceLang;
+		FString TargetLang;
+		uint64 SourceHash = 0;
+
+		bool operator==(const FMemoryKey& Other) const
+		{
+			return SourceHash == Other.SourceHash && Provider == Other.Provider && SourceLang == Other.SourceLang && TargetLang == Other.TargetLang;
+		}
+
+		friend uint32 GetTypeHash(const FMemoryKey& Key)
+		{
+			return HashCombine(HashCombine(::GetTypeHash(Key.SourceHash), ::GetTypeHash(Key.Provider)), HashCombine(GetTypeHash(Key.SourceLang), GetTypeHash(Key.TargetLang)));
+		}
+	};
+
+	struct FMemoryEntry
+	{
+		/** 规范化后的原文，用于防止哈希碰撞 */
+		FString Source;
+		FString Translation;
+	};
+
+	static FMemoryKey MakeKey(ETranslateProvider Provider, const FString& SourceLang, const FString& TargetLang, const FString& NormalizedSource);
+
+	/** 解析文件内容并合并到内存（调用方需持有 MemoryLock） */
+	void ParseLines(const FString& Content);
+
+	/** 序列化一行记录 */
+	static FString SerializeLine(uint8 Provider, const FString& SourceLang, const FString& TargetLang, const FString& Source, const FString& Translation);
+
+	/** 后台写盘：追加新行，并读取其他会话写入的新内容 */
+	void WriteBehind(FString PendingText);
+
+	/** 写盘失败：把未写入的行放回待写入队列开头，下次再试 */
+	void RequeuePendingText(const FString& PendingText);
+
+	/** 条目过多重复时重写文件 */
+	void CompactIfNeeded();
+
+	/** 定时写盘回调 */
+	bool Tick(float DeltaTime);
+
+private:
+	mutable FCriticalSection MemoryLock;
+	TMap<FMemoryKey, FMemoryEntry> Entries;
+
+	/** 尚未写入磁盘的行 */
+	FString PendingLines;
+	int32 PendingCount = 0;
+
+	/** 已读取到的文件位置（字节），用于增量合并其他会话的写入 */
+	int64 KnownFileSize = 0;
+
+	/** 已读取文件的代号，其他会话压缩重写文件后会变化 */
+	FString KnownGeneration;
+
+	/** 文件中的总行数（含重复），用于判断是否需要压缩 */
+	int32 FileLineCount = 0;
+
+	TFuture<void> FlushTask;
+	FTSTicker::FDelegateHandle TickerHandle;
+	bool bInitialized = false;
+
+	int32 HitCount = 0;
+	int32 MissCount = 0;
+};
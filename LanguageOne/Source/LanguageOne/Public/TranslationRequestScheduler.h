@@ -0,0 +1,334 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/Ticker.h"
+#include "Interfaces/IHttpRequest.h"
+#include "LanguageOneSettings.h"
+
+/**
+ * 请求调度类别
+ */
+enum class ETranslationRequestPriority : uint8
+{
+	/** 批量任务（资产翻译、命令行） */
+	Bulk,
+
+	/** 交互操作（Alt+E 翻译选中节点）：优先发送，并保留并发名额 */
+	Interactive,
+
+	Count
+};
+
+/**
+ * 请求调度统计
+ */
+struct FTranslationSchedulerStats
+{
+	/** 排队等待发送的请求数量 */
+	int32 QueuedRequests = 0;
+
+	/** 正在进行的请求数量 */
+	int32 InFlightRequests = 0;
+
+	/** 已发送的请求总数 */
+	int32 SentRequests = 0;
+
+	/** 收到 429 / Retry-After 的次数 */
+	int32 ThrottledResponses = 0;
+
+	/** 重试次数 */
+	int32 RetriedRequests = 0;
+
+	/** 平均排队时间（秒） */
+	double AverageWaitSeconds = 0.0;
+
+	/** 最长排队时间（秒） */
+	double MaxWaitSeconds = 0.0;
+
+	/** 平均请求耗时（发送到完成，秒） */
+	double AverageLatencySeconds = 0.0;
+
+	/** 最长请求耗时（秒） */
+	double MaxLatencySeconds = 0.0;
+};
+
+/**
+ * 请求组中一个翻译服务的请求统计（任务报告使用）
+ */
+struct FTranslationProviderRunStats
+{
+	/** 发送的请求数量（含重试） */
+	int32 Requests = 0;
+
+	/** 重试次数 */
+	int32 Retries = 0;
+
+	/** 重试后仍然失败的请求数量 */
+	int32 Failures = 0;
+
+	/** 发送的原文字符数 */
+	int64 CharactersSent = 0;
+
+	/** 每次发送到完成的耗时（秒） */
+	TArray<double> LatencySeconds;
+
+	/** 失败原因（connection_failed、http_429 等）和次数 */
+	TMap<FString, int32> FailuresByReason;
+};
+
+/**
+ * 请求组统计
+ */
+struct FTranslationGroupStats
+{
+	/** 每个翻译服务的请求统计 */
+	TMap<ETranslateProvider, FTranslationProviderRunStats> Providers;
+
+	/** 翻译记忆库命中的文本数量 */
+	int32 CacheHits = 0;
+};
+
+/**
+ * 翻译请求调度器 - 控制同时进行的请求数量和每个翻译服务的请求速率
+ *
+ * - 全局并发上限：同时进行的请求不超过 MaxConcurrentRequests
+ * - 每个 ETranslateProvider 一个令牌桶：每秒补充 ProviderRequestsPerSecond 个令牌
+ * - 服务返回 Retry-After（或 429）时暂停该服务的发送，直到指定时间
+ * - 可重试的失败（连接失败/超时、408、429、5xx）按带抖动的指数退避自动重试，调用方只会收到最终结果
+ * - 请求可以归入请求组（FScopedRequestGroup），取消请求组会丢弃排队请求并中止进行中的请求
+ * - 交互请求（FScopedRequestPriority）排在批量请求之前发送，并保留 InteractiveReservedRequests 个并发名额，批量任务运行时交互操作不必排队
+ *
+ * 所有方法都在游戏线程调用（HTTP 回调同样在游戏线程）
+ */
+class LANGUAGEONE_API FTranslationRequestScheduler
+{
+public:
+	static FTranslationRequestScheduler& Get();
+
+	/**
+	 * 请求组作用域 - 作用域内排队的请求归入指定请求组
+	 * 请求组会传递给完成回调中发起的后续请求（故障转移等）
+	 */
+	struct FScopedRequestGroup
+	{
+		explicit FScopedRequestGroup(uint32 InGroup)
+			: GroupGuard(Get().CurrentGroup, InGroup)
+		{}
+
+	private:
+		TGuardValue<uint32> GroupGuard;
+	};
+
+	/**
+	 * 请求类别作用域 - 作用域内排队的请求使用指定类别
+	 * 类别同样会传递给完成回调中发起的后续请求
+	 */
+	struct FScopedRequestPriority
+	{
+		explicit FScopedRequestPriority(ETranslationRequestPriority InPriority)
+			: PriorityGuard(Get().CurrentPriority, InPriority)
+		{}
+
+	private:
+		TGuardValue<ETranslationRequestPriority> PriorityGuard;
+	};
+
+	/** 当前作用域的请求类别 */
+	ETranslationRequestPriority GetCurrentPriority() const { return CurrentPriority; }
+
+	/** 分配新的请求组编号（0 表示不属于任何组） */
+	uint32 AllocateRequestGroup();
+
+	/** 当前作用域的请求组（异步发出后续请求前保存，回调中用 FScopedRequestGroup 恢复） */
+	uint32 GetCurrentRequestGroup() const { return CurrentGroup; }
+
+	/** 开始统计请求组的请求（未开始统计的请求组不记录） */
+	void TrackRequestGroup(uint32 Group);
+
+	/** 取出请求组统计并停止统计 */
+	FTranslationGroupStats TakeRequestGroupStats(uint32 Group);
+
+	/** 记录当前请求组发给翻译服务的原文字符数 */
+	void RecordCharactersSent(ETranslateProvider Provider, int32 Characters);
+
+	/** 记录当前请求组命中翻译记忆库的文本数量 */
+	void RecordCacheHits(int32 Count);
+
+	/**
+	 * 取消请求组：丢弃排队请求，中止进行中的请求；返回受影响的请求数量
+	 * 被丢弃和中止的请求以失败（bSuccess 为 false、没有响应）执行完成回调，调用方总能收到结果；之后在该组中排队的请求同样立即失败
+	 */
+	int32 CancelRequestGroup(uint32 Group);
+
+	/** 请求组是否已取消 */
+	bool IsGroupCancelled(uint32 Group) const { return Group != 0 && CancelledGroups.Contains(Group); }
+
+	/** 启动调度定时器（模块启动时调用） */
+	void Initialize();
+
+	/** 停止定时器，丢弃排队和等待重试的请求，中止进行中的请求，之后不再执行任何完成回调（模块关闭时调用） */
+	void Shutdown();
+
+	/** 排队发送请求；请求的完成回调会在释放并发名额后执行 */
+	void Enqueue(ETranslateProvider Provider, TSharedRef<IHttpRequest, ESPMode::ThreadSafe> Request);
+
+	/** 所有服务的汇总统计 */
+	FTranslationSchedulerStats GetStats() const;
+
+	/** 指定服务的统计 */
+	FTranslationSchedulerStats GetProviderStats(ETranslateProvider Provider) const;
+
+	/** 指定类别的统计（交互请求和批量请求的排队时间、耗时分开统计） */
+	FTranslationSchedulerStats GetPriorityStats(ETranslationRequestPriority Priority) const;
+
+	/** 解析 Retry-After 响应头（秒数或 HTTP 日期），返回需要等待的秒数 */
+	static bool ParseRetryAfter(const FString& HeaderValue, double& OutSeconds);
+
+	/** 是否为可重试的失败（连接失败/超时、408、429、5xx） */
+	static bool IsRetryableFailure(FHttpResponsePtr Response, bool bSuccess);
+
+private:
+	FTranslationRequestScheduler() = default;
+
+	struct FQueuedRequest
+	{
+		TSharedPtr<IHttpRequest, ESPMode::ThreadSafe> Request;
+		double EnqueueTime = 0.0;
+
+		/** 调用方的完成回调（重试时转移到新请求上） */
+		FHttpRequestCompleteDelegate OnComplete;
+
+		/** 已重试次数 */
+		int32 Attempt = 0;
+
+		/** 重试请求的最早发送时间 */
+		double NotBefore = 0.0;
+
+		/** 所属请求组 */
+		uint32 Group = 0;
+
+		/** 请求类别 */
+		ETranslationRequestPriority Priority = ETranslationRequestPriority::Bulk;
+
+		/** Insights 追踪：请求编号（重试沿用）和文本单元批次 */
+		uint32 TraceRequestId = 0;
+		uint32 TraceBatch = 0;
+	};
+
+	/** 每个类别的请求计数 */
+	struct FPriorityCounters
+	{
+		int32 InFlight = 0;
+		int32 Sent = 0;
+		int32 Retried = 0;
+		int32 Completed = 0;
+		double TotalWaitSeconds = 0.0;
+		double MaxWaitSeconds = 0.0;
+		double TotalLatencySeconds = 0.0;
+		double MaxLatencySeconds = 0.0;
+	};
+
+	/** 每个翻译服务的发送通道 */
+	struct FProviderLane
+	{
+		/** 批量请求队列 */
+		TArray<FQueuedRequest> Queue;
+		int32 QueueHead = 0;
+
+		/** 交互请求队列（数量很少，先于批量请求发送） */
+		TArray<FQueuedRequest> InteractiveQueue;
+
+		/** 等待退避结束的重试请求 */
+		TArray<FQueuedRequest> RetryQueue;
+
+		/** 令牌桶 */
+		double Tokens = 0.0;
+		double LastRefillTime = 0.0;
+		bool bTokensInitialized = false;
+
+		/** Retry-After 暂停截止时间 */
+		double BlockedUntil = 0.0;
+
+		int32 InFlight = 0;
+		int32 Sent = 0;
+		int32 Throttled = 0;
+		int32 Retried = 0;
+		int32 Completed = 0;
+		double TotalWaitSeconds = 0.0;
+		double MaxWaitSeconds = 0.0;
+		double TotalLatencySeconds = 0.0;
+		double MaxLatencySeconds = 0.0;
+
+		int32 NumQueued() const { return Queue.Num() - QueueHead + InteractiveQueue.Num() + RetryQueue.Num(); }
+	};
+
+	/** 发送所有满足条件的排队请求 */
+	void Pump();
+
+	/** 补充令牌 */
+	static void RefillTokens(FProviderLane& Lane, ETranslateProvider Provider, double Now);
+
+	/** 发送请求并接管完成回调 */
+	void Dispatch(ETranslateProvider Provider, FProviderLane& Lane, const FQueuedRequest& Queued, double Now);
+
+	/** 取出下一个可以发送的指定类别请求（到期的重试优先） */
+	static bool PopNextRequest(FProviderLane& Lane, ETranslationRequestPriority Priority, double Now, FQueuedRequest& OutRequest);
+
+	/** 发送指定类别的排队请求，直到达到该类别的并发上限 */
+	void PumpPriority(ETranslationRequestPriority Priority, int32 MaxConcurrent, int32 MaxPriorityInFlight, double Now);
+
+	/** 请求完成：释放名额，处理 Retry-After；返回服务要求的暂停时间（秒） */
+	double OnRequestFinished(ETranslateProvider Provider, FHttpResponsePtr Response);
+
+	/** 复制请求，按退避时间重新排队 */
+	void ScheduleRetry(ETranslateProvider Provider, const FQueuedRequest& Failed, FHttpRequestPtr FailedRequest, double MinDelaySeconds);
+
+	bool Tick(float DeltaTime);
+
+	/** 请求组的一个请求结束（完成或被丢弃）；已取消的组没有未完成的请求后，过一段时间不再记录取消状态 */
+	void ReleaseGroupRequest(uint32 Group);
+
+	/** 以失败执行被丢弃请求的完成回调（恢复请求组、类别和追踪批次） */
+	static void FailDroppedRequest(const FQueuedRequest& Queued);
+
+	static FTranslationSchedulerStats MakeStats(const FProviderLane& Lane);
+
+	/** 请求组中指定服务的统计（请求组未开始统计时返回空） */
+	FTranslationProviderRunStats* FindGroupProviderStats(uint32 Group, ETranslateProvider Provider);
+
+	/** 失败原因：connection_failed 或 http_<状态码> */
+	static FString GetFailureReason(FHttpResponsePtr Response, bool bSuccess);
+
+private:
+	TMap<ETranslateProvider, FProviderLane> Lanes;
+	int32 TotalInFlight = 0;
+	bool bIsPumping = false;
+	bool bShuttingDown = false;
+
+	/** 每个类别的计数 */
+	FPriorityCounters PriorityCounters[(int32)ETranslationRequestPriority::Count];
+
+	/** 当前作用域的请求类别 */
+	ETranslationRequestPriority CurrentPriority = ETranslationRequestPriority::Bulk;
+
+	/** 当前作用域的请求组 */
+	uint32 CurrentGroup = 0;
+	uint32 NextGroup = 1;
+	TSet<uint32> CancelledGroups;
+
+	/** 每个请求组排队、等待重试和进行中的请求数量 */
+	TMap<uint32, int32> GroupOutstanding;
+
+	/** 已取消且没有未完成请求的组，到期后移出 CancelledGroups（期间迟到的回调再次排队仍会立即失败） */
+	TMap<uint32, double> ExpiringCancelledGroups;
+
+	/** 正在统计的请求组 */
+	TMap<uint32, FTranslationGroupStats> GroupStats;
+
+	/** 进行中的请求及其请求组（0 表示不属于任何组） */
+	TMap<TSharedPtr<IHttpRequest, ESPMode::ThreadSafe>, uint32> InFlightGroups;
+
+	FTSTicker::FDelegateHandle TickerHandle;
+};
@@ -0,0 +1,68 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/Queue.h"
+#include "Containers/Ticker.h"
+#include "TranslationRequestScheduler.h"
+#include <atomic>
+
+/**
+ * 翻译结果队列 - 在工作线程解析响应，在游戏线程按时间预算分帧执行回调
+ *
+ * - Launch 把解析工作交给后台线程池，解析结果通过 Post 放入无锁队列（多生产者、单消费者）
+ * - 游戏线程的定时器每帧从队列取出回调执行，超过 ResultApplyBudgetMs 后留到下一帧，大批量响应同一帧到达时不会卡顿
+ * - 回调执行时恢复投递时指定的请求组、优先级和追踪批次，回调中发起的后续请求（故障转移等）仍归入原任务
+ * - 交互请求的结果放在单独的队列中，每帧先于批量结果执行
+ *
+ * Launch、Initialize、Shutdown 在游戏线程调用；Post 可以在任意线程调用
+ */
+class LANGUAGEONE_API FTranslationResultQueue
+{
+public:
+	static FTranslationResultQueue& Get();
+
+	/** 启动分帧定时器（模块启动时调用） */
+	void Initialize();
+
+	/** 等待进行中的解析结束，丢弃尚未执行的回调并停止定时器（模块关闭时调用） */
+	void Shutdown();
+
+	/** 在后台线程执行 Work（Work 中调用 Post 把结果送回游戏线程） */
+	void Launch(TUniqueFunction<void()> Work);
+
+	/** 投递在游戏线程执行的回调（任意线程调用），回调执行时恢复请求组 Group、优先级 Priority 和追踪批次 TraceBatch */
+	void Post(uint32 Group, ETranslationRequestPriority Priority, uint32 TraceBatch, TUniqueFunction<void()> Callback);
+
+	/** 尚未执行的回调数量（近似值） */
+	int32 GetPendingCount() const { return PendingCount.load(); }
+
+private:
+	FTranslationResultQueue() = default;
+
+	struct FPendingResult
+	{
+		uint32 Group = 0;
+		ETranslationRequestPriority Priority = ETranslationRequestPriority::Bulk;
+		uint32 TraceBatch = 0;
+		TUniqueFunction<void()> Callback;
+	};
+
+	/** 按时间预算执行队列中的回调 */
+	bool Tick(float DeltaTime);
+
+private:
+	/** 按优先级分开的结果队列 */
+	TQueue<FPendingResult, EQueueMode::Mpsc> Results[(int32)ETranslationRequestPriority::Count];
+
+	std::atomic<int32> PendingCount { 0 };
+
+	/** 正在后台线程执行的解析和正在进行的 Post 数量，Shutdown 等待归零后再清空队列 */
+	std::atomic<int32> RunningTasks { 0 };
+
+	/** 游戏线程写入，HTTP 和工作线程在 Post、Launch 中读取 */
+	std::atomic<bool> bShuttingDown { false };
+
+	FTSTicker::FDelegateHandle TickerHandle;
+};